@@ -33,6 +33,11 @@ public:
 
     BandMatrix(int64_t kl, int64_t ku, Matrix<scalar_t>& orig);
 
+    static
+    BandMatrix fromLAPACKBand(int64_t m, int64_t n, int64_t kl, int64_t ku,
+                              scalar_t const* ab, int64_t ldab,
+                              int64_t nb, int p, int q, MPI_Comm mpi_comm);
+
     BandMatrix<scalar_t> slice(
         int64_t row1, int64_t row2,
         int64_t col1, int64_t col2);
@@ -57,6 +62,9 @@ public:
 
     int64_t upperBandwidth() const;
     void    upperBandwidth(int64_t ku);
+
+    void    insertLocalTiles(Target origin=Target::Host);
+    void    copyToLAPACKBand(scalar_t* ab, int64_t ldab);
 };
 
 //------------------------------------------------------------------------------
@@ -122,6 +130,84 @@ BandMatrix<scalar_t>::BandMatrix(
     : BaseBandMatrix<scalar_t>(kl, ku, orig)
 {}
 
+//------------------------------------------------------------------------------
+/// Named constructor returns a new m-by-n band matrix, with local tiles
+/// inside the band allocated and copied from a matrix in LAPACK band
+/// storage, as used by gbmv, gbtrf, and gbsv.
+/// Only the band is read; entries of tiles outside the band are set to zero.
+/// Each rank reads only the columns of ab for its local tiles, so ab needs
+/// to be valid only in those columns.
+///
+/// @param[in] m
+///     Number of rows of the matrix. m >= 0.
+///
+/// @param[in] n
+///     Number of columns of the matrix. n >= 0.
+///
+/// @param[in] kl
+///     Number of subdiagonals within band. kl >= 0.
+///
+/// @param[in] ku
+///     Number of superdiagonals within band. ku >= 0.
+///
+/// @param[in] ab
+///     The ldab-by-n band matrix in LAPACK band storage:
+///     $A_{i, j}$ is stored in ab[ ku + i - j + j*ldab ]
+///     for $\max(0, j - ku) \le i \le \min(m-1, j + kl)$.
+///     For ab as used by gbtrf, with kl extra rows for fill,
+///     pass ab + kl.
+///
+/// @param[in] ldab
+///     Leading dimension of ab. ldab >= kl + ku + 1.
+///
+/// @param[in] nb
+///     Block size in 2D block-cyclic distribution. nb > 0.
+///
+/// @param[in] p
+///     Number of block rows in 2D block-cyclic distribution. p > 0.
+///
+/// @param[in] q
+///     Number of block columns of 2D block-cyclic distribution. q > 0.
+///
+/// @param[in] mpi_comm
+///     MPI communicator to distribute matrix across.
+///     p*q == MPI_Comm_size(mpi_comm).
+///
+template <typename scalar_t>
+BandMatrix<scalar_t> BandMatrix<scalar_t>::fromLAPACKBand(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    scalar_t const* ab, int64_t ldab,
+    int64_t nb, int p, int q, MPI_Comm mpi_comm)
+{
+    slate_assert( ldab >= kl + ku + 1 );
+
+    BandMatrix<scalar_t> A( m, n, kl, ku, nb, p, q, mpi_comm );
+    A.insertLocalTiles();
+
+    int64_t klt = ceildiv( kl, nb );
+    int64_t kut = ceildiv( ku, nb );
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        int64_t istart = blas::max( 0, j-kut );
+        int64_t iend   = blas::min( j+klt+1, A.mt() );
+        for (int64_t i = istart; i < iend; ++i) {
+            if (A.tileIsLocal( i, j )) {
+                auto T = A( i, j );
+                for (int64_t tj = 0; tj < T.nb(); ++tj) {
+                    int64_t jj = j*nb + tj;
+                    for (int64_t ti = 0; ti < T.mb(); ++ti) {
+                        int64_t ii = i*nb + ti;
+                        if (jj - ku <= ii && ii <= jj + kl)
+                            T.at( ti, tj ) = ab[ ku + ii - jj + jj*ldab ];
+                        else
+                            T.at( ti, tj ) = 0;
+                    }
+                }
+            }
+        }
+    }
+    return A;
+}
+
 //------------------------------------------------------------------------------
 /// Sliced matrix constructor creates shallow copy view of parent matrix,
 /// A[ row1:row2, col1:col2 ].
@@ -260,6 +346,82 @@ void BandMatrix<scalar_t>::upperBandwidth(int64_t ku)
         this->kl_ = ku;
 }
 
+//------------------------------------------------------------------------------
+/// Inserts all local tiles inside the band into an empty matrix.
+/// Tiles outside the band are not allocated.
+///
+/// @param[in] origin
+///     - if origin = Devices, inserts tiles on appropriate GPU devices, or
+///     - if origin = Host, inserts on tiles on CPU host.
+///
+// todo: assumes uniform, square tiles, as does getMaxDeviceTiles.
+template <typename scalar_t>
+void BandMatrix<scalar_t>::insertLocalTiles(Target origin)
+{
+    this->origin_ = origin;
+    bool on_devices = (origin == Target::Devices);
+    int64_t mt = this->mt();
+    int64_t nt = this->nt();
+    int64_t klt = ceildiv( lowerBandwidth(), this->tileNb(0) );
+    int64_t kut = ceildiv( upperBandwidth(), this->tileNb(0) );
+    for (int64_t j = 0; j < nt; ++j) {
+        int64_t istart = blas::max( 0, j-kut );
+        int64_t iend   = blas::min( j+klt+1, mt );
+        for (int64_t i = istart; i < iend; ++i) {
+            if (this->tileIsLocal(i, j)) {
+                int dev = (on_devices ? this->tileDevice(i, j)
+                                      : HostNum);
+                this->tileInsert(i, j, dev);
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Copies the band of the local tiles into a matrix in LAPACK band storage;
+/// the inverse of fromLAPACKBand. Each rank writes only the entries of its
+/// local tiles, so to collect the whole band on one rank, reduce or gather
+/// ab afterwards.
+/// Tiles must be on the host, in column-major layout.
+///
+/// @param[out] ab
+///     The ldab-by-n band matrix in LAPACK band storage:
+///     $A_{i, j}$ is stored in ab[ ku + i - j + j*ldab ].
+///
+/// @param[in] ldab
+///     Leading dimension of ab. ldab >= kl + ku + 1.
+///
+template <typename scalar_t>
+void BandMatrix<scalar_t>::copyToLAPACKBand(scalar_t* ab, int64_t ldab)
+{
+    slate_assert( this->op() == Op::NoTrans );
+    int64_t kl = lowerBandwidth();
+    int64_t ku = upperBandwidth();
+    slate_assert( ldab >= kl + ku + 1 );
+
+    int64_t nb = this->tileNb(0);
+    int64_t klt = ceildiv( kl, nb );
+    int64_t kut = ceildiv( ku, nb );
+    for (int64_t j = 0; j < this->nt(); ++j) {
+        int64_t istart = blas::max( 0, j-kut );
+        int64_t iend   = blas::min( j+klt+1, this->mt() );
+        for (int64_t i = istart; i < iend; ++i) {
+            if (this->tileIsLocal( i, j )) {
+                this->tileGetForReading( i, j, LayoutConvert::ColMajor );
+                auto T = (*this)( i, j );
+                for (int64_t tj = 0; tj < T.nb(); ++tj) {
+                    int64_t jj = j*nb + tj;
+                    for (int64_t ti = 0; ti < T.mb(); ++ti) {
+                        int64_t ii = i*nb + ti;
+                        if (jj - ku <= ii && ii <= jj + kl)
+                            ab[ ku + ii - jj + jj*ldab ] = T.at( ti, tj );
+                    }
+                }
+            }
+        }
+    }
+}
+
 } // namespace slate
 
 #endif // SLATE_BAND_MATRIX_HH
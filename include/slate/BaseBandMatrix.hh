@@ -23,6 +23,14 @@ namespace slate {
 
 //==============================================================================
 /// Base class for all SLATE distributed, tiled banded storage matrices.
+///
+/// Every tile that intersects the band is stored as a full, dense nb-by-nb
+/// tile, as the tile kernels require. So a band with kl sub- and ku
+/// superdiagonals stores about (ceil( kl/nb ) + ceil( ku/nb ) + 1) nb rows
+/// per column, plus the fill tiles that gbtrf inserts, instead of
+/// kl + ku + 1. For narrow bands, choose nb near max( kl, ku ) to limit
+/// this overhead. Use fromLAPACKBand and copyToLAPACKBand to exchange
+/// bands with LAPACK-style (ab) storage.
 template <typename scalar_t>
 class BaseBandMatrix: public BaseMatrix<scalar_t> {
 public:
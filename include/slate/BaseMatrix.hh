@@ -22,6 +22,7 @@
 #include <memory>
 #include <set>
 #include <list>
+#include <map>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -223,6 +224,12 @@ public:
         return storage_->tileDevice(globalIndex(i, j));
     }
 
+    /// Returns NUMA domain holding the host instance of tile {i, j} of op(A).
+    int tileNumaDomain(int64_t i, int64_t j) const
+    {
+        return storage_->tileNumaDomain(globalIndex(i, j));
+    }
+
     /// Returns whether tile {i, j} of op(A) is local.
     bool tileIsLocal(int64_t i, int64_t j) const
     {
@@ -508,7 +515,8 @@ public:
         bool is_shared = false);
 
     template <Target target = Target::Host>
-    void listReduce(ReduceList& reduce_list, Layout layout, int tag = 0);
+    void listReduce(ReduceList& reduce_list, Layout layout, int tag = 0,
+                    internal::ReducePlan const& plan = internal::ReducePlan());
 
     //--------------------------------------------------------------------------
     // LAYOUT
@@ -572,6 +580,10 @@ protected:
     void tileBcastToSet(int64_t i, int64_t j, std::set<int> const& bcast_set,
                         int radix, int tag, Layout layout,
                         Target target);
+    void tileIbcastToSetNode(int64_t i, int64_t j,
+                             std::set<int> const& bcast_set,
+                             int radix, int tag, Layout layout,
+                             std::vector<MPI_Request>& send_requests);
     void tileIbcastToSet(int64_t i, int64_t j, std::set<int> const& bcast_set,
                         int radix, int tag, Layout layout,
                         std::vector<MPI_Request>& send_requests,
@@ -582,6 +594,9 @@ public:
     void tileReduceFromSet(int64_t i, int64_t j, int root_rank,
                            std::set<int>& reduce_set, int radix, int tag,
                            Layout layout);
+    void tileReduceFromSet(int64_t i, int64_t j, int root_rank,
+                           std::set<int>& reduce_set, int tag, Layout layout,
+                           internal::ReducePlan const& plan, int tree_root);
 
 
     void getRanks(std::set<int>* bcast_set) const;
@@ -629,6 +644,50 @@ public:
         storage_->clearWorkspace();
     }
 
+    /// Reserves num_tiles tiles per rank in memory shared by the ranks on
+    /// each node. Afterwards, broadcasts (listBcast, listBcastMT) send each
+    /// tile once to each node, and ranks on the node read one shared copy,
+    /// rather than each receiving its own copy. If the shared memory is
+    /// full, tiles are sent to each rank as before.
+    /// Received tiles are copied to private memory before being modified
+    /// or converted to another layout.
+    /// Collective over the matrix's MPI communicator.
+    /// WARNING: this applies to the entire parent matrix,
+    /// not just a sub-matrix.
+    void reserveNodeWorkspace(int64_t num_tiles)
+    {
+        storage_->reserveNodeWorkspace(mpi_comm_, num_tiles);
+    }
+
+    void createTileWindow();
+
+    /// Frees the window created by createTileWindow.
+    /// Collective over the matrix's MPI communicator.
+    /// Fetched tiles remain until released.
+    void freeTileWindow()
+    {
+        storage_->freeTileWindow();
+    }
+
+    void tileFetch(std::set<ij_tuple>& tile_set,
+                   LayoutConvert layout = LayoutConvert::None);
+
+    /// Fetches tile {i, j} to the host. @see tileFetch(tile_set, layout).
+    void tileFetch(int64_t i, int64_t j,
+                   LayoutConvert layout = LayoutConvert::None)
+    {
+        std::set<ij_tuple> tile_set = { { i, j } };
+        tileFetch(tile_set, layout);
+    }
+
+    /// Frees memory reserved by reserveNodeWorkspace.
+    /// Collective over the matrix's MPI communicator.
+    /// All workspace tiles should be released first, e.g., by clearWorkspace.
+    void clearNodeWorkspace()
+    {
+        storage_->clearNodeWorkspace();
+    }
+
     /// Allocates batch arrays and BLAS++ queues for all devices.
     /// Matrix classes override this with versions that can also allocate based
     /// on the number of local tiles.
@@ -2096,11 +2155,32 @@ void BaseMatrix<scalar_t>::listBcastMT(
 }
 
 //------------------------------------------------------------------------------
+/// Reduces each tile in the list from the ranks owning its source
+/// submatrices to the tile's owner, as described by plan.
+///
+/// @param[in] reduce_list
+///     List of (i, j, destination, sources) tuples.
+///
+/// @param[in] layout
+///     Layout of the tiles sent and received.
+///
+/// @param[in] tag
+///     MPI tag.
+///
+/// @param[in] plan
+///     Shape of the reductions: tree radix, message segmentation,
+///     reduce-scatter, and node-aware trees. Default is a radix-2 tree
+///     rooted at the owner, sending whole tiles.
 ///
 template <typename scalar_t>
 template <Target target>
-void BaseMatrix<scalar_t>::listReduce(ReduceList& reduce_list, Layout layout, int tag)
+void BaseMatrix<scalar_t>::listReduce(
+    ReduceList& reduce_list, Layout layout, int tag,
+    internal::ReducePlan const& plan)
 {
+    // For plan.scatter, number of tiles seen so far for each set of ranks.
+    std::map< std::set<int>, int64_t > set_counts;
+
     for (auto reduce : reduce_list) {
 
         auto i = std::get<0>(reduce);
@@ -2114,13 +2194,26 @@ void BaseMatrix<scalar_t>::listReduce(ReduceList& reduce_list, Layout layout, in
         for (auto submatrix : submatrices_list) // Insert sources.
             submatrix.getRanks(&reduce_set);
 
+        // Rotate the tree root over tiles reduced over the same ranks.
+        // All ranks count every tile, so they agree on the root.
+        int tree_root = root_rank;
+        if (plan.scatter && ! reduce_set.empty()) {
+            std::set<int> ranks = reduce_set;
+            ranks.insert(root_rank);
+            int64_t count = set_counts[ ranks ]++;
+            auto iter = ranks.begin();
+            std::advance(iter, count % ranks.size());
+            tree_root = *iter;
+        }
+
         // If this rank is in the set.
         if (root_rank == mpi_rank_
             || reduce_set.find(mpi_rank_) != reduce_set.end()) {
 
             // Reduce across MPI ranks.
-            // Uses 2D hypercube p2p send.
-            tileReduceFromSet(i, j, root_rank, reduce_set, 2, tag, layout);
+            // Uses hypercube p2p send, optionally node-aware.
+            tileReduceFromSet(i, j, root_rank, reduce_set, tag, layout,
+                              plan, tree_root);
 
             // If not the tile owner.
             if (! tileIsLocal(i, j)) {
@@ -2324,6 +2417,12 @@ void BaseMatrix<scalar_t>::tileIbcastToSet(
         device = tileDevice( i, j );
     }
 
+    if (storage_->nodeMemory() != nullptr && device == HostNum) {
+        tileIbcastToSetNode(i, j, bcast_set, radix, tag, layout,
+                            send_requests);
+        return;
+    }
+
     // Receive.
     if (! recv_from.empty()) {
         // read tile
@@ -2348,6 +2447,256 @@ void BaseMatrix<scalar_t>::tileIbcastToSet(
     }
 }
 
+//------------------------------------------------------------------------------
+/// Exposes the local tiles of the matrix through an MPI window, so other
+/// ranks can get them with tileFetch without the owner's participation.
+/// First makes the host instance of each local tile current.
+/// Collective over the matrix's MPI communicator.
+///
+/// The window exposes memory, not values: owners must not erase, reallocate,
+/// or convert the layout of local tiles while the window exists, and must
+/// synchronize with fetching ranks (e.g., MPI_Barrier) after updating tiles
+/// on the host. Tiles updated on devices must be brought to the host first.
+/// WARNING: this applies to the entire parent matrix,
+/// not just a sub-matrix.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::createTileWindow()
+{
+    for (int64_t j = 0; j < nt(); ++j) {
+        for (int64_t i = 0; i < mt(); ++i) {
+            if (tileIsLocal(i, j) && tileExists(i, j, AnyDevice))
+                tileGetForReading(i, j, HostNum, LayoutConvert::None);
+        }
+    }
+    storage_->createTileWindow(mpi_comm_);
+}
+
+//------------------------------------------------------------------------------
+/// Fetches tiles in tile_set to the host, getting remote tiles with
+/// one-sided MPI gets from the window created by createTileWindow.
+/// Owners do not participate, so this is not collective.
+/// Gets are issued for all tiles, then completed together.
+///
+/// Fetched tiles are workspace tiles, like received tiles, and act as a
+/// cache: a remote tile with a valid instance on this rank (host or device)
+/// is not fetched again until it is released, e.g., by tileRelease or
+/// releaseRemoteWorkspace.
+///
+/// @param[in] tile_set
+///     Set of (i, j) tuples indicating indices of tiles to fetch.
+///
+/// @param[in] layout
+///     Indicates whether to convert the Layout of the fetched data:
+///     - ColMajor: convert layout to column major.
+///     - RowMajor: convert layout to row major.
+///     - None: keep the owner's layout.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileFetch(
+    std::set<ij_tuple>& tile_set, LayoutConvert layout)
+{
+    TileWindow* window = storage_->tileWindow();
+    slate_assert(window != nullptr);
+
+    std::set<int> src_ranks;
+    std::vector<ij_tuple> fetched;
+    for (auto ij : tile_set) {
+        int64_t i = std::get<0>(ij);
+        int64_t j = std::get<1>(ij);
+        if (tileIsLocal(i, j))
+            continue;
+
+        bool cached = false;
+        for (int device = HostNum; device < num_devices() && ! cached; ++device) {
+            cached = tileExists(i, j, device)
+                     && tileState(i, j, device) != MOSI::Invalid;
+        }
+        if (cached)
+            continue;
+
+        if (tileMb(i) == 0 || tileNb(j) == 0) {
+            tileAcquire(i, j, HostNum, layout_);
+        }
+        else {
+            auto const& entry = window->at(globalIndex(i, j));
+            tileAcquire(i, j, HostNum, entry.layout);
+
+            // Get into the stored tile, not transposed by op.
+            Tile<scalar_t>* tile = storage_->at(globalIndex(i, j, HostNum));
+            tile->get(entry.rank, entry.address, entry.stride, window->win());
+            src_ranks.insert(entry.rank);
+        }
+        fetched.push_back(ij);
+    }
+
+    for (int rank : src_ranks)
+        window->flush(rank);
+
+    for (auto ij : fetched)
+        tileModified(std::get<0>(ij), std::get<1>(ij), HostNum, true);
+
+    // Convert layout, and make cached and local tiles current on host.
+    tileGetForReading(tile_set, HostNum, layout);
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Broadcast tile {i, j} on the host to all MPI ranks in the bcast_set,
+/// sharing one copy of the tile among ranks on the same node.
+/// Used by tileIbcastToSet when a node workspace is reserved;
+/// @see reserveNodeWorkspace.
+///
+/// On each node, one rank is the leader: the root on its node, otherwise
+/// the lowest rank in bcast_set. Leaders exchange the tile in a hypercube
+/// pattern, as tileIbcastToSet does over all ranks. Each leader puts the
+/// tile in a block of node memory and sends the block index to the other
+/// ranks on its node, which point their tile at the block.
+/// If node memory is full, the leader sends index -1 and then the tile.
+///
+/// @param[in] i
+///     Tile's block row index. 0 <= i < mt.
+///
+/// @param[in] j
+///     Tile's block column index. 0 <= j < nt.
+///
+/// @param[in] bcast_set
+///     Set of MPI ranks to broadcast to.
+///
+/// @param[in] radix
+///     Radix of the communication pattern among leaders.
+///
+/// @param[in] tag
+///     MPI tag.
+///
+/// @param[in] layout
+///     Indicates the Layout (ColMajor/RowMajor) of the received data.
+///
+/// @param[in,out] send_requests
+///     Vector where requests for this bcast are appended.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileIbcastToSetNode(
+    int64_t i, int64_t j, std::set<int> const& bcast_set,
+    int radix, int tag, Layout layout,
+    std::vector<MPI_Request>& send_requests)
+{
+    NodeMemory& node_memory = *storage_->nodeMemory();
+    int root_rank = tileRank(i, j);
+    int my_node = node_memory.nodeId(mpi_rank_);
+
+    // Leader of each node; bcast_set is sorted, so the lowest rank wins.
+    std::map<int, int> leaders;
+    leaders[ node_memory.nodeId(root_rank) ] = root_rank;
+    for (int rank : bcast_set)
+        leaders.emplace(node_memory.nodeId(rank), rank);
+    int leader = leaders[ my_node ];
+
+    // Non-leader ranks on this node.
+    std::vector<int> members;
+    for (int rank : bcast_set) {
+        if (rank != leader && node_memory.nodeId(rank) == my_node)
+            members.push_back(rank);
+    }
+
+    if (mpi_rank_ != leader) {
+        // Receive the block index, then the tile if not in node memory.
+        int64_t block;
+        slate_mpi_call(
+            MPI_Recv(&block, 1, MPI_INT64_T, leader, tag, mpi_comm_,
+                     MPI_STATUS_IGNORE));
+        if (block >= 0) {
+            node_memory.sync();
+            storage_->tileAttachNode(
+                globalIndex(i, j),
+                (scalar_t*) node_memory.data(leader, block), layout);
+        }
+        else {
+            tileAcquire(i, j, HostNum, layout);
+            at(i, j).recv(leader, mpi_comm_, layout, tag);
+        }
+        tileLayout(i, j, HostNum, layout);
+        tileModified(i, j, HostNum, true);
+        return;
+    }
+
+    // Leaders, rotated to start at root_rank.
+    std::vector<int> leader_vec;
+    for (auto& node_leader : leaders)
+        leader_vec.push_back(node_leader.second);
+    std::sort(leader_vec.begin(), leader_vec.end());
+    auto root_iter = std::find(leader_vec.begin(), leader_vec.end(),
+                               root_rank);
+    std::vector<int> new_vec(root_iter, leader_vec.end());
+    new_vec.insert(new_vec.end(), leader_vec.begin(), root_iter);
+    auto rank_iter = std::find(new_vec.begin(), new_vec.end(), mpi_rank_);
+    int new_rank = std::distance(new_vec.begin(), rank_iter);
+
+    std::list<int> recv_from;
+    std::list<int> send_to;
+    internal::cubeBcastPattern(new_vec.size(), new_rank, radix,
+                               recv_from, send_to);
+
+    // Block for members; a receiving leader also uses it for its own tile.
+    int64_t block = -1;
+    if (! members.empty()) {
+        int64_t count = members.size() + (recv_from.empty() ? 0 : 1);
+        block = node_memory.alloc(count);
+    }
+    scalar_t* block_data = block >= 0
+        ? (scalar_t*) node_memory.data(mpi_rank_, block) : nullptr;
+
+    if (! recv_from.empty()) {
+        // Receive from another node.
+        if (block >= 0)
+            storage_->tileAttachNode(globalIndex(i, j), block_data, layout);
+        else
+            tileAcquire(i, j, HostNum, layout);
+        at(i, j).recv(new_vec[recv_from.front()], mpi_comm_, layout, tag);
+        tileLayout(i, j, HostNum, layout);
+        tileModified(i, j, HostNum, true);
+    }
+    else {
+        // Root copies its tile to node memory.
+        tileGetForReading(i, j, HostNum, LayoutConvert(layout));
+        if (block >= 0) {
+            // Stored tile, not transposed by op.
+            Tile<scalar_t>* tile = storage_->at( globalIndex(i, j, HostNum) );
+            int64_t mb = tile->mb();
+            int64_t nb = tile->nb();
+            bool col_major = layout == Layout::ColMajor;
+            lapack::lacpy(lapack::MatrixType::General,
+                          col_major ? mb : nb, col_major ? nb : mb,
+                          tile->data(), tile->stride(),
+                          block_data, col_major ? mb : nb);
+        }
+    }
+
+    auto Aij = at(i, j);
+
+    // Notify members; send the tile itself if node memory is full.
+    if (! members.empty())
+        node_memory.sync();
+    for (int member : members) {
+        MPI_Request request;
+        slate_mpi_call(
+            MPI_Isend(node_memory.blockIndex(block), 1, MPI_INT64_T,
+                      member, tag, mpi_comm_, &request));
+        send_requests.push_back(request);
+        if (block < 0) {
+            Aij.isend(member, mpi_comm_, tag, &request);
+            send_requests.push_back(request);
+        }
+    }
+
+    // Forward to other nodes.
+    for (int dst : send_to) {
+        MPI_Request request;
+        Aij.isend(new_vec[dst], mpi_comm_, tag, &request);
+        send_requests.push_back(request);
+    }
+}
+
 //------------------------------------------------------------------------------
 /// [internal]
 /// WARNING: Sent and Recevied tiles are converted to 'layout' major.
@@ -2356,6 +2705,27 @@ template <typename scalar_t>
 void BaseMatrix<scalar_t>::tileReduceFromSet(
     int64_t i, int64_t j, int root_rank, std::set<int>& reduce_set,
     int radix, int tag, Layout layout)
+{
+    internal::ReducePlan plan;
+    plan.radix = radix;
+    tileReduceFromSet(i, j, root_rank, reduce_set, tag, layout,
+                      plan, root_rank);
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Reduces tile {i, j} over the ranks in reduce_set to root_rank.
+/// The reduction tree is rooted at tree_root; if that is not root_rank,
+/// tree_root then sends the sum to root_rank, which overwrites its tile.
+/// With plan.segment_size > 0, tiles are sent as segments of whole columns
+/// (ColMajor) or rows (RowMajor), so a rank forwards each segment as soon
+/// as it has accumulated it.
+/// WARNING: Sent and Recevied tiles are converted to 'layout' major.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileReduceFromSet(
+    int64_t i, int64_t j, int root_rank, std::set<int>& reduce_set,
+    int tag, Layout layout, internal::ReducePlan const& plan, int tree_root)
 {
     const scalar_t one = 1.0;
 
@@ -2365,51 +2735,81 @@ void BaseMatrix<scalar_t>::tileReduceFromSet(
 
     reduce_set.insert(root_rank);
 
-    // Convert the set to a vector.
-    std::vector<int> reduce_vec(reduce_set.begin(), reduce_set.end());
-
-    // Sort the ranks.
-    std::sort(reduce_vec.begin(), reduce_vec.end());
-
-    // Find root.
-    auto root_iter = std::find(reduce_vec.begin(), reduce_vec.end(), root_rank);
-
-    // Shift root to position zero.
-    std::vector<int> new_vec(root_iter, reduce_vec.end());
-    new_vec.insert(new_vec.end(), reduce_vec.begin(), root_iter);
-
-    // Find the new rank.
-    auto rank_iter = std::find(new_vec.begin(), new_vec.end(), mpi_rank_);
-    int new_rank = std::distance(new_vec.begin(), rank_iter);
-
     // Get the send/recv pattern.
-    std::list<int> recv_from;
-    std::list<int> send_to;
-    internal::cubeReducePattern(new_vec.size(), new_rank, radix,
-                                recv_from, send_to);
-
-    if (! (send_to.empty() && recv_from.empty())) {
-        // read tile on host memory
-        tileGetForReading(i, j, LayoutConvert(layout));
+    std::vector<int> recv_from;
+    int send_to;
+    internal::reducePattern(reduce_set, tree_root, mpi_rank_, plan,
+                            recv_from, send_to);
+
+    // The tree root forwards the sum to the owner.
+    bool gather = tree_root != root_rank;
+    bool recv_sum = gather && mpi_rank_ == root_rank;
+    if (gather && mpi_rank_ == tree_root)
+        send_to = root_rank;
+
+    if (recv_from.empty() && send_to < 0 && ! recv_sum)
+        return;
 
-        auto Aij = at(i, j);
+    // read tile on host memory
+    tileGetForReading(i, j, LayoutConvert(layout));
+    if (! recv_from.empty() || recv_sum)
+        tileGetForWriting(i, j, LayoutConvert(layout));
+
+    auto Aij = at(i, j);
+
+    // Split tile into segments, viewing Aij's data.
+    std::vector< Tile<scalar_t> > segments;
+    int64_t mb = Aij.mb();
+    int64_t nb = Aij.nb();
+    if (plan.segment_size > 0 && Aij.op() == Op::NoTrans
+        && mb * nb > plan.segment_size) {
+        bool col_major = Aij.layout() == Layout::ColMajor;
+        int64_t lines = col_major ? nb : mb;
+        int64_t line_size = col_major ? mb : nb;
+        int64_t step = std::max(int64_t(1), plan.segment_size / line_size);
+        for (int64_t k = 0; k < lines; k += step) {
+            int64_t kb = std::min(step, lines - k);
+            segments.push_back(Tile<scalar_t>(
+                col_major ? mb : kb, col_major ? kb : nb,
+                &Aij.data()[ k*Aij.stride() ], Aij.stride(),
+                HostNum, TileKind::Workspace, Aij.layout()));
+        }
+    }
+    else {
+        segments.push_back(Aij);
+    }
 
-        std::vector<scalar_t> data(Aij.mb() * Aij.nb());
-        int64_t lda = (Aij.op() == Op::NoTrans ? Aij.mb() : Aij.nb());
-        Tile<scalar_t> tile(Aij, &data[0], lda, TileKind::Workspace);
+    std::vector<scalar_t> data(mb * nb);
+    std::vector<MPI_Request> send_requests;
+    for (auto& segment : segments) {
+        int64_t lda = (segment.layout() == Layout::ColMajor)
+                      == (segment.op() == Op::NoTrans)
+                    ? segment.mb() : segment.nb();
+        Tile<scalar_t> tile(segment, &data[0], lda, TileKind::Workspace);
 
         // Receive, accumulate.
         for (int src : recv_from) {
-            // Receive.
-            tile.recv(new_vec[src], mpi_comm_, layout, tag);
-            tileGetForWriting(i, j, LayoutConvert(layout));
-            // Accumulate.
-            tile::add( one, tile, Aij );
+            tile.recv(src, mpi_comm_, layout, tag);
+            tile::add( one, tile, segment );
         }
 
         // Forward.
-        if (! send_to.empty())
-            Aij.send(new_vec[send_to.front()], mpi_comm_, tag);
+        if (send_to >= 0) {
+            MPI_Request request;
+            segment.isend(send_to, mpi_comm_, tag, &request);
+            send_requests.push_back(request);
+        }
+    }
+    if (! send_requests.empty()) {
+        slate_mpi_call(
+            MPI_Waitall(int(send_requests.size()), send_requests.data(),
+                        MPI_STATUSES_IGNORE));
+    }
+
+    // Owner receives the sum, after its own partial sum was sent.
+    if (recv_sum) {
+        for (auto& segment : segments)
+            segment.recv(tree_root, mpi_comm_, layout, tag);
     }
 }
 
@@ -2548,6 +2948,10 @@ template <typename scalar_t>
 void BaseMatrix<scalar_t>::tileAcquire(int64_t i, int64_t j, int device,
                                        Layout layout)
 {
+    // Data will be overwritten, so don't overwrite a node-shared copy.
+    if (device == HostNum)
+        storage_->tileDetachNode( globalIndex(i, j) );
+
     auto tile = storage_->tileInsert( globalIndex(i, j, device),
                                       TileKind::Workspace, layout );
 
@@ -2667,6 +3071,8 @@ void BaseMatrix<scalar_t>::tileGet(int64_t i, int64_t j, int dst_device,
             src_tile->state(MOSI::Shared);
     }
     if (modify) {
+        if (dst_device == HostNum)
+            storage_->tileDetachNode( globalIndex(i, j) );
         tileModified(i, j, dst_device);
     }
     if (hold) {
@@ -3295,8 +3701,12 @@ void BaseMatrix<scalar_t>::tileLayoutConvert(
 {
     auto& tile_node = storage_->at( globalIndex(i, j) );
     LockGuard guard( tile_node.getLock() );
-    auto tile = tile_node[ HostNum ];
+    auto tile = tile_node[ device ];
     if (tile->layout() != layout) {
+        // Convert a private copy, not one shared within the node.
+        if (device == HostNum)
+            storage_->tileDetachNode( globalIndex(i, j) );
+
         if (! tile->isTransposable()) {
             assert(! reset); // cannot reset if not transposable
             storage_->tileMakeTransposable(tile);
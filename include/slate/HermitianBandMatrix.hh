@@ -40,6 +40,12 @@ public:
     HermitianBandMatrix(Uplo uplo, BandMatrix<scalar_t>& orig);
     HermitianBandMatrix(int64_t kd, HermitianMatrix<scalar_t>& orig);
 
+    static
+    HermitianBandMatrix fromLAPACKBand(
+        Uplo uplo, int64_t n, int64_t kd,
+        scalar_t const* ab, int64_t ldab,
+        int64_t nb, int p, int q, MPI_Comm mpi_comm);
+
     // on-diagonal sub-matrix
     HermitianMatrix<scalar_t> sub(int64_t i1, int64_t i2);
     HermitianMatrix<scalar_t> slice(int64_t index1, int64_t index2);
@@ -141,6 +147,85 @@ HermitianBandMatrix<scalar_t>::HermitianBandMatrix(
     : BaseTriangularBandMatrix<scalar_t>(kd, orig)
 {}
 
+//------------------------------------------------------------------------------
+/// Named constructor returns a new n-by-n Hermitian band matrix, with local
+/// tiles inside the band allocated and copied from a matrix in LAPACK
+/// Hermitian band storage, as used by hbmv, pbtrf, and pbsv.
+/// Entries outside the stored triangle of the band are set to zero.
+/// Each rank reads only the columns of ab for its local tiles, so ab needs
+/// to be valid only in those columns.
+///
+/// @param[in] uplo
+///     - Upper: upper triangle of A is stored.
+///     - Lower: lower triangle of A is stored.
+///
+/// @param[in] n
+///     Number of rows and columns of the matrix. n >= 0.
+///
+/// @param[in] kd
+///     Number of sub (if lower) or super (if upper) diagonals within band.
+///     kd >= 0.
+///
+/// @param[in] ab
+///     The ldab-by-n band matrix in LAPACK band storage:
+///     if upper, $A_{i, j}$ is stored in ab[ kd + i - j + j*ldab ]
+///     for $\max(0, j - kd) \le i \le j$;
+///     if lower, $A_{i, j}$ is stored in ab[ i - j + j*ldab ]
+///     for $j \le i \le \min(n-1, j + kd)$.
+///
+/// @param[in] ldab
+///     Leading dimension of ab. ldab >= kd + 1.
+///
+/// @param[in] nb
+///     Block size in 2D block-cyclic distribution. nb > 0.
+///
+/// @param[in] p
+///     Number of block rows in 2D block-cyclic distribution. p > 0.
+///
+/// @param[in] q
+///     Number of block columns of 2D block-cyclic distribution. q > 0.
+///
+/// @param[in] mpi_comm
+///     MPI communicator to distribute matrix across.
+///     p*q == MPI_Comm_size(mpi_comm).
+///
+template <typename scalar_t>
+HermitianBandMatrix<scalar_t> HermitianBandMatrix<scalar_t>::fromLAPACKBand(
+    Uplo uplo, int64_t n, int64_t kd,
+    scalar_t const* ab, int64_t ldab,
+    int64_t nb, int p, int q, MPI_Comm mpi_comm)
+{
+    slate_assert( ldab >= kd + 1 );
+
+    HermitianBandMatrix<scalar_t> A( uplo, n, kd, nb, p, q, mpi_comm );
+    A.insertLocalTiles();
+
+    bool upper = (uplo == Uplo::Upper);
+    int64_t kdt = ceildiv( kd, nb );
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        int64_t istart = upper ? blas::max( 0, j-kdt ) : j;
+        int64_t iend   = upper ? j : blas::min( j+kdt, A.mt()-1 );
+        for (int64_t i = istart; i <= iend; ++i) {
+            if (A.tileIsLocal( i, j )) {
+                auto T = A( i, j );
+                for (int64_t tj = 0; tj < T.nb(); ++tj) {
+                    int64_t jj = j*nb + tj;
+                    for (int64_t ti = 0; ti < T.mb(); ++ti) {
+                        int64_t ii = i*nb + ti;
+                        if (upper && jj - kd <= ii && ii <= jj)
+                            T.at( ti, tj ) = ab[ kd + ii - jj + jj*ldab ];
+                        else if (! upper && jj <= ii && ii <= jj + kd)
+                            T.at( ti, tj ) = ab[ ii - jj + jj*ldab ];
+                        else
+                            T.at( ti, tj ) = 0;
+                    }
+                }
+            }
+        }
+    }
+    return A;
+}
+
 //------------------------------------------------------------------------------
 /// Returns sub-matrix that is a shallow copy view of the
 /// parent matrix, A[ i1:i2, i1:i2 ].
@@ -6,6 +6,7 @@
 #ifndef SLATE_TILE_HH
 #define SLATE_TILE_HH
 
+#include "slate/internal/DryRun.hh"
 #include "slate/internal/Memory.hh"
 #include "slate/internal/Trace.hh"
 #include "slate/internal/device.hh"
@@ -155,6 +156,7 @@ public:
     void isend(int dst, MPI_Comm mpi_comm, int tag, MPI_Request *req); // const;
     void recv(int src, MPI_Comm mpi_comm, Layout layout, int tag = 0);
     void bcast(int bcast_root, MPI_Comm mpi_comm);
+    void get(int src, MPI_Aint src_address, int64_t src_stride, MPI_Win win);
 
     /// Returns shallow copy of tile that is transposed.
     template <typename TileType>
@@ -1076,6 +1078,11 @@ void Tile<scalar_t>::send(int dst, MPI_Comm mpi_comm, int tag) const
 {
     trace::Block trace_block("MPI_Send");
 
+    if (DryRun::enabled()) {
+        DryRun::send( mb_*nb_*sizeof(scalar_t) );
+        return;
+    }
+
     // If no stride.
     if (this->isContiguous()) {
         // Use simple send.
@@ -1119,6 +1126,12 @@ void Tile<scalar_t>::isend(int dst, MPI_Comm mpi_comm, int tag, MPI_Request *req
 {
     trace::Block trace_block("MPI_Isend");
 
+    if (DryRun::enabled()) {
+        DryRun::send( mb_*nb_*sizeof(scalar_t) );
+        *req = MPI_REQUEST_NULL;
+        return;
+    }
+
     // If no stride.
     if (this->isContiguous()) {
         // Use simple send.
@@ -1167,6 +1180,12 @@ void Tile<scalar_t>::recv(int src, MPI_Comm mpi_comm, Layout layout, int tag)
 {
     trace::Block trace_block("MPI_Recv");
 
+    if (DryRun::enabled()) {
+        DryRun::recv( mb_*nb_*sizeof(scalar_t) );
+        this->layout(layout);
+        return;
+    }
+
     // If no stride.
     if (this->isContiguous()) {
         // Use simple recv.
@@ -1235,6 +1254,18 @@ void Tile<scalar_t>::bcast(int bcast_root, MPI_Comm mpi_comm)
     {
         // Otherwise, use strided bcast.
         trace::Block trace_block("MPI_Bcast");
+
+        if (DryRun::enabled()) {
+            int mpi_rank;
+            slate_mpi_call(
+                MPI_Comm_rank(mpi_comm, &mpi_rank));
+            if (mpi_rank == bcast_root)
+                DryRun::send( mb_*nb_*sizeof(scalar_t) );
+            else
+                DryRun::recv( mb_*nb_*sizeof(scalar_t) );
+            return;
+        }
+
         // todo: layout
         int count = layout_ == Layout::ColMajor ? nb_ : mb_;
         int blocklength = layout_ == Layout::ColMajor ? mb_ : nb_;
@@ -1269,6 +1300,70 @@ void Tile<scalar_t>::bcast(int bcast_root, MPI_Comm mpi_comm)
     }
 }
 
+//------------------------------------------------------------------------------
+/// Gets tile data from MPI rank src through an RMA window, without
+/// src's participation. The source tile must have the same size and layout
+/// as this tile. The get completes when the window is flushed for src.
+///
+/// @param[in] src
+///     Source MPI rank in the window's communicator.
+///
+/// @param[in] src_address
+///     Address of the source tile's data on src, from MPI_Get_address,
+///     for a dynamic window.
+///
+/// @param[in] src_stride
+///     Stride of the source tile.
+///
+/// @param[in] win
+///     MPI window, in a passive-target epoch, with the source data attached.
+///
+template <typename scalar_t>
+void Tile<scalar_t>::get(
+    int src, MPI_Aint src_address, int64_t src_stride, MPI_Win win)
+{
+    trace::Block trace_block("MPI_Get");
+
+    if (DryRun::enabled()) {
+        DryRun::recv( mb_*nb_*sizeof(scalar_t) );
+        return;
+    }
+
+    int count = layout_ == Layout::ColMajor ? nb_ : mb_;
+    int blocklength = layout_ == Layout::ColMajor ? mb_ : nb_;
+
+    // Use vector types for strided tiles.
+    MPI_Datatype origin_type = mpi_type<scalar_t>::value;
+    MPI_Datatype target_type = mpi_type<scalar_t>::value;
+    int origin_count = count*blocklength;
+    int target_count = count*blocklength;
+    bool origin_strided = stride_ != blocklength;
+    bool target_strided = src_stride != blocklength;
+    if (origin_strided) {
+        slate_mpi_call(
+            MPI_Type_vector(count, blocklength, stride_,
+                            mpi_type<scalar_t>::value, &origin_type));
+        slate_mpi_call(MPI_Type_commit(&origin_type));
+        origin_count = 1;
+    }
+    if (target_strided) {
+        slate_mpi_call(
+            MPI_Type_vector(count, blocklength, src_stride,
+                            mpi_type<scalar_t>::value, &target_type));
+        slate_mpi_call(MPI_Type_commit(&target_type));
+        target_count = 1;
+    }
+
+    slate_mpi_call(
+        MPI_Get(data_, origin_count, origin_type, src, src_address,
+                target_count, target_type, win));
+
+    if (origin_strided)
+        slate_mpi_call(MPI_Type_free(&origin_type));
+    if (target_strided)
+        slate_mpi_call(MPI_Type_free(&target_type));
+}
+
 //------------------------------------------------------------------------------
 /// Set tile data to constants.
 ///
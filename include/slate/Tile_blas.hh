@@ -7,6 +7,7 @@
 #define SLATE_TILE_BLAS_HH
 
 #include <blas.hh>
+#include <blas/flops.hh>
 
 #include "slate/Tile.hh"
 #include "slate/internal/util.hh"
@@ -34,6 +35,11 @@ void gemm(
 {
     trace::Block trace_block("blas::gemm");
 
+    if (DryRun::enabled()) {
+        DryRun::flops( blas::Gflop<scalar_t>::gemm( C.mb(), C.nb(), A.nb() ) );
+        return;
+    }
+
     using blas::conj;
 
     slate_assert(A.uploPhysical() == Uplo::General);
@@ -213,6 +219,11 @@ void hemm(
 {
     trace::Block trace_block("blas::hemm");
 
+    if (DryRun::enabled()) {
+        DryRun::flops( blas::Gflop<scalar_t>::hemm( side, C.mb(), C.nb() ) );
+        return;
+    }
+
     using blas::conj;
 
     assert(A.mb() == A.nb());  // square
@@ -276,6 +287,11 @@ void herk(
 {
     trace::Block trace_block("blas::herk");
 
+    if (DryRun::enabled()) {
+        DryRun::flops( blas::Gflop<scalar_t>::herk( C.nb(), A.nb() ) );
+        return;
+    }
+
     assert(A.uploPhysical() == Uplo::General);
     assert(C.mb() == C.nb());  // square
     assert(C.mb() == A.mb());  // n
@@ -317,6 +333,11 @@ void her2k(
 {
     trace::Block trace_block("blas::her2k");
 
+    if (DryRun::enabled()) {
+        DryRun::flops( blas::Gflop<scalar_t>::her2k( C.nb(), A.nb() ) );
+        return;
+    }
+
     using blas::conj;
 
     assert(A.op() == B.op());
@@ -397,6 +418,11 @@ void symm(
 {
     trace::Block trace_block("blas::symm");
 
+    if (DryRun::enabled()) {
+        DryRun::flops( blas::Gflop<scalar_t>::symm( side, C.mb(), C.nb() ) );
+        return;
+    }
+
     using blas::conj;
 
     assert(A.mb() == A.nb());  // square
@@ -526,6 +552,11 @@ void syrk(
 {
     trace::Block trace_block("blas::syrk");
 
+    if (DryRun::enabled()) {
+        DryRun::flops( blas::Gflop<scalar_t>::syrk( C.nb(), A.nb() ) );
+        return;
+    }
+
     using blas::conj;
 
     assert(A.uploPhysical() == Uplo::General);
@@ -569,6 +600,11 @@ void syr2k(
 {
     trace::Block trace_block("blas::syr2k");
 
+    if (DryRun::enabled()) {
+        DryRun::flops( blas::Gflop<scalar_t>::syr2k( C.nb(), A.nb() ) );
+        return;
+    }
+
     using blas::conj;
 
     assert(A.op() == B.op());
@@ -616,6 +652,11 @@ void trmm(
 {
     trace::Block trace_block("blas::trmm");
 
+    if (DryRun::enabled()) {
+        DryRun::flops( blas::Gflop<scalar_t>::trmm( side, B.mb(), B.nb() ) );
+        return;
+    }
+
     using blas::conj;
 
     assert(B.uploPhysical() == Uplo::General);
@@ -686,14 +727,20 @@ void trsm(
 {
     trace::Block trace_block("blas::trsm");
 
+    if (DryRun::enabled()) {
+        DryRun::flops( blas::Gflop<scalar_t>::trsm( side, B.mb(), B.nb() ) );
+        return;
+    }
+
     using blas::conj;
 
     assert(B.uploPhysical() == Uplo::General);
     assert(A.mb() == A.nb());  // square
     assert(side == Side::Left ? A.mb() == B.mb()    // m
                               : A.mb() == B.nb());  // n
+    assert(A.layout() == B.layout());
     if (B.op() == Op::NoTrans) {
-        blas::trsm(blas::Layout::ColMajor,
+        blas::trsm(B.layout(),
                    side, A.uploPhysical(), A.op(), diag,
                    B.mb(), B.nb(),
                    alpha, A.data(), A.stride(),
@@ -719,7 +766,7 @@ void trsm(
         if (B.op() == Op::ConjTrans)
             alpha = conj(alpha);
 
-        blas::trsm(blas::Layout::ColMajor,
+        blas::trsm(B.layout(),
                    side2, A.uploPhysical(), opA, diag,
                    B.nb(), B.mb(),
                    alpha, A.data(), A.stride(),
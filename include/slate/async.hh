@@ -0,0 +1,221 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+//------------------------------------------------------------------------------
+/// @file
+///
+#ifndef SLATE_ASYNC_HH
+#define SLATE_ASYNC_HH
+
+#include <functional>
+#include <future>
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Asynchronous drivers.
+///
+/// Each call enqueues the driver on a per-process worker thread and returns
+/// immediately with a Future. Routines run one after another in the order
+/// they were enqueued, so a chain such as
+///
+///     auto f1 = slate::async::potrf( A );
+///     auto f2 = slate::async::potrs( A, B );
+///     auto f3 = slate::async::multiply( alpha, C, B, beta, D );
+///     f3.get();
+///
+/// is correct without intermediate waits, and the caller is free to do other
+/// work while it runs. Since routines are collective, every rank must enqueue
+/// the same routines in the same order, as for the synchronous drivers.
+/// Routines make MPI calls from the worker thread, which is not the thread
+/// that initialized MPI, so MPI must be initialized with MPI_THREAD_MULTIPLE;
+/// enqueue throws an Exception otherwise.
+///
+/// Each routine opens its own OpenMP parallel region on the worker thread,
+/// with the default number of threads. If the caller also runs an OpenMP
+/// region meanwhile, the two teams oversubscribe the cores; use
+/// set_num_threads() to split the cores between them.
+///
+/// Matrices are shallow copies, so they may go out of scope in the caller;
+/// their data and any pivots must remain valid until the Future is ready.
+/// Exceptions from a routine are rethrown by Future::get().
+///
+/// Routines are not pipelined: each driver runs to completion before the
+/// next starts, as there are no tile-level dependencies between routines,
+/// so the tail of one routine does not overlap the head of the next.
+/// The only overlap is with the caller's own work.
+///
+/// Call wait_all() before MPI_Finalize, since queued routines make MPI calls.
+///
+namespace async {
+
+/// Handle to an enqueued routine; ready when the routine finishes.
+using Future = std::shared_future<void>;
+
+Future enqueue( std::function<void ()> routine );
+
+void wait_all();
+
+void set_num_threads( int num_threads );
+
+//------------------------------------------------------------------------------
+/// @return Future that is ready when all previously enqueued routines
+/// have finished.
+inline Future barrier()
+{
+    return enqueue( [] {} );
+}
+
+//-----------------------------------------
+// multiply()
+template <typename scalar_t>
+Future multiply(
+    scalar_t alpha, Matrix<scalar_t>& A,
+                    Matrix<scalar_t>& B,
+    scalar_t beta,  Matrix<scalar_t>& C,
+    Options const& opts = Options())
+{
+    return enqueue( [alpha, A, B, beta, C, opts]() mutable {
+        slate::gemm( alpha, A, B, beta, C, opts );
+    } );
+}
+
+//-----------------------------------------
+// chol_factor()
+template <typename scalar_t>
+Future chol_factor(
+    HermitianMatrix<scalar_t>& A,
+    Options const& opts = Options())
+{
+    return enqueue( [A, opts]() mutable {
+        slate::potrf( A, opts );
+    } );
+}
+
+template <typename scalar_t>
+Future potrf(
+    HermitianMatrix<scalar_t>& A,
+    Options const& opts = Options())
+{
+    return chol_factor( A, opts );
+}
+
+//-----------------------------------------
+// chol_solve_using_factor()
+template <typename scalar_t>
+Future chol_solve_using_factor(
+    HermitianMatrix<scalar_t>& A,
+             Matrix<scalar_t>& B,
+    Options const& opts = Options())
+{
+    return enqueue( [A, B, opts]() mutable {
+        slate::potrs( A, B, opts );
+    } );
+}
+
+template <typename scalar_t>
+Future potrs(
+    HermitianMatrix<scalar_t>& A,
+             Matrix<scalar_t>& B,
+    Options const& opts = Options())
+{
+    return chol_solve_using_factor( A, B, opts );
+}
+
+//-----------------------------------------
+// chol_solve()
+template <typename scalar_t>
+Future chol_solve(
+    HermitianMatrix<scalar_t>& A,
+             Matrix<scalar_t>& B,
+    Options const& opts = Options())
+{
+    return enqueue( [A, B, opts]() mutable {
+        slate::posv( A, B, opts );
+    } );
+}
+
+template <typename scalar_t>
+Future posv(
+    HermitianMatrix<scalar_t>& A,
+             Matrix<scalar_t>& B,
+    Options const& opts = Options())
+{
+    return chol_solve( A, B, opts );
+}
+
+//-----------------------------------------
+// lu_factor()
+// pivots must remain valid until the Future is ready.
+template <typename scalar_t>
+Future lu_factor(
+    Matrix<scalar_t>& A, Pivots& pivots,
+    Options const& opts = Options())
+{
+    Pivots* pivots_ptr = &pivots;
+    return enqueue( [A, pivots_ptr, opts]() mutable {
+        slate::getrf( A, *pivots_ptr, opts );
+    } );
+}
+
+template <typename scalar_t>
+Future getrf(
+    Matrix<scalar_t>& A, Pivots& pivots,
+    Options const& opts = Options())
+{
+    return lu_factor( A, pivots, opts );
+}
+
+//-----------------------------------------
+// lu_solve_using_factor()
+template <typename scalar_t>
+Future lu_solve_using_factor(
+    Matrix<scalar_t>& A, Pivots& pivots,
+    Matrix<scalar_t>& B,
+    Options const& opts = Options())
+{
+    Pivots* pivots_ptr = &pivots;
+    return enqueue( [A, pivots_ptr, B, opts]() mutable {
+        slate::getrs( A, *pivots_ptr, B, opts );
+    } );
+}
+
+template <typename scalar_t>
+Future getrs(
+    Matrix<scalar_t>& A, Pivots& pivots,
+    Matrix<scalar_t>& B,
+    Options const& opts = Options())
+{
+    return lu_solve_using_factor( A, pivots, B, opts );
+}
+
+//-----------------------------------------
+// lu_solve()
+template <typename scalar_t>
+Future lu_solve(
+    Matrix<scalar_t>& A, Pivots& pivots,
+    Matrix<scalar_t>& B,
+    Options const& opts = Options())
+{
+    Pivots* pivots_ptr = &pivots;
+    return enqueue( [A, pivots_ptr, B, opts]() mutable {
+        slate::gesv( A, *pivots_ptr, B, opts );
+    } );
+}
+
+template <typename scalar_t>
+Future gesv(
+    Matrix<scalar_t>& A, Pivots& pivots,
+    Matrix<scalar_t>& B,
+    Options const& opts = Options())
+{
+    return lu_solve( A, pivots, B, opts );
+}
+
+} // namespace async
+
+} // namespace slate
+
+#endif // SLATE_ASYNC_HH
@@ -67,6 +67,21 @@ typedef enum slate_Option {
     slate_Option_MethodHemm,          ///< slate::Option::MethodHemm
     slate_Option_MethodLU,            ///< slate::Option::MethodLU
     slate_Option_MethodTrsm,          ///< slate::Option::MethodTrsm
+
+    // Appended after the methods, so existing options keep their values.
+    slate_Option_LowRankTolerance,    ///< slate::Option::LowRankTolerance
+    slate_Option_CondEstColumns,      ///< slate::Option::CondEstColumns
+    slate_Option_MethodBand,          ///< slate::Option::MethodBand
+    slate_Option_HostLayout,          ///< slate::Option::HostLayout
+    slate_Option_PivotTree,           ///< slate::Option::PivotTree
+    slate_Option_ReduceRadix,         ///< slate::Option::ReduceRadix
+    slate_Option_ReduceSegment,       ///< slate::Option::ReduceSegment
+    slate_Option_ReduceScatter,       ///< slate::Option::ReduceScatter
+    slate_Option_ReduceNodeAware,     ///< slate::Option::ReduceNodeAware
+    slate_Option_PackedGemm,          ///< slate::Option::PackedGemm
+    slate_Option_StrassenDepth,       ///< slate::Option::StrassenDepth
+    slate_Option_ComplexGemm,         ///< slate::Option::ComplexGemm
+    slate_Option_OzakiSlices,         ///< slate::Option::OzakiSlices
 } slate_Option;                       ///< slate::Option
 
 //------------------------------------------------------------------------------
@@ -34,7 +34,8 @@ enum class Target : char {
     Host      = 'H',    ///< data resides on host
     HostTask  = 'T',    ///< computation using OpenMP nested tasks on host
     HostNest  = 'N',    ///< computation using OpenMP nested parallel for loops on host
-    HostBatch = 'B',    ///< computation using batch BLAS on host (Intel MKL)
+    HostBatch = 'B',    ///< computation using batch BLAS on host (Intel MKL,
+                        ///< or portable threaded batch over any BLAS)
     Devices   = 'D',    ///< computation using batch BLAS on devices (cuBLAS)
 };
 
@@ -62,6 +63,30 @@ enum class MethodEig : char {
     DC        = 'D',    ///< Divide and conquer algorithm for finding eigenvalues
 };
 
+//------------------------------------------------------------------------------
+/// Shape of the reduction tree in tournament pivoting (CALU, getrf_tntpiv).
+/// @ingroup enum
+///
+enum class PivotTree : char {
+    Binary    = 'B',    ///< binary tree over all ranks in the panel
+    Flat      = 'F',    ///< flat tree: the diagonal rank merges every rank
+    Hybrid    = 'H',    ///< flat tree within each node, binary tree
+                        ///< across nodes
+};
+
+//------------------------------------------------------------------------------
+/// How HostTask gemm, herk, and her2k multiply complex tiles.
+/// Real4M and Real3M split tiles into real and imaginary parts and use
+/// real gemm; Real3M uses 3 real gemms instead of 4, saving 25% of the flops,
+/// but is less accurate (@see tile::gemm_split). Ignored for real types.
+/// @ingroup enum
+///
+enum class ComplexGemm : char {
+    Native    = 'N',    ///< complex gemm
+    Real4M    = '4',    ///< 4 real gemms on split parts
+    Real3M    = '3',    ///< 3 real gemms on split parts
+};
+
 //------------------------------------------------------------------------------
 /// Keys for options to pass to SLATE routines.
 /// @ingroup enum
@@ -98,6 +123,26 @@ enum class Option : char {
     MethodHemm,         ///< Select the hemm algorithm
     MethodLU,           ///< Select the LU (getrf) algorithm
     MethodTrsm,         ///< Select the trsm algorithm
+
+    // Appended after the methods, so existing options keep their values.
+    LowRankTolerance,   ///< relative accuracy for compressing low-rank tiles
+    CondEstColumns,     ///< number of columns t in block 1-norm estimator, >= 1
+    MethodBand,         ///< Select the band solver algorithm (gbsv, pbsv)
+    HostLayout,         ///< layout of host tiles in factorizations (getrf),
+                        ///< Layout::ColMajor or Layout::RowMajor
+    PivotTree,          ///< tournament tree in CALU (@see PivotTree)
+    ReduceRadix,        ///< radix of tile reduction trees (gemmA, hemmA), >= 2
+    ReduceSegment,      ///< elements per message in tile reductions,
+                        ///< 0: whole tiles
+    ReduceScatter,      ///< spread roots of tile reductions over ranks
+    ReduceNodeAware,    ///< reduce tiles within each node, then across nodes
+    PackedGemm,         ///< pack shared A and B tiles once in HostTask gemm
+                        ///< updates (Intel MKL, real precisions), default false
+    StrassenDepth,      ///< levels of recursion in Strassen gemm, default 1
+    ComplexGemm,        ///< complex tile multiply (@see ComplexGemm)
+    OzakiSlices,        ///< slices in emulated double-precision gemm,
+                        ///< 0: native gemm, default 0. An accuracy
+                        ///< emulation on sgemm, slower than dgemm on CPUs
 };
 
 //------------------------------------------------------------------------------
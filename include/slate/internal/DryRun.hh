@@ -0,0 +1,97 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef SLATE_DRY_RUN_HH
+#define SLATE_DRY_RUN_HH
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+
+#include "slate/internal/mpi.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Dry-run mode, to size a run before launching it.
+/// While on, drivers execute their usual control flow (tile inserts,
+/// broadcast plans, workspace allocation, internal kernel invocations),
+/// but tile BLAS-3 kernels and tile::potrf only count their flops, and
+/// Tile send, recv, bcast, and get and the getrf row swaps only count their
+/// messages, without computing or communicating. Host tiles are counted,
+/// not allocated: all host tiles of the same size share one scratch block,
+/// so tile data is meaningless.
+///
+/// The getrf and geqrf panels count their flops without factoring; getrf
+/// takes stand-in pivots and counts, rather than does, the pivot broadcast.
+/// heev skips the stages after he2hb, except unmtr_he2hb, and counts the
+/// flops of unmtr_hb2st; flops of hb2st and the tri-diagonal solver are
+/// not counted.
+///
+/// So potrf, getrf, gemm, and heev need no messages from other ranks, and
+/// a grid larger than the launched communicator can be sized: a matrix on
+/// a p-by-q grid with p q > MPI_Comm_size( comm ) gives, on each launched
+/// rank r, the counts of rank r of the grid. Collectives elsewhere still
+/// run among the launched ranks. Results are meaningless.
+/// Intended for Target::HostTask; device and batched kernels are not
+/// elided.
+///
+/// Usage:
+///
+///     slate::DryRun::on();
+///     slate::potrf( A );
+///     slate::DryRun::off();
+///     slate::DryRun::print( MPI_COMM_WORLD );
+///
+class DryRun {
+public:
+    /// Per-rank counters.
+    struct Counts {
+        double  gflop       = 0;
+        int64_t sends       = 0;
+        int64_t send_bytes  = 0;
+        int64_t recvs       = 0;
+        int64_t recv_bytes  = 0;
+        int64_t host_tiles  = 0;
+        int64_t host_bytes  = 0;
+        int64_t peak_tiles  = 0;
+        int64_t peak_bytes  = 0;
+    };
+
+    static void on();
+    static void off();
+
+    /// @return whether dry-run mode is on.
+    static bool enabled() { return enabled_; }
+
+    static void flops(double gflop);
+    static void send(int64_t bytes);
+    static void recv(int64_t bytes);
+    static void* hostAlloc(int64_t bytes);
+    static bool  hostFree(void* block);
+    static void task(const char* name);
+
+    /// @return this rank's counters since on().
+    static Counts const& counts() { return counts_; }
+
+    static void print(MPI_Comm comm, FILE* file=stdout);
+
+private:
+    static bool enabled_;
+    static Counts counts_;
+    static std::map<std::string, int64_t> tasks_;
+    static std::map<int64_t, void*> scratch_;
+    static std::map<void*, int64_t> scratch_bytes_;
+    static std::atomic<bool> has_scratch_;
+    static int64_t scratch_tiles_;
+
+    static void releaseScratch();
+};
+
+} // namespace slate
+
+#endif // SLATE_DRY_RUN_HH
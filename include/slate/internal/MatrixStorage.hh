@@ -7,6 +7,8 @@
 #define SLATE_STORAGE_HH
 
 #include "slate/internal/Memory.hh"
+#include "slate/internal/NodeMemory.hh"
+#include "slate/internal/TileWindow.hh"
 #include "slate/Tile.hh"
 #include "slate/types.hh"
 #include "slate/internal/util.hh"
@@ -219,6 +221,31 @@ public:
     scalar_t* allocWorkspaceBuffer(int device);
     void      releaseWorkspaceBuffer(scalar_t* data, int device);
 
+    //--------------------------------------------------------------------------
+    // node-shared workspace
+    void reserveNodeWorkspace(MPI_Comm mpi_comm, int64_t num_tiles);
+    void clearNodeWorkspace();
+
+    /// @return node-shared workspace, or nullptr if not reserved.
+    NodeMemory* nodeMemory() const
+    {
+        return node_memory_.get();
+    }
+
+    void tileAttachNode(ij_tuple ij, scalar_t* data, Layout layout);
+    void tileDetachNode(ij_tuple ij);
+
+    //--------------------------------------------------------------------------
+    // one-sided access to local tiles
+    void createTileWindow(MPI_Comm mpi_comm);
+    void freeTileWindow();
+
+    /// @return window exposing local tiles, or nullptr if not created.
+    TileWindow* tileWindow() const
+    {
+        return tile_window_.get();
+    }
+
 private:
     // Iterator routines should be called only within a Tiles Map LockGuard.
     // Otherwise, there may be race conditions with the returned iterator.
@@ -316,6 +343,7 @@ public:
     std::function<int64_t (int64_t j)> tileNb;
     std::function<int (ij_tuple ij)> tileRank;
     std::function<int (ij_tuple ij)> tileDevice;
+    std::function<int (ij_tuple ij)> tileNumaDomain;
 
     //--------------------------------------------------------------------------
     /// @return whether tile {i, j} is local.
@@ -450,6 +478,8 @@ private:
     TilesMap tiles_;        ///< map of tiles and associated states
     mutable omp_nest_lock_t lock_;  ///< TilesMap lock
     slate::Memory memory_;  ///< memory allocator
+    std::unique_ptr<NodeMemory> node_memory_;  ///< node-shared workspace
+    std::unique_ptr<TileWindow> tile_window_;  ///< RMA window of local tiles
     scalar_t *host_mem;
     std::map< int, std::stack<void*> > allocated_mem_;
     bool own;
@@ -528,6 +558,15 @@ MatrixStorage<scalar_t>::MatrixStorage(
         };
     }
 
+    // lambda that captures q, num_numa_domains to distribute host tiles
+    // of the local matrix in 1D column block cyclic fashion among
+    // NUMA domains, as for devices
+    int num_numa_domains = memory_.num_numa_domains_;
+    tileNumaDomain = [q, num_numa_domains](ij_tuple ij) {
+        int64_t j = std::get<1>(ij);
+        return int(j/q)%num_numa_domains;
+    };
+
     initQueues();
     omp_init_nest_lock(&lock_);
 }
@@ -556,6 +595,14 @@ MatrixStorage<scalar_t>::MatrixStorage(
     // todo: similar code in BaseMatrix(...) and MatrixStorage(...)
     num_devices_ = memory_.num_devices_;
 
+    // Without the process grid, distribute block columns cyclically
+    // among NUMA domains.
+    int num_numa_domains = memory_.num_numa_domains_;
+    tileNumaDomain = [num_numa_domains](ij_tuple ij) {
+        int64_t j = std::get<1>(ij);
+        return int(j%num_numa_domains);
+    };
+
     initQueues();
     omp_init_nest_lock(&lock_);
 }
@@ -567,7 +614,9 @@ template <typename scalar_t>
 MatrixStorage<scalar_t>::~MatrixStorage()
 {
     try {
+        tile_window_.reset();  // collective, if created
         clear();
+        node_memory_.reset();  // collective, if reserved
         clearBatchArrays();
         // Clear all host and device memory allocations
         memory_.clearHostBlocks();
@@ -789,13 +838,150 @@ void MatrixStorage<scalar_t>::ensureDeviceWorkspace(int device, int64_t num_tile
     }
 }
 
+//------------------------------------------------------------------------------
+/// Reserves num_tiles tiles per rank in a shared-memory window over the
+/// ranks of mpi_comm on the same node, used by BaseMatrix::listBcast to
+/// share received tiles within a node instead of copying them to each rank.
+/// Collective over mpi_comm. Replaces any existing node workspace,
+/// which must have no tiles in use.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::reserveNodeWorkspace(
+    MPI_Comm mpi_comm, int64_t num_tiles)
+{
+    node_memory_.reset();
+    node_memory_ = std::make_unique<NodeMemory>(
+        mpi_comm, memory_.block_size(), num_tiles );
+}
+
+//------------------------------------------------------------------------------
+/// Frees the node-shared workspace. Collective over the communicator
+/// given to reserveNodeWorkspace. No tiles may be in use.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::clearNodeWorkspace()
+{
+    node_memory_.reset();
+}
+
+//------------------------------------------------------------------------------
+/// Points the host instance of tile {i, j}, which must exist, at data in
+/// the node-shared workspace, with a compact stride in the given layout.
+/// Its previous memory is freed. The tile's reference to data is released
+/// when the tile is freed.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::tileAttachNode(
+    ij_tuple ij, scalar_t* data, Layout layout)
+{
+    LockGuard guard(getTilesMapLock());
+    auto& tile_node = *(tiles_.at(ij));
+    slate_assert(tile_node.existsOn(HostNum));
+
+    int64_t i = std::get<0>(ij);
+    int64_t j = std::get<1>(ij);
+    int64_t mb = tileMb(i);
+    int64_t nb = tileNb(j);
+    int64_t stride = layout == Layout::ColMajor ? mb : nb;
+
+    freeTileMemory(tile_node[HostNum]);
+    tile_node.eraseOn(HostNum);
+    Tile<scalar_t>* tile = new Tile<scalar_t>(
+        mb, nb, data, stride, HostNum, TileKind::Workspace, layout);
+    tile_node.insertOn(HostNum, tile, MOSI::Invalid);
+}
+
+//------------------------------------------------------------------------------
+/// If the host instance of tile {i, j} is in the node-shared workspace,
+/// copies it to private memory, so it can be modified.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::tileDetachNode(ij_tuple ij)
+{
+    if (node_memory_ == nullptr)
+        return;
+
+    LockGuard guard(getTilesMapLock());
+    auto iter = find(ij);
+    if (iter == end() || ! iter->second->existsOn(HostNum))
+        return;
+
+    Tile<scalar_t>* tile = iter->second->at(HostNum);
+    if (! node_memory_->contains(tile->data()))
+        return;
+
+    // Tiles in node memory are compact and never extended.
+    int64_t mb = tile->mb_;
+    int64_t nb = tile->nb_;
+    bool col_major = tile->layout() == Layout::ColMajor;
+    int64_t stride = col_major ? mb : nb;
+    scalar_t* data = (scalar_t*) memory_.alloc(
+        HostNum, sizeof(scalar_t) * mb * nb, nullptr, tileNumaDomain(ij));
+    lapack::lacpy(lapack::MatrixType::General,
+                  col_major ? mb : nb, col_major ? nb : mb,
+                  tile->data_, tile->stride_, data, stride);
+    node_memory_->release(tile->data_);
+
+    tile->data_ = data;
+    tile->stride_ = stride;
+    tile->user_stride_ = stride;
+}
+
+//------------------------------------------------------------------------------
+/// Exposes host instances of all local tiles in an MPI window, for
+/// one-sided gets by other ranks (BaseMatrix::tileFetch).
+/// Collective over mpi_comm. Replaces any existing window.
+/// Local tiles must not be erased, reallocated, or converted to another
+/// layout while the window exists.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::createTileWindow(MPI_Comm mpi_comm)
+{
+    tile_window_.reset();
+    auto window = std::make_unique<TileWindow>(mpi_comm);
+    {
+        LockGuard guard(getTilesMapLock());
+        for (auto& iter : tiles_) {
+            auto& tile_node = *(iter.second);
+            if (! tileIsLocal(iter.first) || ! tile_node.existsOn(HostNum))
+                continue;
+
+            Tile<scalar_t>* tile = tile_node[HostNum];
+            bool col_major = tile->layout() == Layout::ColMajor;
+            int64_t lines = col_major ? tile->nb() : tile->mb();
+            int64_t line_size = col_major ? tile->mb() : tile->nb();
+            if (lines > 0 && line_size > 0) {
+                size_t bytes = sizeof(scalar_t)
+                             * ((lines - 1)*tile->stride() + line_size);
+                window->add(std::get<0>(iter.first), std::get<1>(iter.first),
+                            tile->data(), bytes, tile->stride(),
+                            tile->layout());
+            }
+        }
+    }
+    window->publish();
+    tile_window_ = std::move(window);
+}
+
+//------------------------------------------------------------------------------
+/// Frees the window created by createTileWindow. Collective over its
+/// communicator. Tiles already fetched remain.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::freeTileWindow()
+{
+    tile_window_.reset();
+}
+
 //------------------------------------------------------------------------------
 /// Return tiles allocated memory and extended memory to the memory factory
 template <typename scalar_t>
 void MatrixStorage<scalar_t>::freeTileMemory(Tile<scalar_t>* tile)
 {
     slate_assert(tile != nullptr);
-    if (tile->allocated())
+    if (node_memory_ != nullptr && node_memory_->contains(tile->data()))
+        node_memory_->release(tile->data());
+    else if (tile->allocated())
         //delete[] tile->data();
         memory_.free(tile->data(), tile->device());
     if (tile->extended())
@@ -1091,7 +1277,9 @@ Tile<scalar_t>* MatrixStorage<scalar_t>::tileInsert(
         int64_t nb = tileNb(j);
         // if device==HostNum (-1) use nullptr as queue (not comm_queues_[-1])
         blas::Queue* queue = ( device == HostNum ? nullptr : comm_queues_[device]);
-        scalar_t* data = (scalar_t*) memory_.alloc(device, sizeof(scalar_t) * mb * nb, queue);
+        int numa_domain = ( device == HostNum ? tileNumaDomain({i, j}) : -1 );
+        scalar_t* data = (scalar_t*) memory_.alloc(
+            device, sizeof(scalar_t) * mb * nb, queue, numa_domain );
         int64_t stride = layout == Layout::ColMajor ? mb : nb;
         Tile<scalar_t>* tile
             = new Tile<scalar_t>(mb, nb, data, stride, device, kind, layout);
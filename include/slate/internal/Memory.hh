@@ -14,6 +14,7 @@
 
 #include <map>
 #include <stack>
+#include <vector>
 
 #include "blas.hh"
 
@@ -26,6 +27,9 @@ namespace slate {
 /// Allocates workspace blocks for host and GPU devices.
 /// Currently assumes a fixed-size block of block_size bytes,
 /// e.g., block_size = sizeof(scalar_t) * mb * nb.
+///
+/// When SLATE is built with libnuma (SLATE_HAVE_NUMA), host blocks can be
+/// placed on a given NUMA domain; see alloc().
 class Memory {
 public:
     friend class Debug;
@@ -34,6 +38,8 @@ public:
         StaticConstructor()
         {
             num_devices_ = blas::get_device_count();
+            numa_nodes_ = allowed_numa_nodes();
+            num_numa_domains_ = int( numa_nodes_.size() );
         }
     } static_constructor_;
 
@@ -47,7 +53,8 @@ public:
     void clearHostBlocks();
     void clearDeviceBlocks(int device, blas::Queue *queue);
 
-    void* alloc(int device, size_t size, blas::Queue *queue);
+    void* alloc(int device, size_t size, blas::Queue *queue,
+                int numa_domain = -1);
     void free(void* block, int device);
 
     /// @return number of available free blocks in device's memory pool,
@@ -71,11 +78,24 @@ public:
         return capacity(device) - available(device);
     }
 
+    /// @return size in bytes of each block.
+    size_t block_size() const
+    {
+        return block_size_;
+    }
+
     // ----------------------------------------
     // public static variables
     static int num_devices_;
+    static int num_numa_domains_;
 
 private:
+    static std::vector<int> allowed_numa_nodes();
+
+    // NUMA nodes that the process may allocate on; domain d is node
+    // numa_nodes_[ d ].
+    static std::vector<int> numa_nodes_;
+
     void* allocBlock(int device, blas::Queue *queue);
 
     void* allocHostMemory(size_t size);
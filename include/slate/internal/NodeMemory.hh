@@ -0,0 +1,109 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+//------------------------------------------------------------------------------
+/// @file
+///
+#ifndef SLATE_NODE_MEMORY_HH
+#define SLATE_NODE_MEMORY_HH
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "slate/internal/mpi.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Fixed-size blocks in an MPI-3 shared-memory window, shared by the ranks
+/// of a communicator that are on the same node
+/// (MPI_Comm_split_type with MPI_COMM_TYPE_SHARED).
+///
+/// Each rank allocates blocks from its own segment of the window, and any
+/// rank on the node can address blocks in any segment. Each block has a
+/// reference count stored in the window. alloc() sets it to the number of
+/// ranks that will reference the block, and each of them calls release()
+/// when done, so the owner can reuse the block without further messages.
+///
+/// The constructor and destructor are collective over comm.
+/// If a rank is alone on its node, no window is allocated.
+///
+class NodeMemory {
+public:
+    NodeMemory(MPI_Comm comm, size_t block_size, int64_t num_blocks);
+    ~NodeMemory();
+
+    NodeMemory(NodeMemory const&) = delete;
+    NodeMemory& operator = (NodeMemory const&) = delete;
+
+    /// @return id of the node of rank in comm.
+    /// Ranks on the same node have the same id.
+    int nodeId(int rank) const
+    {
+        return node_ids_[ rank ];
+    }
+
+    int64_t alloc(int64_t count);
+    void* data(int rank, int64_t block) const;
+    bool contains(void const* ptr) const;
+    void release(void const* ptr);
+    void sync();
+
+    /// @return pointer to the value block, for -1 <= block < capacity(),
+    /// valid for the lifetime of this object, to use as a
+    /// non-blocking send buffer.
+    int64_t const* blockIndex(int64_t block) const
+    {
+        return &block_indices_[ block + 1 ];
+    }
+
+    /// @return number of blocks in this rank's segment.
+    int64_t capacity() const
+    {
+        return num_blocks_;
+    }
+
+private:
+    using count_t = std::atomic<int64_t>;
+    static_assert( count_t::is_always_lock_free,
+                   "shared reference counts must be lock free" );
+
+    count_t* counts(int node_rank) const
+    {
+        return (count_t*) bases_[ node_rank ];
+    }
+
+    // ----------------------------------------
+    // member variables
+    MPI_Comm node_comm_;
+    MPI_Win win_;
+
+    size_t block_size_;     ///< bytes per block, rounded up to alignment
+    int64_t num_blocks_;    ///< blocks per rank
+    size_t header_size_;    ///< bytes of reference counts before the blocks
+    size_t segment_size_;   ///< bytes per rank
+
+    /// node id of each rank in comm
+    std::vector<int> node_ids_;
+
+    /// rank in node_comm_ of each rank in comm, or -1 if on another node
+    std::vector<int> node_ranks_;
+
+    /// base of each node rank's segment
+    std::vector<char*> bases_;
+
+    int node_rank_;
+
+    /// -1, 0, ..., num_blocks_ - 1; see blockIndex()
+    std::vector<int64_t> block_indices_;
+
+    /// next block to try in alloc()
+    int64_t next_;
+};
+
+} // namespace slate
+
+#endif // SLATE_NODE_MEMORY_HH
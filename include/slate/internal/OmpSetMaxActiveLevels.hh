@@ -33,8 +33,13 @@ public:
     ///
     /// @param[in] min_active_levels
     ///     Ensure that OpenMP max-active-levels-var ICV has this minimum.
+    ///     If <= 1, nested parallel regions are not needed and nothing
+    ///     is changed.
     OmpSetMaxActiveLevels(int min_active_levels)
     {
+        if (min_active_levels <= 1)
+            return;
+
         int curr_max_active_levels = omp_get_max_active_levels();
         #if defined(_OPENMP) && _OPENMP < 201811
             // if OpenMP version < 5.0 then enable omp_set_nested
@@ -0,0 +1,89 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+//------------------------------------------------------------------------------
+/// @file
+///
+#ifndef SLATE_TILE_WINDOW_HH
+#define SLATE_TILE_WINDOW_HH
+
+#include <cstdint>
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "slate/enums.hh"
+#include "slate/internal/mpi.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// MPI dynamic window exposing local tiles for one-sided (RMA) access,
+/// and the address, stride, and layout of every exposed tile on every rank,
+/// so a rank can get a remote tile without the owner's participation.
+/// The window is in a passive-target epoch (MPI_Win_lock_all) for its
+/// lifetime.
+///
+/// Usage: construct (collective), add() each local tile, publish()
+/// (collective), then any rank may get tiles. The destructor is collective.
+///
+class TileWindow {
+public:
+    /// Location of an exposed tile.
+    struct Entry {
+        int rank;
+        MPI_Aint address;
+        int64_t stride;
+        Layout layout;
+    };
+
+    using ij_tuple = std::tuple<int64_t, int64_t>;
+
+    TileWindow(MPI_Comm comm);
+    ~TileWindow();
+
+    TileWindow(TileWindow const&) = delete;
+    TileWindow& operator = (TileWindow const&) = delete;
+
+    void add(int64_t i, int64_t j, void const* data, size_t bytes,
+             int64_t stride, Layout layout);
+    void publish();
+
+    Entry const& at(ij_tuple ij) const;
+
+    /// @return whether tile {i, j} is exposed by some rank.
+    bool contains(ij_tuple ij) const
+    {
+        return entries_.find(ij) != entries_.end();
+    }
+
+    /// @return the MPI window.
+    MPI_Win win() const
+    {
+        return win_;
+    }
+
+    void flush(int rank);
+
+private:
+    MPI_Comm comm_;
+    MPI_Win win_;
+
+    /// Memory ranges [begin, end) of local tiles added since publish().
+    std::vector< std::pair<char const*, char const*> > ranges_;
+
+    /// Attached memory regions, to detach.
+    std::vector<char const*> attached_;
+
+    /// Local tiles added since publish(): i, j, address, stride, layout.
+    std::vector<int64_t> local_;
+
+    std::map<ij_tuple, Entry> entries_;
+};
+
+} // namespace slate
+
+#endif // SLATE_TILE_WINDOW_HH
@@ -57,6 +57,7 @@ public:
     static void off() { tracing_ = false; }
 
     static void insert(Event event);
+    static void thread_slot(int slot);
     static void finish();
     static void comment(std::string const& str);
 
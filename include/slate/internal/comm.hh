@@ -9,8 +9,10 @@
 #ifndef SLATE_INTERNAL_COMM_HH
 #define SLATE_INTERNAL_COMM_HH
 
+#include <cstdint>
 #include <list>
 #include <set>
+#include <vector>
 
 #include "slate/internal/mpi.hh"
 
@@ -27,6 +29,37 @@ void cubeBcastPattern(int size, int rank, int radix,
 void cubeReducePattern(int size, int rank, int radix,
                        std::list<int>& recv_from, std::list<int>& send_to);
 
+//------------------------------------------------------------------------------
+/// Settings for tile reductions in BaseMatrix::listReduce.
+/// The default is a radix-2 tree rooted at each tile's owner,
+/// sending whole tiles.
+/// @see reducePlan to build one from Options.
+///
+struct ReducePlan {
+    /// Radix of the reduction tree, >= 2.
+    int radix = 2;
+
+    /// Number of elements per message. Tiles larger than this are sent
+    /// in segments, so a rank forwards the first segment while later ones
+    /// are still arriving. 0 sends whole tiles.
+    int64_t segment_size = 0;
+
+    /// For tiles in a list reduced over the same set of ranks, rotate the
+    /// tree root over that set, then send each sum to the tile's owner,
+    /// so the additions and incoming traffic are spread over all ranks
+    /// instead of concentrated on the owner (reduce-scatter, then gather).
+    bool scatter = false;
+
+    /// If not empty, node id of each rank in the matrix's communicator
+    /// (@see mpi_node_ids). Ranks then reduce within each node first,
+    /// and the node leaders reduce across nodes.
+    std::vector<int> node_ids;
+};
+
+void reducePattern(std::set<int> const& reduce_set, int root, int rank,
+                   ReducePlan const& plan,
+                   std::vector<int>& recv_from, int& send_to);
+
 } // namespace internal
 } // namespace slate
 
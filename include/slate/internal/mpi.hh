@@ -22,10 +22,15 @@ typedef int MPI_Request;
 typedef int MPI_Status;
 typedef int MPI_Op;
 typedef int MPI_Fint;
+typedef int MPI_Info;
+typedef int MPI_Win;
+typedef long MPI_Aint;
 
 enum {
     MPI_COMM_NULL,
     MPI_COMM_WORLD,
+    MPI_COMM_TYPE_SHARED,
+    MPI_INFO_NULL,
 
     MPI_BYTE,
     MPI_CHAR,
@@ -45,9 +50,13 @@ enum {
 
     MPI_MAX,
     MPI_MAXLOC,
+    MPI_MIN,
     MPI_SUM,
 
     MPI_SUCCESS,
+    MPI_UNDEFINED,
+    MPI_IDENT,
+    MPI_CONGRUENT,
     MPI_THREAD_MULTIPLE,
     MPI_THREAD_SERIALIZED,
 };
@@ -57,6 +66,8 @@ enum {
 extern int* MPI_STATUS_IGNORE;
 #define MPI_STATUSES_IGNORE NULL
 #define MPI_REQUEST_NULL 0
+#define MPI_WIN_NULL 0
+#define MPI_MODE_NOCHECK 1024
 
 typedef void (MPI_User_function) (void* a,
                                   void* b, int* len, MPI_Datatype* type);
@@ -67,6 +78,14 @@ extern "C" {
 
 int MPI_Type_contiguous(int count, MPI_Datatype oldtype, MPI_Datatype* newtype);
 
+int MPI_Allgather(const void* sendbuf, int sendcount, MPI_Datatype sendtype,
+                  void* recvbuf, int recvcount, MPI_Datatype recvtype,
+                  MPI_Comm comm);
+
+int MPI_Allgatherv(const void* sendbuf, int sendcount, MPI_Datatype sendtype,
+                   void* recvbuf, const int recvcounts[], const int displs[],
+                   MPI_Datatype recvtype, MPI_Comm comm);
+
 int MPI_Allreduce(const void* sendbuf, void* recvbuf, int count,
                   MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
 
@@ -78,10 +97,13 @@ int MPI_Bcast(void* buffer, int count, MPI_Datatype datatype, int root,
 int MPI_Comm_create_group(MPI_Comm comm, MPI_Group group, int tag,
                           MPI_Comm* newcomm);
 
+int MPI_Comm_compare(MPI_Comm comm1, MPI_Comm comm2, int* result);
 int MPI_Comm_free(MPI_Comm* comm);
 int MPI_Comm_group(MPI_Comm comm, MPI_Group* group);
 int MPI_Comm_rank(MPI_Comm comm, int* rank);
 int MPI_Comm_size(MPI_Comm comm, int* size);
+int MPI_Comm_split_type(MPI_Comm comm, int split_type, int key,
+                        MPI_Info info, MPI_Comm* newcomm);
 MPI_Fint MPI_Comm_f2c(MPI_Comm comm);
 
 int MPI_Group_free(MPI_Group* group);
@@ -92,12 +114,20 @@ int MPI_Group_incl(MPI_Group group, int n, const int ranks[],
 int MPI_Group_translate_ranks(MPI_Group group1, int n, const int ranks1[],
                               MPI_Group group2, int ranks2[]);
 
+int MPI_Get(void* origin_addr, int origin_count, MPI_Datatype origin_datatype,
+            int target_rank, MPI_Aint target_disp, int target_count,
+            MPI_Datatype target_datatype, MPI_Win win);
+
+int MPI_Get_address(const void* location, MPI_Aint* address);
+
 int MPI_Init(int* argc, char*** argv);
 
 int MPI_Init_thread(int* argc, char*** argv, int required, int* provided);
 
 int MPI_Initialized(int* flag);
 
+int MPI_Query_thread(int* provided);
+
 int MPI_Irecv(void* buf, int count, MPI_Datatype datatype, int source,
               int tag, MPI_Comm comm, MPI_Request* request);
 
@@ -128,6 +158,8 @@ int MPI_Type_commit(MPI_Datatype* datatype);
 
 int MPI_Type_free(MPI_Datatype* datatype);
 
+int MPI_Type_size(MPI_Datatype datatype, int* size);
+
 int MPI_Type_vector(int count, int blocklength, int stride,
                     MPI_Datatype oldtype, MPI_Datatype* newtype);
 
@@ -135,6 +167,28 @@ int MPI_Wait(MPI_Request* request, MPI_Status* status);
 
 int MPI_Waitall(int count, MPI_Request requests[], MPI_Status statuses[]);
 
+int MPI_Win_allocate_shared(MPI_Aint size, int disp_unit, MPI_Info info,
+                            MPI_Comm comm, void* baseptr, MPI_Win* win);
+
+int MPI_Win_shared_query(MPI_Win win, int rank, MPI_Aint* size,
+                         int* disp_unit, void* baseptr);
+
+int MPI_Win_create_dynamic(MPI_Info info, MPI_Comm comm, MPI_Win* win);
+
+int MPI_Win_attach(MPI_Win win, void* base, MPI_Aint size);
+
+int MPI_Win_detach(MPI_Win win, const void* base);
+
+int MPI_Win_flush(int rank, MPI_Win win);
+
+int MPI_Win_free(MPI_Win* win);
+
+int MPI_Win_lock_all(int mode, MPI_Win win);
+
+int MPI_Win_unlock_all(MPI_Win win);
+
+int MPI_Win_sync(MPI_Win win);
+
 int MPI_Error_string(int errorcode, char* string, int* resultlen);
 
 int MPI_Finalize(void);
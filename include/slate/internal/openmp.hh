@@ -21,6 +21,21 @@
 #define slate_omp_default_none
 #endif
 
+// OpenMP 5.0 task affinity clause, hinting that a task should run near the
+// given memory, e.g., on the NUMA domain that holds a tile.
+// Compilers that predate OpenMP 5.0 get no hint.
+// Used by the HostTask gemm, herk, syrk, and trsm kernels, which do most of
+// the work in the Cholesky and LU factorizations; tasks in other kernels
+// run wherever the OpenMP runtime schedules them.
+//
+#ifndef slate_omp_affinity
+    #if defined( _OPENMP ) && _OPENMP >= 201811
+        #define slate_omp_affinity( locator ) affinity( locator )
+    #else
+        #define slate_omp_affinity( locator )
+    #endif
+#endif
+
 // Include OpenMP headers
 //
 // Note: There is no _OPENMP guard because SLATE requires OpenMP and
@@ -78,10 +78,12 @@ namespace MethodGemm {
 
     constexpr char GemmA_str[] = "A";
     constexpr char GemmC_str[] = "C";
+    constexpr char Strassen_str[] = "S";
     const Method Error  = baseMethodError;
     const Method Auto   = baseMethodAuto;
     const Method GemmA  = 1;  ///< Select gemmA algorithm
     const Method GemmC  = 2;  ///< Select gemmC algorithm
+    const Method Strassen = 3;  ///< Select gemm_strassen algorithm (opt-in)
 
     template <typename TA, typename TB>
     inline Method select_algo(TA& A, TB& B, Options& opts) {
@@ -109,6 +111,8 @@ namespace MethodGemm {
             return GemmA;
         else if (method_ == "c" || method_ == "gemmc")
             return GemmC;
+        else if (method_ == "s" || method_ == "strassen")
+            return Strassen;
         else
             throw slate::Exception("unknown gemm method");
     }
@@ -119,6 +123,7 @@ namespace MethodGemm {
             case Auto:  return baseMethodAuto_str;
             case GemmA: return GemmA_str;
             case GemmC: return GemmC_str;
+            case Strassen: return Strassen_str;
             default:    return baseMethodError_str;
         }
     }
@@ -314,6 +319,41 @@ namespace MethodLU {
 
 } // namespace MethodLU
 
+//------------------------------------------------------------------------------
+/// Select the band solver algorithm (gbsv, pbsv).
+namespace MethodBand {
+
+    static constexpr char Tiled_str[] = "tiled";
+    static constexpr char Spike_str[] = "spike";
+    static const Method Error = baseMethodError; ///< Error flag
+    static const Method Tiled = 1;  ///< Select tiled factorization (gbtrf, pbtrf) and solve
+    static const Method Spike = 2;  ///< Select partitioned SPIKE solver
+
+    inline Method str2methodBand( const char* method )
+    {
+        std::string method_ = method;
+        std::transform(
+            method_.begin(), method_.end(), method_.begin(), ::tolower );
+
+        if (method_ == "tiled")
+            return Tiled;
+        else if (method_ == "spike")
+            return Spike;
+        else
+            throw slate::Exception("unknown band method");
+    }
+
+    inline const char* methodBand2str( Method method )
+    {
+        switch (method) {
+            case Tiled: return Tiled_str;
+            case Spike: return Spike_str;
+            default:    return baseMethodError_str;
+        }
+    }
+
+} // namespace MethodBand
+
 } // namespace slate
 
 #endif // SLATE_METHOD_HH
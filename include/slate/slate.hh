@@ -187,6 +187,15 @@ void gemmC(
     scalar_t beta,  Matrix<scalar_t>& C,
     Options const& opts = Options());
 
+//-----------------------------------------
+// gemm_strassen()
+template <typename scalar_t>
+void gemm_strassen(
+    scalar_t alpha, Matrix<scalar_t>& A,
+                    Matrix<scalar_t>& B,
+    scalar_t beta,  Matrix<scalar_t>& C,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // hbmm()
 template <typename scalar_t>
@@ -453,6 +462,28 @@ norm(
     return norm< TrapezoidMatrix<scalar_t> >( trnorm, A, opts );
 }
 
+//-----------------------------------------
+// norms()
+// several norms in one pass
+template <typename matrix_type>
+void norms(
+    std::vector<Norm> const& in_norms,
+    matrix_type& A,
+    blas::real_type<typename matrix_type::value_type>* values,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// norms for triangular case
+template <typename scalar_t>
+void norms(
+    std::vector<Norm> const& in_norms,
+    TriangularMatrix<scalar_t>& A,
+    blas::real_type<scalar_t>* values,
+    Options const& opts = Options())
+{
+    norms< TrapezoidMatrix<scalar_t> >( in_norms, A, values, opts );
+}
+
 //-----------------------------------------
 // colNorms()
 // all cols max norm
@@ -744,6 +775,25 @@ void potrf(
     potrf(AH, opts);
 }
 
+//-----------------------------------------
+// potrf_tlr()
+template <typename scalar_t>
+void potrf_tlr(
+    HermitianMatrix<scalar_t>& A,
+    Options const& opts = Options());
+
+// forward real-symmetric matrices to potrf_tlr;
+// disabled for complex
+template <typename scalar_t>
+void potrf_tlr(
+    SymmetricMatrix<scalar_t>& A,
+    Options const& opts = Options(),
+    enable_if_t< ! is_complex<scalar_t>::value >* = nullptr)
+{
+    HermitianMatrix<scalar_t> AH(A);
+    potrf_tlr(AH, opts);
+}
+
 //-----------------------------------------
 // pbtrs()
 template <typename scalar_t>
@@ -1339,10 +1389,74 @@ void trcondest(
         blas::real_type<scalar_t> *rcond,
         Options const& opts = Options());
 
+//------------------------------------------------------------------------------
+// Batched routines on independent, small host tiles.
+// No communication; each MPI rank processes its own batch.
+namespace batch {
+
+//-----------------------------------------
+// gemm()
+template <typename scalar_t>
+void gemm(
+    scalar_t alpha, std::vector< Tile<scalar_t> >& A,
+                    std::vector< Tile<scalar_t> >& B,
+    scalar_t beta,  std::vector< Tile<scalar_t> >& C,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// potrf()
+template <typename scalar_t>
+void potrf(
+    std::vector< Tile<scalar_t> >& A,
+    std::vector<int64_t>& info,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// potrs()
+template <typename scalar_t>
+void potrs(
+    std::vector< Tile<scalar_t> >& A,
+    std::vector< Tile<scalar_t> >& B,
+    std::vector<int64_t>& info,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// getrf()
+template <typename scalar_t>
+void getrf(
+    std::vector< Tile<scalar_t> >& A,
+    std::vector< std::vector<int64_t> >& pivots,
+    std::vector<int64_t>& info,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// getrs()
+template <typename scalar_t>
+void getrs(
+    std::vector< Tile<scalar_t> >& A,
+    std::vector< std::vector<int64_t> >& pivots,
+    std::vector< Tile<scalar_t> >& B,
+    std::vector<int64_t>& info,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// geqrf()
+template <typename scalar_t>
+void geqrf(
+    std::vector< Tile<scalar_t> >& A,
+    std::vector< std::vector<scalar_t> >& tau,
+    Options const& opts = Options());
+
+} // namespace batch
+
 } // namespace slate
 
 //-----------------------------------------
 // Simplified C++ API
 #include "simplified_api.hh"
 
+//-----------------------------------------
+// Asynchronous drivers
+#include "async.hh"
+
 #endif // SLATE_HH
@@ -52,6 +52,15 @@ public:
     OptionValue(MethodEig m) : i_(int(m))
     {}
 
+    OptionValue(Layout l) : i_(int(l))
+    {}
+
+    OptionValue(PivotTree t) : i_(int(t))
+    {}
+
+    OptionValue(ComplexGemm m) : i_(int(m))
+    {}
+
     union {
         int64_t i_;
         double d_;
@@ -0,0 +1,258 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/internal/DryRun.hh"
+#include "slate/Exception.hh"
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+namespace slate {
+
+bool DryRun::enabled_ = false;
+DryRun::Counts DryRun::counts_;
+std::map<std::string, int64_t> DryRun::tasks_;
+std::map<int64_t, void*> DryRun::scratch_;
+std::map<void*, int64_t> DryRun::scratch_bytes_;
+std::atomic<bool> DryRun::has_scratch_( false );
+int64_t DryRun::scratch_tiles_ = 0;
+
+//------------------------------------------------------------------------------
+/// Turns dry-run mode on and resets the counters.
+///
+void DryRun::on()
+{
+    counts_ = Counts();
+    tasks_.clear();
+    enabled_ = true;
+}
+
+//------------------------------------------------------------------------------
+/// Turns dry-run mode off. Scratch blocks are freed once no host tiles from
+/// hostAlloc remain; tiles of matrices that outlive the dry run keep them
+/// until those matrices are destroyed.
+///
+void DryRun::off()
+{
+    enabled_ = false;
+    #pragma omp critical(slate_dry_run)
+    {
+        if (scratch_tiles_ == 0)
+            releaseScratch();
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Frees scratch blocks, so host frees skip the scratch lookup again.
+/// Called within critical(slate_dry_run).
+///
+void DryRun::releaseScratch()
+{
+    for (auto& scratch : scratch_)
+        delete[] (char*) scratch.second;
+    scratch_.clear();
+    scratch_bytes_.clear();
+    has_scratch_ = false;
+}
+
+//------------------------------------------------------------------------------
+/// Counts flops of a skipped kernel, in Gflop.
+///
+void DryRun::flops(double gflop)
+{
+    #pragma omp atomic
+    counts_.gflop += gflop;
+}
+
+//------------------------------------------------------------------------------
+/// Counts a skipped send (or this rank's part of a broadcast) of bytes.
+///
+void DryRun::send(int64_t bytes)
+{
+    #pragma omp critical(slate_dry_run)
+    {
+        counts_.sends += 1;
+        counts_.send_bytes += bytes;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Counts a skipped receive of bytes.
+///
+void DryRun::recv(int64_t bytes)
+{
+    #pragma omp critical(slate_dry_run)
+    {
+        counts_.recvs += 1;
+        counts_.recv_bytes += bytes;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Counts a host tile allocation, and updates the peak, instead of
+/// allocating. Tiles allocated before on() are not counted, so the peak is
+/// the memory the run adds to the matrices allocated before it.
+///
+/// @return scratch block of the given size, shared by all host tiles of that
+///     size, so a dry run does not need the memory it counts. Tile data is
+///     therefore meaningless.
+///
+void* DryRun::hostAlloc(int64_t bytes)
+{
+    void* block;
+    #pragma omp critical(slate_dry_run)
+    {
+        void*& scratch = scratch_[ bytes ];
+        if (scratch == nullptr) {
+            scratch = new char[ bytes ];
+            scratch_bytes_[ scratch ] = bytes;
+            has_scratch_ = true;
+        }
+        block = scratch;
+        scratch_tiles_ += 1;
+
+        counts_.host_tiles += 1;
+        counts_.host_bytes += bytes;
+        counts_.peak_tiles = std::max(counts_.peak_tiles, counts_.host_tiles);
+        counts_.peak_bytes = std::max(counts_.peak_bytes, counts_.host_bytes);
+    }
+    return block;
+}
+
+//------------------------------------------------------------------------------
+/// Counts a host tile release, if block is from hostAlloc, even after off().
+///
+/// @return true if block is a scratch block from hostAlloc,
+///     which must not be freed.
+///
+bool DryRun::hostFree(void* block)
+{
+    if (! has_scratch_)
+        return false;
+
+    bool found = false;
+    #pragma omp critical(slate_dry_run)
+    {
+        auto iter = scratch_bytes_.find( block );
+        if (iter != scratch_bytes_.end()) {
+            found = true;
+            counts_.host_tiles -= 1;
+            counts_.host_bytes -= iter->second;
+            scratch_tiles_ -= 1;
+            if (scratch_tiles_ == 0 && ! enabled_)
+                releaseScratch();
+        }
+    }
+    return found;
+}
+
+//------------------------------------------------------------------------------
+/// Counts a task or kernel, by its trace name.
+///
+void DryRun::task(const char* name)
+{
+    #pragma omp critical(slate_dry_run)
+    {
+        tasks_[ name ] += 1;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Prints min, avg, and max over ranks of the counters, and the number of
+/// tasks of each kind summed over ranks. Collective over comm; rank 0 prints.
+///
+void DryRun::print(MPI_Comm comm, FILE* file)
+{
+    int mpi_rank, mpi_size;
+    slate_mpi_call(
+        MPI_Comm_rank(comm, &mpi_rank));
+    slate_mpi_call(
+        MPI_Comm_size(comm, &mpi_size));
+
+    const int num_values = 7;
+    const char* labels[ num_values ] = {
+        "Gflop",
+        "messages sent",
+        "Gbytes sent",
+        "messages received",
+        "Gbytes received",
+        "peak host tiles",
+        "peak host Gbytes",
+    };
+    double values[ num_values ] = {
+        counts_.gflop,
+        double( counts_.sends ),
+        1e-9 * counts_.send_bytes,
+        double( counts_.recvs ),
+        1e-9 * counts_.recv_bytes,
+        double( counts_.peak_tiles ),
+        1e-9 * counts_.peak_bytes,
+    };
+
+    // Serialize task counts as "name count" lines, to sum over ranks.
+    std::ostringstream stream;
+    for (auto const& task : tasks_)
+        stream << task.first << ' ' << task.second << '\n';
+    std::string local = stream.str();
+
+    double min[ num_values ], max[ num_values ], sum[ num_values ];
+    std::string all;
+    if (mpi_size == 1) {
+        std::copy(values, values + num_values, min);
+        std::copy(values, values + num_values, max);
+        std::copy(values, values + num_values, sum);
+        all = local;
+    }
+    else {
+        slate_mpi_call(
+            MPI_Reduce(values, min, num_values, MPI_DOUBLE, MPI_MIN, 0, comm));
+        slate_mpi_call(
+            MPI_Reduce(values, max, num_values, MPI_DOUBLE, MPI_MAX, 0, comm));
+        slate_mpi_call(
+            MPI_Reduce(values, sum, num_values, MPI_DOUBLE, MPI_SUM, 0, comm));
+
+        int count = local.size();
+        std::vector<int> counts(mpi_size), displs(mpi_size);
+        slate_mpi_call(
+            MPI_Allgather(&count, 1, MPI_INT, counts.data(), 1, MPI_INT, comm));
+        int total = 0;
+        for (int rank = 0; rank < mpi_size; ++rank) {
+            displs[ rank ] = total;
+            total += counts[ rank ];
+        }
+        all.resize(total);
+        slate_mpi_call(
+            MPI_Allgatherv(local.data(), count, MPI_CHAR,
+                           &all[ 0 ], counts.data(), displs.data(),
+                           MPI_CHAR, comm));
+    }
+
+    if (mpi_rank != 0)
+        return;
+
+    std::map<std::string, int64_t> tasks;
+    std::istringstream lines(all);
+    std::string name;
+    int64_t count;
+    while (lines >> name >> count)
+        tasks[ name ] += count;
+
+    fprintf(file, "\n%% Dry run over %d ranks\n", mpi_size);
+    fprintf(file, "%% %-28s  %12s  %12s  %12s\n",
+            "per rank", "min", "avg", "max");
+    for (int k = 0; k < num_values; ++k) {
+        fprintf(file, "%% %-28s  %12.4g  %12.4g  %12.4g\n",
+                labels[ k ], min[ k ], sum[ k ] / mpi_size, max[ k ]);
+    }
+    fprintf(file, "%% %-28s  %12s\n", "tasks", "all ranks");
+    for (auto const& task : tasks) {
+        fprintf(file, "%% %-28s  %12lld\n",
+                task.first.c_str(), (long long) task.second);
+    }
+    fflush(file);
+}
+
+} // namespace slate
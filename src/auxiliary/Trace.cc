@@ -4,6 +4,7 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "slate/internal/Trace.hh"
+#include "slate/internal/DryRun.hh"
 
 #include <algorithm>
 #include <cassert>
@@ -11,6 +12,7 @@
 #include <cstdio>
 #include <ctime>
 #include <limits>
+#include <mutex>
 #include <string>
 
 namespace slate {
@@ -184,10 +186,21 @@ std::string comment_;
 std::vector<std::vector<Event>> Trace::events_ =
     std::vector<std::vector<Event>>(omp_get_max_threads());
 
+// One lock per events_ slot. OpenMP threads each have their own slot,
+// but threads not created by OpenMP (internal::ThreadTeam workers)
+// share slots with them, so every insert locks its slot.
+static std::vector<std::mutex> s_slot_mutexes( omp_get_max_threads() );
+
+// Slot set by thread_slot(), or -1 to use omp_get_thread_num().
+static thread_local int s_thread_slot = -1;
+
 std::map<std::string, Color> function_color_ = {
 
     {"blas::add",   Color::LightSkyBlue},
     {"blas::gemm",  Color::MediumAquamarine},
+    {"blas::gemm_pack", Color::Aquamarine},
+    {"blas::gemm_ozaki", Color::Aquamarine},
+    {"blas::gemm_split", Color::Aquamarine},
     {"blas::hemm",  Color::MediumAquamarine},
     {"blas::her2k", Color::MediumAquamarine},
     {"blas::herk",  Color::MediumAquamarine},
@@ -260,7 +273,10 @@ std::map<std::string, Color> function_color_ = {
 ///
 Block::Block( const char* name, int64_t index )
     : event_( name, index, s_nest++ )
-{}
+{
+    if (DryRun::enabled())
+        DryRun::task( name );
+}
 
 //------------------------------------------------------------------------------
 /// Destroy a block, which marks the end of an event in the trace.
@@ -277,10 +293,26 @@ void Trace::insert(Event event)
 {
     if (tracing_) {
         event.stop();
-        events_[omp_get_thread_num()].push_back(event);
+        int slot = (s_thread_slot >= 0 ? s_thread_slot : omp_get_thread_num())
+                 % num_threads_;
+        std::lock_guard<std::mutex> guard( s_slot_mutexes[ slot ] );
+        events_[ slot ].push_back( event );
     }
 }
 
+//------------------------------------------------------------------------------
+/// Sets the slot (row in the trace) for events of the calling thread,
+/// for threads not created by OpenMP, on which omp_get_thread_num() is 0.
+///
+/// @param[in] slot
+///     Slot >= 0, taken modulo the number of slots,
+///     or -1 to use omp_get_thread_num().
+///
+void Trace::thread_slot(int slot)
+{
+    s_thread_slot = slot;
+}
+
 //------------------------------------------------------------------------------
 void Trace::comment(std::string const& str)
 {
@@ -0,0 +1,513 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/Tile_blas.hh"
+#include "internal/Tile_lapack.hh"
+
+namespace slate {
+namespace batch {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Calls f( k ) for each problem k = 0, ..., batch_size-1,
+/// dynamically scheduled over OpenMP threads, in one parallel region.
+/// Chunks of Option::ChunkSize problems are scheduled at a time;
+/// the default gives each thread about 8 chunks.
+///
+template <typename func_t>
+void for_each_problem(int64_t batch_size, Options const& opts, func_t f)
+{
+    int64_t chunk = get_option<int64_t>(
+        opts, Option::ChunkSize,
+        std::max( batch_size / (8 * omp_get_max_threads()), int64_t( 1 ) ) );
+    slate_assert( chunk >= 1 );
+
+    #pragma omp parallel for schedule( dynamic, chunk ) slate_omp_default_none \
+        shared( f ) firstprivate( batch_size, chunk )
+    for (int64_t k = 0; k < batch_size; ++k) {
+        f( k );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Checks that tile A is a host tile that LAPACK can use directly.
+/// Called before the parallel region, since exceptions cannot escape it.
+///
+template <typename scalar_t>
+void check_tile(Tile<scalar_t> const& A)
+{
+    slate_assert( A.device() == HostNum );
+    slate_assert( A.layout() == Layout::ColMajor );
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Batched matrix multiply of independent tiles,
+/// $C_k = \alpha op(A_k) op(B_k) + \beta C_k$, for k = 0, ..., batch_size-1.
+/// Problems may have different sizes. Transposes are set on the tiles,
+/// e.g., A[ k ] = transpose( A[ k ] ).
+/// Problems are scheduled across threads in a single parallel region;
+/// there is no communication, so for large batches each MPI rank
+/// calls this on its own part of the batch.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] alpha
+///     The scalar alpha.
+///
+/// @param[in] A
+///     Vector of batch_size host tiles, A[ k ] is m_k-by-k_k.
+///
+/// @param[in] B
+///     Vector of batch_size host tiles, B[ k ] is k_k-by-n_k.
+///
+/// @param[in] beta
+///     The scalar beta.
+///
+/// @param[in,out] C
+///     Vector of batch_size host tiles, C[ k ] is m_k-by-n_k.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::ChunkSize:
+///       Number of problems scheduled at a time on a thread.
+///       Default batch_size / (8 * number of threads).
+///
+/// @ingroup gemm
+///
+template <typename scalar_t>
+void gemm(
+    scalar_t alpha, std::vector< Tile<scalar_t> >& A,
+                    std::vector< Tile<scalar_t> >& B,
+    scalar_t beta,  std::vector< Tile<scalar_t> >& C,
+    Options const& opts)
+{
+    int64_t batch_size = C.size();
+    slate_assert( int64_t( A.size() ) == batch_size );
+    slate_assert( int64_t( B.size() ) == batch_size );
+    for (int64_t k = 0; k < batch_size; ++k) {
+        impl::check_tile( A[ k ] );
+        impl::check_tile( B[ k ] );
+        impl::check_tile( C[ k ] );
+    }
+
+    impl::for_each_problem( batch_size, opts, [&]( int64_t k ) {
+        tile::gemm( alpha, A[ k ], B[ k ], beta, C[ k ] );
+    } );
+}
+
+//------------------------------------------------------------------------------
+/// Batched Cholesky factorization of independent Hermitian positive definite
+/// tiles, $A_k = L_k L_k^H$ or $A_k = U_k^H U_k$, depending on the uplo
+/// set on each tile.
+/// See batch::gemm for scheduling and options.
+///
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     Vector of batch_size host, column-major tiles.
+///     On exit, the Cholesky factors.
+///
+/// @param[out] info
+///     Vector of length batch_size. info[ k ] = 0 for success, or
+///     i > 0 if the leading minor of order i of A[ k ] is not positive definite.
+///
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+void potrf(
+    std::vector< Tile<scalar_t> >& A,
+    std::vector<int64_t>& info,
+    Options const& opts)
+{
+    int64_t batch_size = A.size();
+    info.resize( batch_size );
+
+    for (int64_t k = 0; k < batch_size; ++k) {
+        impl::check_tile( A[ k ] );
+    }
+
+    impl::for_each_problem( batch_size, opts, [&]( int64_t k ) {
+        info[ k ] = slate::potrf( A[ k ] );
+    } );
+}
+
+//------------------------------------------------------------------------------
+/// Batched solve of $A_k X_k = B_k$ using the Cholesky factors from
+/// batch::potrf.
+/// See batch::gemm for scheduling and options.
+///
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     Vector of batch_size host, column-major tiles, factored by batch::potrf.
+///
+/// @param[in,out] B
+///     Vector of batch_size host, column-major tiles.
+///     On entry, B[ k ] is the n_k-by-nrhs_k right hand side.
+///     On exit, the solution X[ k ].
+///
+/// @param[out] info
+///     Vector of length batch_size. info[ k ] = 0 for success, or
+///     i > 0 if diagonal entry i of the Cholesky factor of A[ k ] is not
+///     positive, as when batch::potrf failed on A[ k ] with the same info;
+///     then B[ k ] is unchanged.
+///
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+void potrs(
+    std::vector< Tile<scalar_t> >& A,
+    std::vector< Tile<scalar_t> >& B,
+    std::vector<int64_t>& info,
+    Options const& opts)
+{
+    using std::real;
+
+    int64_t batch_size = A.size();
+    slate_assert( int64_t( B.size() ) == batch_size );
+    info.resize( batch_size );
+
+    for (int64_t k = 0; k < batch_size; ++k) {
+        impl::check_tile( A[ k ] );
+        impl::check_tile( B[ k ] );
+        slate_assert( B[ k ].op() == Op::NoTrans );
+    }
+
+    impl::for_each_problem( batch_size, opts, [&]( int64_t k ) {
+        auto& Ak = A[ k ];
+        info[ k ] = 0;
+        for (int64_t i = 0; i < Ak.nb(); ++i) {
+            // Negated to also catch NaN.
+            if (! (real( Ak.data()[ i + i*Ak.stride() ] ) > 0)) {
+                info[ k ] = i + 1;
+                return;
+            }
+        }
+        lapack::potrs( Ak.uploPhysical(), Ak.nb(), B[ k ].nb(),
+                       Ak.data(), Ak.stride(),
+                       B[ k ].data(), B[ k ].stride() );
+    } );
+}
+
+//------------------------------------------------------------------------------
+/// Batched LU factorization with partial pivoting of independent tiles,
+/// $P_k A_k = L_k U_k$.
+/// See batch::gemm for scheduling and options.
+///
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     Vector of batch_size host, column-major tiles.
+///     On exit, the factors L and U.
+///
+/// @param[out] pivots
+///     Vector of batch_size pivot vectors. On exit, pivots[ k ] has the
+///     LAPACK (1-based) row interchanges for A[ k ].
+///
+/// @param[out] info
+///     Vector of length batch_size. info[ k ] = 0 for success, or
+///     i > 0 if U(i, i) of A[ k ] is exactly zero.
+///
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+void getrf(
+    std::vector< Tile<scalar_t> >& A,
+    std::vector< std::vector<int64_t> >& pivots,
+    std::vector<int64_t>& info,
+    Options const& opts)
+{
+    int64_t batch_size = A.size();
+    pivots.resize( batch_size );
+    info.resize( batch_size );
+
+    for (int64_t k = 0; k < batch_size; ++k) {
+        impl::check_tile( A[ k ] );
+        slate_assert( A[ k ].op() == Op::NoTrans );
+    }
+
+    impl::for_each_problem( batch_size, opts, [&]( int64_t k ) {
+        auto& Ak = A[ k ];
+        pivots[ k ].resize( std::min( Ak.mb(), Ak.nb() ) );
+        info[ k ] = lapack::getrf( Ak.mb(), Ak.nb(), Ak.data(), Ak.stride(),
+                                   pivots[ k ].data() );
+    } );
+}
+
+//------------------------------------------------------------------------------
+/// Batched solve of $op(A_k) X_k = B_k$ using the LU factors from
+/// batch::getrf. The transpose op is set on the tiles A[ k ].
+/// See batch::gemm for scheduling and options.
+///
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     Vector of batch_size host, column-major tiles, factored by batch::getrf.
+///
+/// @param[in] pivots
+///     Pivots from batch::getrf.
+///
+/// @param[in,out] B
+///     Vector of batch_size host, column-major tiles.
+///     On entry, B[ k ] is the n_k-by-nrhs_k right hand side.
+///     On exit, the solution X[ k ].
+///
+/// @param[out] info
+///     Vector of length batch_size. info[ k ] = 0 for success, or
+///     i > 0 if U(i, i) of A[ k ] is exactly zero, as batch::getrf reported
+///     in info[ k ]; then B[ k ] is unchanged.
+///
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+void getrs(
+    std::vector< Tile<scalar_t> >& A,
+    std::vector< std::vector<int64_t> >& pivots,
+    std::vector< Tile<scalar_t> >& B,
+    std::vector<int64_t>& info,
+    Options const& opts)
+{
+    const scalar_t zero = 0;
+
+    int64_t batch_size = A.size();
+    slate_assert( int64_t( pivots.size() ) == batch_size );
+    slate_assert( int64_t( B.size() ) == batch_size );
+    info.resize( batch_size );
+
+    for (int64_t k = 0; k < batch_size; ++k) {
+        impl::check_tile( A[ k ] );
+        impl::check_tile( B[ k ] );
+        slate_assert( B[ k ].op() == Op::NoTrans );
+    }
+
+    impl::for_each_problem( batch_size, opts, [&]( int64_t k ) {
+        auto& Ak = A[ k ];
+        info[ k ] = 0;
+        for (int64_t i = 0; i < Ak.nb(); ++i) {
+            if (Ak.data()[ i + i*Ak.stride() ] == zero) {
+                info[ k ] = i + 1;
+                return;
+            }
+        }
+        lapack::getrs( Ak.op(), Ak.nb(), B[ k ].nb(),
+                       Ak.data(), Ak.stride(), pivots[ k ].data(),
+                       B[ k ].data(), B[ k ].stride() );
+    } );
+}
+
+//------------------------------------------------------------------------------
+/// Batched QR factorization of independent tiles, $A_k = Q_k R_k$.
+/// See batch::gemm for scheduling and options.
+///
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     Vector of batch_size host, column-major tiles.
+///     On exit, R in the upper triangle and the Householder vectors
+///     of Q below the diagonal, as in LAPACK geqrf.
+///
+/// @param[out] tau
+///     Vector of batch_size vectors. On exit, tau[ k ] has the
+///     Householder scalars for A[ k ].
+///
+/// @ingroup geqrf_computational
+///
+template <typename scalar_t>
+void geqrf(
+    std::vector< Tile<scalar_t> >& A,
+    std::vector< std::vector<scalar_t> >& tau,
+    Options const& opts)
+{
+    int64_t batch_size = A.size();
+    tau.resize( batch_size );
+
+    for (int64_t k = 0; k < batch_size; ++k) {
+        impl::check_tile( A[ k ] );
+        slate_assert( A[ k ].op() == Op::NoTrans );
+    }
+
+    impl::for_each_problem( batch_size, opts, [&]( int64_t k ) {
+        auto& Ak = A[ k ];
+        tau[ k ].resize( std::min( Ak.mb(), Ak.nb() ) );
+        lapack::geqrf( Ak.mb(), Ak.nb(), Ak.data(), Ak.stride(),
+                       tau[ k ].data() );
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+// ----------------------------------------
+template
+void gemm<float>(
+    float alpha, std::vector< Tile<float> >& A,
+                 std::vector< Tile<float> >& B,
+    float beta,  std::vector< Tile<float> >& C,
+    Options const& opts);
+
+template
+void gemm<double>(
+    double alpha, std::vector< Tile<double> >& A,
+                  std::vector< Tile<double> >& B,
+    double beta,  std::vector< Tile<double> >& C,
+    Options const& opts);
+
+template
+void gemm< std::complex<float> >(
+    std::complex<float> alpha, std::vector< Tile< std::complex<float> > >& A,
+                               std::vector< Tile< std::complex<float> > >& B,
+    std::complex<float> beta,  std::vector< Tile< std::complex<float> > >& C,
+    Options const& opts);
+
+template
+void gemm< std::complex<double> >(
+    std::complex<double> alpha, std::vector< Tile< std::complex<double> > >& A,
+                                std::vector< Tile< std::complex<double> > >& B,
+    std::complex<double> beta,  std::vector< Tile< std::complex<double> > >& C,
+    Options const& opts);
+
+// ----------------------------------------
+template
+void potrf<float>(
+    std::vector< Tile<float> >& A,
+    std::vector<int64_t>& info,
+    Options const& opts);
+
+template
+void potrf<double>(
+    std::vector< Tile<double> >& A,
+    std::vector<int64_t>& info,
+    Options const& opts);
+
+template
+void potrf< std::complex<float> >(
+    std::vector< Tile< std::complex<float> > >& A,
+    std::vector<int64_t>& info,
+    Options const& opts);
+
+template
+void potrf< std::complex<double> >(
+    std::vector< Tile< std::complex<double> > >& A,
+    std::vector<int64_t>& info,
+    Options const& opts);
+
+// ----------------------------------------
+template
+void potrs<float>(
+    std::vector< Tile<float> >& A,
+    std::vector< Tile<float> >& B,
+    std::vector<int64_t>& info,
+    Options const& opts);
+
+template
+void potrs<double>(
+    std::vector< Tile<double> >& A,
+    std::vector< Tile<double> >& B,
+    std::vector<int64_t>& info,
+    Options const& opts);
+
+template
+void potrs< std::complex<float> >(
+    std::vector< Tile< std::complex<float> > >& A,
+    std::vector< Tile< std::complex<float> > >& B,
+    std::vector<int64_t>& info,
+    Options const& opts);
+
+template
+void potrs< std::complex<double> >(
+    std::vector< Tile< std::complex<double> > >& A,
+    std::vector< Tile< std::complex<double> > >& B,
+    std::vector<int64_t>& info,
+    Options const& opts);
+
+// ----------------------------------------
+template
+void getrf<float>(
+    std::vector< Tile<float> >& A,
+    std::vector< std::vector<int64_t> >& pivots,
+    std::vector<int64_t>& info,
+    Options const& opts);
+
+template
+void getrf<double>(
+    std::vector< Tile<double> >& A,
+    std::vector< std::vector<int64_t> >& pivots,
+    std::vector<int64_t>& info,
+    Options const& opts);
+
+template
+void getrf< std::complex<float> >(
+    std::vector< Tile< std::complex<float> > >& A,
+    std::vector< std::vector<int64_t> >& pivots,
+    std::vector<int64_t>& info,
+    Options const& opts);
+
+template
+void getrf< std::complex<double> >(
+    std::vector< Tile< std::complex<double> > >& A,
+    std::vector< std::vector<int64_t> >& pivots,
+    std::vector<int64_t>& info,
+    Options const& opts);
+
+// ----------------------------------------
+template
+void getrs<float>(
+    std::vector< Tile<float> >& A,
+    std::vector< std::vector<int64_t> >& pivots,
+    std::vector< Tile<float> >& B,
+    std::vector<int64_t>& info,
+    Options const& opts);
+
+template
+void getrs<double>(
+    std::vector< Tile<double> >& A,
+    std::vector< std::vector<int64_t> >& pivots,
+    std::vector< Tile<double> >& B,
+    std::vector<int64_t>& info,
+    Options const& opts);
+
+template
+void getrs< std::complex<float> >(
+    std::vector< Tile< std::complex<float> > >& A,
+    std::vector< std::vector<int64_t> >& pivots,
+    std::vector< Tile< std::complex<float> > >& B,
+    std::vector<int64_t>& info,
+    Options const& opts);
+
+template
+void getrs< std::complex<double> >(
+    std::vector< Tile< std::complex<double> > >& A,
+    std::vector< std::vector<int64_t> >& pivots,
+    std::vector< Tile< std::complex<double> > >& B,
+    std::vector<int64_t>& info,
+    Options const& opts);
+
+// ----------------------------------------
+template
+void geqrf<float>(
+    std::vector< Tile<float> >& A,
+    std::vector< std::vector< float > >& tau,
+    Options const& opts);
+
+template
+void geqrf<double>(
+    std::vector< Tile<double> >& A,
+    std::vector< std::vector< double > >& tau,
+    Options const& opts);
+
+template
+void geqrf< std::complex<float> >(
+    std::vector< Tile< std::complex<float> > >& A,
+    std::vector< std::vector< std::complex<float> > >& tau,
+    Options const& opts);
+
+template
+void geqrf< std::complex<double> >(
+    std::vector< Tile< std::complex<double> > >& A,
+    std::vector< std::vector< std::complex<double> > >& tau,
+    Options const& opts);
+
+} // namespace batch
+} // namespace slate
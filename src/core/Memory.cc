@@ -4,11 +4,22 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "auxiliary/Debug.hh"
+#include "slate/internal/DryRun.hh"
 #include "slate/internal/Memory.hh"
 
+#include <new>
+
+#ifdef SLATE_HAVE_NUMA
+    #include <numa.h>
+    #include <numaif.h>
+    #include <unistd.h>
+#endif
+
 namespace slate {
 
 int Memory::num_devices_;
+int Memory::num_numa_domains_;
+std::vector<int> Memory::numa_nodes_;
 Memory::StaticConstructor Memory::static_constructor_;
 
 //------------------------------------------------------------------------------
@@ -115,17 +126,71 @@ void Memory::clearDeviceBlocks(int device, blas::Queue *queue)
     Debug::checkDeviceMemoryLeaks(*this, device);
 }
 
+//------------------------------------------------------------------------------
+/// @return NUMA nodes that the process may allocate memory on, as
+/// restricted by cpusets or numactl --membind, e.g., when several MPI
+/// ranks share a node. Returns one node, 0, if SLATE was built without
+/// libnuma or the system does not support NUMA policies.
+///
+std::vector<int> Memory::allowed_numa_nodes()
+{
+    std::vector<int> nodes;
+#ifdef SLATE_HAVE_NUMA
+    if (numa_available() >= 0) {
+        struct bitmask* allowed = numa_get_mems_allowed();
+        for (int node = 0; node <= numa_max_node(); ++node) {
+            if (numa_bitmask_isbitset( allowed, node ))
+                nodes.push_back( node );
+        }
+        numa_bitmask_free( allowed );
+    }
+#endif
+    if (nodes.empty())
+        nodes.push_back( 0 );
+    return nodes;
+}
+
 //------------------------------------------------------------------------------
 /// @return single block of memory on the given device, which can be host,
 /// either from free blocks or by allocating a new block.
 ///
-void* Memory::alloc(int device, size_t size, blas::Queue* queue)
+/// @param[in] numa_domain
+///     For host blocks, the NUMA domain that should hold the block's pages,
+///     or -1 for no preference (first touch). Domains are numbered among
+///     the nodes the process may allocate on. Ignored without libnuma.
+///
+void* Memory::alloc(int device, size_t size, blas::Queue* queue,
+                    int numa_domain)
 {
     void* block;
 
     if (device == HostNum) {
+        if (DryRun::enabled())
+            return DryRun::hostAlloc( size );
+#ifdef SLATE_HAVE_NUMA
+        // Blocks of at least a page are page aligned and padded to whole
+        // pages, so the memory policy set here affects no other block.
+        // Pages are placed on the preferred domain at first touch.
+        size_t page = sysconf( _SC_PAGESIZE );
+        bool place = numa_domain >= 0 && num_numa_domains_ > 1
+                     && size >= page;
+        size_t align = place ? page : 64;
+        size_t bytes = place ? (size + page - 1) / page * page : size;
+        if (posix_memalign( &block, align, bytes ) != 0)
+            throw std::bad_alloc();
+        if (place) {
+            struct bitmask* nodes = numa_allocate_nodemask();
+            numa_bitmask_setbit(
+                nodes, numa_nodes_[ numa_domain % num_numa_domains_ ] );
+            // Failure only loses the placement, not the memory.
+            mbind( block, bytes, MPOL_PREFERRED, nodes->maskp,
+                   nodes->size + 1, 0 );
+            numa_free_nodemask( nodes );
+        }
+#else
         //block = malloc(size);
         block = new char[size];
+#endif
     }
     else {
         // this block for device only
@@ -150,8 +215,14 @@ void* Memory::alloc(int device, size_t size, blas::Queue* queue)
 void Memory::free(void* block, int device)
 {
     if (device == HostNum) {
+        if (DryRun::hostFree( block ))
+            return;
+#ifdef SLATE_HAVE_NUMA
+        std::free(block);
+#else
         //std::free(block);
         delete[] (char*)block;
+#endif
     }
     else {
         #pragma omp critical(slate_memory)
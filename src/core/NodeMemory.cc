@@ -0,0 +1,223 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/internal/NodeMemory.hh"
+#include "slate/internal/openmp.hh"
+#include "internal/internal_util.hh"
+
+#include <cassert>
+#include <new>
+
+namespace slate {
+
+namespace {
+
+/// Alignment of blocks in the window, a cache line.
+const size_t alignment = 64;
+
+inline size_t round_up(size_t size)
+{
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+/// Allocates num_blocks blocks of block_size bytes for each rank in a window
+/// shared by the ranks of comm on the same node. Collective over comm.
+///
+NodeMemory::NodeMemory(MPI_Comm comm, size_t block_size, int64_t num_blocks)
+    : node_comm_(MPI_COMM_NULL),
+      win_(MPI_WIN_NULL),
+      block_size_(round_up(block_size)),
+      num_blocks_(0),
+      header_size_(0),
+      segment_size_(0),
+      node_rank_(0),
+      block_indices_(1, -1),
+      next_(0)
+{
+    slate_assert(num_blocks >= 0);
+
+    int mpi_rank, mpi_size;
+    slate_mpi_call(
+        MPI_Comm_rank(comm, &mpi_rank));
+    slate_mpi_call(
+        MPI_Comm_size(comm, &mpi_size));
+
+    node_ids_ = internal::mpi_node_ids(comm);
+
+    slate_mpi_call(
+        MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, mpi_rank,
+                            MPI_INFO_NULL, &node_comm_));
+    int node_size;
+    slate_mpi_call(
+        MPI_Comm_rank(node_comm_, &node_rank_));
+    slate_mpi_call(
+        MPI_Comm_size(node_comm_, &node_size));
+
+    node_ranks_.assign(mpi_size, -1);
+    node_ranks_[ mpi_rank ] = node_rank_;
+    if (node_size == 1) {
+        // Nothing to share.
+        return;
+    }
+
+    // Map ranks in comm to ranks in node_comm_.
+    MPI_Group group, node_group;
+    std::vector<int> ranks(mpi_size);
+    for (int rank = 0; rank < mpi_size; ++rank)
+        ranks[ rank ] = rank;
+    slate_mpi_call(
+        MPI_Comm_group(comm, &group));
+    slate_mpi_call(
+        MPI_Comm_group(node_comm_, &node_group));
+    slate_mpi_call(
+        MPI_Group_translate_ranks(group, mpi_size, ranks.data(),
+                                  node_group, node_ranks_.data()));
+    slate_mpi_call(
+        MPI_Group_free(&group));
+    slate_mpi_call(
+        MPI_Group_free(&node_group));
+    for (auto& node_rank : node_ranks_) {
+        if (node_rank == MPI_UNDEFINED)
+            node_rank = -1;
+    }
+
+    // Segment: reference counts, then blocks.
+    num_blocks_ = num_blocks;
+    header_size_ = round_up(sizeof(count_t) * num_blocks_);
+    segment_size_ = header_size_ + block_size_ * num_blocks_;
+    for (int64_t k = 0; k < num_blocks_; ++k)
+        block_indices_.push_back(k);
+
+    char* base;
+    slate_mpi_call(
+        MPI_Win_allocate_shared(MPI_Aint(segment_size_), 1, MPI_INFO_NULL,
+                                node_comm_, &base, &win_));
+    for (int64_t k = 0; k < num_blocks_; ++k)
+        new (&((count_t*) base)[ k ]) count_t(0);
+
+    bases_.resize(node_size);
+    for (int node_rank = 0; node_rank < node_size; ++node_rank) {
+        MPI_Aint size;
+        int disp_unit;
+        slate_mpi_call(
+            MPI_Win_shared_query(win_, node_rank, &size, &disp_unit,
+                                 &bases_[ node_rank ]));
+    }
+
+    // Passive epoch for the window's lifetime; sync() orders accesses.
+    slate_mpi_call(
+        MPI_Win_lock_all(MPI_MODE_NOCHECK, win_));
+    slate_mpi_call(
+        MPI_Barrier(node_comm_));
+}
+
+//------------------------------------------------------------------------------
+/// Frees the window. Collective over comm. All blocks should be released.
+///
+NodeMemory::~NodeMemory()
+{
+    try {
+        if (win_ != MPI_WIN_NULL) {
+            slate_mpi_call(
+                MPI_Win_unlock_all(win_));
+            slate_mpi_call(
+                MPI_Win_free(&win_));
+        }
+        slate_mpi_call(
+            MPI_Comm_free(&node_comm_));
+    }
+    catch (std::exception const& ex) {
+        // Destructors should not throw errors.
+        assert(false);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Allocates a block in this rank's segment, referenced by count ranks.
+///
+/// @return index of the block, or -1 if all blocks are in use.
+///
+int64_t NodeMemory::alloc(int64_t count)
+{
+    slate_assert(count > 0);
+    int64_t block = -1;
+    #pragma omp critical(slate_node_memory)
+    {
+        count_t* my_counts = counts(node_rank_);
+        for (int64_t k = 0; k < num_blocks_; ++k) {
+            int64_t index = (next_ + k) % num_blocks_;
+            if (my_counts[ index ].load(std::memory_order_acquire) == 0) {
+                my_counts[ index ].store(count, std::memory_order_relaxed);
+                block = index;
+                next_ = (index + 1) % num_blocks_;
+                break;
+            }
+        }
+    }
+    return block;
+}
+
+//------------------------------------------------------------------------------
+/// @return pointer to block allocated by rank (in comm), which must be
+/// on this node.
+///
+void* NodeMemory::data(int rank, int64_t block) const
+{
+    int node_rank = node_ranks_[ rank ];
+    slate_assert(node_rank >= 0);
+    slate_assert(0 <= block && block < num_blocks_);
+    return bases_[ node_rank ] + header_size_ + block * block_size_;
+}
+
+//------------------------------------------------------------------------------
+/// @return whether ptr is in a block of any segment on this node.
+///
+bool NodeMemory::contains(void const* ptr) const
+{
+    char const* p = (char const*) ptr;
+    for (auto base : bases_) {
+        if (base + header_size_ <= p && p < base + segment_size_)
+            return true;
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+/// Drops one reference to the block containing ptr. The last release
+/// makes the block available to its owner's alloc().
+///
+void NodeMemory::release(void const* ptr)
+{
+    char const* p = (char const*) ptr;
+    for (int node_rank = 0; node_rank < int(bases_.size()); ++node_rank) {
+        char* base = bases_[ node_rank ];
+        if (base + header_size_ <= p && p < base + segment_size_) {
+            int64_t block = (p - base - header_size_) / block_size_;
+            int64_t count = counts(node_rank)[ block ].fetch_sub(
+                1, std::memory_order_acq_rel );
+            slate_assert(count > 0);
+            return;
+        }
+    }
+    slate_error("pointer not in node memory");
+}
+
+//------------------------------------------------------------------------------
+/// Synchronizes this rank's view of the window with other ranks' writes,
+/// given a message after the writes. Called by writers before sending and
+/// readers after receiving.
+///
+void NodeMemory::sync()
+{
+    if (win_ != MPI_WIN_NULL) {
+        slate_mpi_call(
+            MPI_Win_sync(win_));
+    }
+}
+
+} // namespace slate
@@ -0,0 +1,157 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/internal/TileWindow.hh"
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+
+namespace slate {
+
+namespace {
+
+/// Number of int64_t values per tile exchanged by publish().
+const int entry_size = 5;
+
+} // namespace
+
+//------------------------------------------------------------------------------
+/// Creates an empty dynamic window over comm. Collective over comm.
+///
+TileWindow::TileWindow(MPI_Comm comm)
+    : comm_(comm),
+      win_(MPI_WIN_NULL)
+{
+    slate_mpi_call(
+        MPI_Win_create_dynamic(MPI_INFO_NULL, comm_, &win_));
+    slate_mpi_call(
+        MPI_Win_lock_all(MPI_MODE_NOCHECK, win_));
+}
+
+//------------------------------------------------------------------------------
+/// Detaches all tiles and frees the window. Collective over comm.
+///
+TileWindow::~TileWindow()
+{
+    try {
+        slate_mpi_call(
+            MPI_Win_unlock_all(win_));
+        for (auto base : attached_) {
+            slate_mpi_call(
+                MPI_Win_detach(win_, base));
+        }
+        slate_mpi_call(
+            MPI_Win_free(&win_));
+    }
+    catch (std::exception const& ex) {
+        // Destructors should not throw errors.
+        assert(false);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Adds local tile {i, j}, whose data spans bytes starting at data,
+/// to be exposed by the next publish().
+///
+void TileWindow::add(
+    int64_t i, int64_t j, void const* data, size_t bytes,
+    int64_t stride, Layout layout)
+{
+    char const* begin = (char const*) data;
+    ranges_.push_back({ begin, begin + bytes });
+
+    MPI_Aint address;
+    slate_mpi_call(
+        MPI_Get_address(data, &address));
+    local_.insert(local_.end(),
+                  { i, j, int64_t(address), stride, int64_t(layout) });
+}
+
+//------------------------------------------------------------------------------
+/// Attaches tiles added since the last publish() and exchanges their
+/// locations with all ranks. Collective over comm.
+///
+void TileWindow::publish()
+{
+    // Tiles of a ScaLAPACK matrix interleave, and attached regions must
+    // not overlap, so attach the union of the ranges.
+    std::sort(ranges_.begin(), ranges_.end());
+    for (size_t k = 0; k < ranges_.size(); /* incremented below */) {
+        char const* begin = ranges_[ k ].first;
+        char const* end   = ranges_[ k ].second;
+        for (++k; k < ranges_.size() && ranges_[ k ].first <= end; ++k)
+            end = std::max(end, ranges_[ k ].second);
+        slate_mpi_call(
+            MPI_Win_attach(win_, (void*) begin, MPI_Aint(end - begin)));
+        attached_.push_back(begin);
+    }
+    ranges_.clear();
+
+    int mpi_size;
+    slate_mpi_call(
+        MPI_Comm_size(comm_, &mpi_size));
+
+    std::vector<int64_t> all;
+    std::vector<int> counts(mpi_size), displs(mpi_size);
+    if (mpi_size == 1) {
+        all = local_;
+        counts[ 0 ] = local_.size();
+    }
+    else {
+        int count = local_.size();
+        slate_mpi_call(
+            MPI_Allgather(&count, 1, MPI_INT,
+                          counts.data(), 1, MPI_INT, comm_));
+        int total = 0;
+        for (int rank = 0; rank < mpi_size; ++rank) {
+            displs[ rank ] = total;
+            total += counts[ rank ];
+        }
+        all.resize(total);
+        slate_mpi_call(
+            MPI_Allgatherv(local_.data(), count, MPI_INT64_T,
+                           all.data(), counts.data(), displs.data(),
+                           MPI_INT64_T, comm_));
+    }
+    local_.clear();
+
+    int64_t k = 0;
+    for (int rank = 0; rank < mpi_size; ++rank) {
+        for (int64_t end = k + counts[ rank ]; k < end; k += entry_size) {
+            Entry entry;
+            entry.rank    = rank;
+            entry.address = MPI_Aint(all[ k+2 ]);
+            entry.stride  = all[ k+3 ];
+            entry.layout  = Layout(all[ k+4 ]);
+            entries_[ { all[ k ], all[ k+1 ] } ] = entry;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @return location of tile {i, j}. Throws if the tile is not exposed.
+///
+TileWindow::Entry const& TileWindow::at(ij_tuple ij) const
+{
+    auto iter = entries_.find(ij);
+    if (iter == entries_.end()) {
+        slate_error("tile (" + std::to_string(std::get<0>(ij)) + ", "
+                    + std::to_string(std::get<1>(ij))
+                    + ") is not in the tile window");
+    }
+    return iter->second;
+}
+
+//------------------------------------------------------------------------------
+/// Completes all gets from rank.
+///
+void TileWindow::flush(int rank)
+{
+    slate_mpi_call(
+        MPI_Win_flush(rank, win_));
+}
+
+} // namespace slate
@@ -0,0 +1,172 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/internal/openmp.hh"
+
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace slate {
+namespace async {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// FIFO of routines executed by a single worker thread.
+/// The worker starts on the first enqueue after construction or finish.
+class Queue {
+public:
+    /// Queued routines make MPI calls, so they must be finished, with
+    /// async::wait_all, before MPI_Finalize, not here at exit.
+    ~Queue()
+    {
+        assert( pending_ == 0 );
+        finish();
+    }
+
+    Future push( std::function<void ()> routine )
+    {
+        std::packaged_task<void ()> task( std::move( routine ) );
+        Future future = task.get_future().share();
+        {
+            std::lock_guard<std::mutex> guard( mutex_ );
+            if (! worker_.joinable()) {
+                check_mpi_thread();
+                worker_ = std::thread( &Queue::run, this );
+            }
+            tasks_.push_back( std::move( task ) );
+            ++pending_;
+        }
+        ready_.notify_one();
+        return future;
+    }
+
+    /// Finishes all queued routines and joins the worker.
+    void finish()
+    {
+        std::thread worker;
+        {
+            std::lock_guard<std::mutex> guard( mutex_ );
+            done_ = true;
+            worker = std::move( worker_ );
+        }
+        ready_.notify_one();
+        if (worker.joinable())
+            worker.join();
+
+        std::lock_guard<std::mutex> guard( mutex_ );
+        assert( pending_ == 0 );
+        done_ = false;
+    }
+
+    /// Sets the OpenMP team size for routines that start after this call.
+    void num_threads( int num_threads )
+    {
+        std::lock_guard<std::mutex> guard( mutex_ );
+        num_threads_ = num_threads;
+    }
+
+private:
+    /// Routines make MPI calls from the worker thread.
+    static void check_mpi_thread()
+    {
+        int initialized = 0;
+        slate_mpi_call( MPI_Initialized( &initialized ) );
+        if (initialized) {
+            int provided = 0;
+            slate_mpi_call( MPI_Query_thread( &provided ) );
+            if (provided != MPI_THREAD_MULTIPLE)
+                slate_error( "async routines require MPI_THREAD_MULTIPLE" );
+        }
+    }
+
+    void run()
+    {
+        while (true) {
+            std::packaged_task<void ()> task;
+            int num_threads;
+            {
+                std::unique_lock<std::mutex> lock( mutex_ );
+                ready_.wait( lock, [this] { return done_ || ! tasks_.empty(); } );
+                if (tasks_.empty())
+                    return;  // done_
+                task = std::move( tasks_.front() );
+                tasks_.pop_front();
+                num_threads = num_threads_;
+            }
+            // Sets the worker thread's ICV, not the caller's.
+            if (num_threads > 0)
+                omp_set_num_threads( num_threads );
+            // Exceptions are stored in the task's future.
+            task();
+            {
+                std::lock_guard<std::mutex> guard( mutex_ );
+                --pending_;
+            }
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque< std::packaged_task<void ()> > tasks_;
+    std::thread worker_;
+    int64_t pending_ = 0;  ///< routines enqueued but not finished
+    int num_threads_ = 0;  ///< worker's OpenMP team size; 0 is the default
+    bool done_ = false;
+};
+
+//------------------------------------------------------------------------------
+Queue& queue()
+{
+    static Queue queue_;
+    return queue_;
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Enqueues a routine to run after all previously enqueued routines.
+///
+/// @param[in] routine
+///     Callable to run on the worker thread. It should capture matrices
+///     by value (shallow copies).
+///
+/// @return Future that is ready when the routine finishes.
+///
+Future enqueue( std::function<void ()> routine )
+{
+    return impl::queue().push( std::move( routine ) );
+}
+
+//------------------------------------------------------------------------------
+/// Waits for all enqueued routines to finish, and stops the worker thread.
+/// Must be called before MPI_Finalize if any routines were enqueued,
+/// and not concurrently with enqueue. Later enqueues start a new worker.
+///
+void wait_all()
+{
+    impl::queue().finish();
+}
+
+//------------------------------------------------------------------------------
+/// Sets the number of OpenMP threads that routines use on the worker thread,
+/// e.g., to leave cores for the caller's own OpenMP work.
+/// Applies to routines that start after this call.
+///
+/// @param[in] num_threads
+///     Team size for routines; 0 uses the OpenMP default [default].
+///
+void set_num_threads( int num_threads )
+{
+    slate_assert( num_threads >= 0 );
+    impl::queue().num_threads( num_threads );
+}
+
+} // namespace async
+} // namespace slate
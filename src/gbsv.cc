@@ -30,6 +30,16 @@ namespace slate {
 /// and $U$ is upper triangular. The factored form of $A$ is then used to solve
 /// the system of equations $A X = B$.
 ///
+/// With Option::MethodBand = MethodBand::Spike, a partitioned (SPIKE) solver
+/// is used instead, which scales with the number of cores and ranks for
+/// narrow bands. Rows are distributed 1D in contiguous partitions, each
+/// partition is factored independently, and a small reduced system couples
+/// the partitions. Pivoting is only within partitions, so each diagonal
+/// block of the partitioning must be nonsingular, e.g., $A$ is diagonally
+/// dominant. In this case, $A$ is not modified and pivots is empty.
+/// If a diagonal block or the reduced system is singular, the solve falls
+/// back to gbtrf and gbtrs, as with MethodBand::Tiled.
+///
 //------------------------------------------------------------------------------
 /// @tparam scalar_t
 ///     One of float, double, std::complex<float>, std::complex<double>.
@@ -45,6 +55,9 @@ namespace slate {
 ///
 /// @param[out] pivots
 ///     The pivot indices that define the permutation matrix $P$.
+///     With MethodBand::Spike, pivots is cleared, as A is not factored in
+///     place; A and pivots cannot be passed to gbtrs afterwards,
+///     unless the solve fell back to gbtrf, leaving pivots non-empty.
 ///
 /// @param[in,out] B
 ///     On entry, the n-by-nrhs right hand side matrix $B$.
@@ -52,6 +65,10 @@ namespace slate {
 ///
 /// @param[in] opts
 ///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::MethodBand:
+///       Band solver algorithm. Possible values:
+///       - MethodBand::Tiled: tiled factorization, gbtrf and gbtrs [default].
+///       - MethodBand::Spike: partitioned SPIKE solver, on the host.
 ///     - Option::Lookahead:
 ///       Number of panels to overlap with matrix updates.
 ///       lookahead >= 0. Default 1.
@@ -82,6 +99,19 @@ void gbsv(BandMatrix<scalar_t>& A, Pivots& pivots,
     slate_assert(A.mt() == A.nt());  // square
     slate_assert(B.mt() == A.mt());
 
+    Method method = get_option( opts, Option::MethodBand, MethodBand::Tiled );
+
+    if (method == MethodBand::Spike) {
+        pivots.clear();
+        // On failure, A and B are unchanged; fall back to pivoting
+        // across partitions.
+        if (internal::gbsv_spike( A, B, opts ) == 0)
+            return;
+    }
+    else if (method != MethodBand::Tiled) {
+        throw Exception( "unknown value for MethodBand" );
+    }
+
     // factorization
     gbtrf(A, pivots, opts);
 
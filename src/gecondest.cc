@@ -46,6 +46,12 @@ namespace slate {
 ///
 /// @param[in] opts
 ///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::CondEstColumns:
+///       Number of columns t in the block 1-norm estimator, >= 1.
+///       Larger t gives a more reliable estimate, at the cost of
+///       solving with t right-hand sides per iteration. Default 2.
+///       t = 1 uses the single-vector estimator of LAPACK lacn2,
+///       as ScaLAPACK does.
 ///     - Option::Target:
 ///       Implementation to target. Possible values:
 ///       - HostTask:  OpenMP tasks on CPU host [default].
@@ -87,6 +93,7 @@ void gecondest(
     *rcond = 0.;
     if (m == 0) {
         *rcond = 1.;
+        return;
     }
     else if (*Anorm == 0.) {
         return;
@@ -103,21 +110,43 @@ void gecondest(
     int64_t mloc  = numberLocalRowOrCol(m, nb, myrow, izero, p);
     int64_t lldA  = blas::max(1, mloc);
 
-    std::vector<scalar_t> X_data(lldA);
+    // Block estimator with t columns, each iteration solving t RHS at once.
+    int64_t t = get_option<int64_t>( opts, Option::CondEstColumns, 2 );
+    t = std::max( int64_t( 1 ), std::min( t, m ) );
+
+    std::vector<scalar_t> X_data(lldA*t);
+    std::vector<scalar_t> S_data(lldA*t);
     std::vector<scalar_t> V_data(lldA);
     std::vector<int64_t> isgn_data(lldA);
-    std::vector<int64_t> isave(3);
-    isave[0] = 0;
-    isave[1] = 0;
-    isave[2] = 0;
+    std::vector<int64_t> isave;
+    if (t == 1)
+        isave.assign( 3, 0 );
 
+    // X and S have one block column of width t.
     auto X = slate::Matrix<scalar_t>::fromScaLAPACK(
-            m, 1, &X_data[0], lldA, nb, 1, p, q, A.mpiComm() );
+            m, t, &X_data[0], lldA, nb, t, p, q, A.mpiComm() );
+    auto S = slate::Matrix<scalar_t>::fromScaLAPACK(
+            m, t, &S_data[0], lldA, nb, t, p, q, A.mpiComm() );
     auto V = slate::Matrix<scalar_t>::fromScaLAPACK(
             m, 1, &V_data[0], lldA, nb, 1, p, q, A.mpiComm() );
     auto isgn = slate::Matrix<int64_t>::fromScaLAPACK(
             m, 1, &isgn_data[0], lldA, nb, 1, p, q, A.mpiComm() );
 
+    // The single-vector estimator decides on the rank owning X(0, 0),
+    // which broadcasts its state; the block estimator's decisions agree
+    // on all ranks.
+    auto estimate = [&]() {
+        if (t == 1) {
+            internal::norm1est( X, V, isgn, &Ainvnorm, &kase, isave, opts );
+            MPI_Bcast( &isave[0], 3, MPI_INT64_T, X.tileRank(0, 0),
+                       A.mpiComm() );
+            MPI_Bcast( &kase, 1, MPI_INT, X.tileRank(0, 0), A.mpiComm() );
+        }
+        else {
+            internal::norm1est_block( X, V, S, &Ainvnorm, &kase, isave, opts );
+        }
+    };
+
     auto L  = TriangularMatrix<scalar_t>(
         Uplo::Lower, slate::Diag::Unit, A );
     auto U  = TriangularMatrix<scalar_t>(
@@ -125,10 +154,7 @@ void gecondest(
 
     // initial and final value of kase is 0
     kase = 0;
-    internal::norm1est( X, V, isgn, &Ainvnorm, &kase, isave, opts);
-
-    MPI_Bcast( &isave[0], 3, MPI_INT64_T, X.tileRank(0, 0), A.mpiComm() );
-    MPI_Bcast( &kase, 1, MPI_INT, X.tileRank(0, 0), A.mpiComm() );
+    estimate();
 
     while (kase != 0)
     {
@@ -149,9 +175,7 @@ void gecondest(
             slate::trsmB(Side::Left, alpha, LH, X, opts);
         }
 
-        internal::norm1est( X, V, isgn, &Ainvnorm, &kase, isave, opts);
-        MPI_Bcast( &isave[0], 3, MPI_INT64_T, X.tileRank(0, 0), A.mpiComm() );
-        MPI_Bcast( &kase, 1, MPI_INT, X.tileRank(0, 0), A.mpiComm() );
+        estimate();
     } // while (kase != 0)
 
     // Compute the estimate of the reciprocal condition number.
@@ -53,12 +53,33 @@ namespace slate {
 ///           - Auto: let the routine decides [default]
 ///           - gemmA: select gemmA routine
 ///           - gemmC: select gemmC routine
+///           - Strassen: select gemm_strassen routine; never chosen by Auto,
+///             as it is less accurate than gemmA and gemmC
+///         - Option::StrassenDepth:
+///           With Strassen, levels of recursion. Default 1.
 ///         - Option::Target:
 ///           Implementation to target. Possible values:
 ///           - HostTask:  OpenMP tasks on CPU host [default].
 ///           - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///           - HostBatch: batched BLAS on CPU host.
 ///           - Devices:   batched BLAS on GPU device.
+///         - Option::PackedGemm:
+///           With HostTask, pack shared A and B tiles once per update and
+///           reuse them across C tiles (Intel MKL, real precisions).
+///           Default false.
+///         - Option::ComplexGemm:
+///           With HostTask and complex types, how to multiply tiles
+///           (gemmC):
+///           - Native: complex gemm [default].
+///           - Real4M: 4 real gemms on split real and imaginary parts.
+///           - Real3M: 3 real gemms, 25% fewer flops, less accurate.
+///         - Option::OzakiSlices:
+///           With HostTask and double, emulate double-precision tile gemm
+///           with single-precision gemm on this many slices of each tile
+///           (Ozaki scheme, gemmC). More slices are more accurate:
+///           8 slices match double precision for nb <= 1024, using
+///           36 single-precision gemms per tile product; fewer are faster.
+///           Default 0: native double-precision gemm.
 ///
 /// @ingroup gemm
 ///
@@ -84,6 +105,9 @@ void gemm(scalar_t alpha, Matrix<scalar_t>& A,
         case MethodGemm::GemmC:
             gemmC( alpha, A, B, beta, C, tuned_opts );
             break;
+        case MethodGemm::Strassen:
+            gemm_strassen( alpha, A, B, beta, C, tuned_opts );
+            break;
     }
 }
 
@@ -6,6 +6,7 @@
 #include "slate/slate.hh"
 #include "internal/internal.hh"
 #include "internal/internal_batch.hh"
+#include "internal/internal_util.hh"
 #include "auxiliary/Debug.hh"
 
 #include <list>
@@ -53,6 +54,9 @@ void gemmA(
     // XXX This should be removed later, based on Kadir's comment.
     local_opts[ Option::TileReleaseStrategy ] = tileStrategy;
 
+    // Shape of the reductions of C; collective if node-aware.
+    internal::ReducePlan reduce_plan = internal::reducePlan( opts, C.mpiComm() );
+
     // OpenMP needs pointer types, but vectors are exception safe
     std::vector<uint8_t> bcast_vector( A.nt() );
     std::vector<uint8_t> gemmA_vector( A.nt() );
@@ -129,7 +133,7 @@ void gemmA(
                                           {A.sub( i, i, 0, A.nt()-1 )}
                                         } );
             int tag_0 = 0;
-            C.template listReduce( reduce_list_C, layout, tag_0 );
+            C.template listReduce( reduce_list_C, layout, tag_0, reduce_plan );
         }
         // Clean the memory introduced by internal::gemmA on Devices
         if (target == Target::Devices) {
@@ -192,7 +196,8 @@ void gemmA(
                                               {A.sub( i, i, 0, A.nt()-1 )}
                                             } );
                 int tag_k = k;
-                C.template listReduce( reduce_list_C, layout, tag_k );
+                C.template listReduce( reduce_list_C, layout, tag_k,
+                                      reduce_plan );
             }
             // Clean the memory introduced by internal::gemmA on Devices
             if (target == Target::Devices) {
@@ -271,6 +276,16 @@ void gemmA(
 ///           - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///           - HostBatch: batched BLAS on CPU host.
 ///           - Devices:   batched BLAS on GPU device.
+///         - Option::ReduceRadix:
+///           Radix of the trees reducing partial C tiles. Default 2.
+///         - Option::ReduceSegment:
+///           Number of elements per message when reducing C tiles;
+///           larger tiles are pipelined in segments. Default 0 (whole tiles).
+///         - Option::ReduceScatter:
+///           Spread the roots of reductions over the ranks sharing them,
+///           then send sums to the owners. Default false.
+///         - Option::ReduceNodeAware:
+///           Reduce within each node, then across nodes. Default false.
 ///
 /// @ingroup gemm
 ///
@@ -242,6 +242,19 @@ void gemmC(
 ///           - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///           - HostBatch: batched BLAS on CPU host.
 ///           - Devices:   batched BLAS on GPU device.
+///         - Option::PackedGemm:
+///           With HostTask, pack shared A and B tiles once per update and
+///           reuse them across C tiles (Intel MKL, real precisions).
+///           Default false.
+///         - Option::ComplexGemm:
+///           With HostTask and complex types, how to multiply tiles:
+///           - Native: complex gemm [default].
+///           - Real4M: 4 real gemms on split real and imaginary parts.
+///           - Real3M: 3 real gemms, 25% fewer flops, less accurate.
+///         - Option::OzakiSlices:
+///           With HostTask and double, emulate double-precision tile gemm
+///           with single-precision gemm on this many slices of each tile;
+///           see slate::gemm. Default 0: native double-precision gemm.
 ///
 /// @ingroup gemm
 ///
@@ -0,0 +1,342 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal.hh"
+
+#include <algorithm>
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// @internal
+/// @return new m-by-n matrix with nb-by-nb tiles on the process grid of C,
+/// or on a p-by-1 grid if C's grid is not 2D block cyclic,
+/// with local tiles inserted on the host.
+///
+/// @ingroup gemm_impl
+///
+template <typename scalar_t>
+Matrix<scalar_t> strassen_workspace(
+    int64_t m, int64_t n, int64_t nb, Matrix<scalar_t>& C )
+{
+    GridOrder order;
+    int p, q, myrow, mycol;
+    C.gridinfo( &order, &p, &q, &myrow, &mycol );
+    if (order == GridOrder::Unknown) {
+        slate_mpi_call(
+            MPI_Comm_size( C.mpiComm(), &p ) );
+        q = 1;
+        order = GridOrder::Col;
+    }
+    Matrix<scalar_t> W( m, n, nb, nb, order, p, q, C.mpiComm() );
+    W.insertLocalTiles();
+    return W;
+}
+
+//------------------------------------------------------------------------------
+/// @internal
+/// @return copy of op(A) in a new workspace from strassen_workspace.
+///
+/// @ingroup gemm_impl
+///
+template <typename scalar_t>
+Matrix<scalar_t> strassen_copy(
+    Matrix<scalar_t> A, int64_t nb, Matrix<scalar_t>& C,
+    Options const& opts )
+{
+    auto W = strassen_workspace( A.m(), A.n(), nb, C );
+    redistribute( A, W, opts );
+    return W;
+}
+
+//------------------------------------------------------------------------------
+/// @internal
+/// Strassen-Winograd matrix multiply, C = alpha A B + beta C, with depth
+/// levels of recursion. Each level splits the even leading part of
+/// A, B, and C into 2-by-2 blocks, copies the blocks into workspaces on
+/// C's process grid, and forms the product with 7 block products and
+/// 15 block additions (Winograd's variant), instead of 8 products.
+/// An odd last row or column of A, B, or C is handled by gemm.
+/// The 7 products are distributed gemms on the whole grid, recursing until
+/// depth is exhausted or a block is smaller than one tile.
+///
+/// @ingroup gemm_impl
+///
+template <typename scalar_t>
+void gemm_strassen(
+    scalar_t alpha, Matrix<scalar_t>& A,
+                    Matrix<scalar_t>& B,
+    scalar_t beta,  Matrix<scalar_t>& C,
+    int64_t depth, int64_t nb, Options const& opts )
+{
+    trace::Block trace_block( "slate::gemm_strassen" );
+
+    // Constants
+    const scalar_t zero = 0.0, one = 1.0;
+
+    int64_t m = C.m();
+    int64_t n = C.n();
+    int64_t k = A.n();
+    int64_t m2 = m / 2;
+    int64_t n2 = n / 2;
+    int64_t k2 = k / 2;
+
+    // With blocks smaller than a tile, the additions and copies cost more
+    // than the product saved.
+    if (depth <= 0 || std::min( { m2, n2, k2 } ) < nb) {
+        gemm( alpha, A, B, beta, C, opts );
+        return;
+    }
+
+    // Blocks of the even leading parts.
+    auto A11 = strassen_copy( A.slice( 0,  m2-1,   0,  k2-1   ), nb, C, opts );
+    auto A12 = strassen_copy( A.slice( 0,  m2-1,   k2, 2*k2-1 ), nb, C, opts );
+    auto A21 = strassen_copy( A.slice( m2, 2*m2-1, 0,  k2-1   ), nb, C, opts );
+    auto A22 = strassen_copy( A.slice( m2, 2*m2-1, k2, 2*k2-1 ), nb, C, opts );
+    auto B11 = strassen_copy( B.slice( 0,  k2-1,   0,  n2-1   ), nb, C, opts );
+    auto B12 = strassen_copy( B.slice( 0,  k2-1,   n2, 2*n2-1 ), nb, C, opts );
+    auto B21 = strassen_copy( B.slice( k2, 2*k2-1, 0,  n2-1   ), nb, C, opts );
+    auto B22 = strassen_copy( B.slice( k2, 2*k2-1, n2, 2*n2-1 ), nb, C, opts );
+
+    // S1 = A21 + A22, S2 = S1 - A11, T1 = B12 - B11, T2 = B22 - T1.
+    auto S1 = strassen_workspace<scalar_t>( m2, k2, nb, C );
+    auto S2 = strassen_workspace<scalar_t>( m2, k2, nb, C );
+    auto T1 = strassen_workspace<scalar_t>( k2, n2, nb, C );
+    auto T2 = strassen_workspace<scalar_t>( k2, n2, nb, C );
+    copy( A22, S1, opts );
+    add( one, A21, one, S1, opts );
+    copy( S1, S2, opts );
+    add( -one, A11, one, S2, opts );
+    copy( B12, T1, opts );
+    add( -one, B11, one, T1, opts );
+    copy( B22, T2, opts );
+    add( -one, T1, one, T2, opts );
+
+    // S3 = A11 - A21 and T3 = B22 - B12 overwrite A21 and B12.
+    add( one, A11, -one, A21, opts );
+    add( one, B22, -one, B12, opts );
+    auto& S3 = A21;
+    auto& T3 = B12;
+
+    // With Pk = alpha (operand products), the blocks of C are
+    // C11 = U1 + beta C11, where U1 = P1 + P2,
+    // C12 = U5 + beta C12, where U5 = U4 + P3, U4 = U2 + P5, U2 = P1 + P6,
+    // C21 = U6 + beta C21, where U6 = U3 - P4, U3 = U2 + P7,
+    // C22 = U7 + beta C22, where U7 = U3 + P5.
+    // Winograd's schedule keeps U2, U3, U4 in place in X and Y, so three
+    // workspaces X, Y, Z hold all products and sums. A product used only
+    // by one block of C accumulates onto beta times that block.
+    // Operands are cleared after their last use.
+    auto X = strassen_workspace<scalar_t>( m2, n2, nb, C );
+    auto Y = strassen_workspace<scalar_t>( m2, n2, nb, C );
+    auto Z = strassen_workspace<scalar_t>( m2, n2, nb, C );
+
+    auto C11 = C.slice( 0,  m2-1,   0,  n2-1   );
+    auto C12 = C.slice( 0,  m2-1,   n2, 2*n2-1 );
+    auto C21 = C.slice( m2, 2*m2-1, 0,  n2-1   );
+    auto C22 = C.slice( m2, 2*m2-1, n2, 2*n2-1 );
+
+    // X = P1 = A11 B11.
+    gemm_strassen( alpha, A11, B11, zero, X, depth-1, nb, opts );
+    A11.clear();
+    B11.clear();
+
+    // Y = P2 + beta C11 = A12 B21 + beta C11; C11 = X + Y.
+    if (beta != zero)
+        redistribute( C11, Y, opts );
+    gemm_strassen( alpha, A12, B21, beta, Y, depth-1, nb, opts );
+    add( one, X, one, Y, opts );
+    redistribute( Y, C11, opts );
+
+    // S4 = A12 - S2 and T4 = T2 - B21 overwrite A12 and B21.
+    add( -one, S2, one, A12, opts );
+    add( one, T2, -one, B21, opts );
+    auto& S4 = A12;
+    auto& T4 = B21;
+
+    // Y = P6 = S2 T2; X = U2 = X + Y.
+    gemm_strassen( alpha, S2, T2, zero, Y, depth-1, nb, opts );
+    S2.clear();
+    T2.clear();
+    add( one, Y, one, X, opts );
+
+    // Y = P7 = S3 T3; Y = U3 = X + Y.
+    gemm_strassen( alpha, S3, T3, zero, Y, depth-1, nb, opts );
+    S3.clear();
+    T3.clear();
+    add( one, X, one, Y, opts );
+
+    // Z = -P4 + beta C21 = -A22 T4 + beta C21; C21 = Y + Z.
+    if (beta != zero)
+        redistribute( C21, Z, opts );
+    gemm_strassen( -alpha, A22, T4, beta, Z, depth-1, nb, opts );
+    A22.clear();
+    T4.clear();
+    add( one, Y, one, Z, opts );
+    redistribute( Z, C21, opts );
+
+    // Z = P5 = S1 T1; X = U4 = X + Z; Y = U7 = Y + Z.
+    gemm_strassen( alpha, S1, T1, zero, Z, depth-1, nb, opts );
+    S1.clear();
+    T1.clear();
+    add( one, Z, one, X, opts );
+    add( one, Z, one, Y, opts );
+
+    // C22 = Y + beta C22, using Z as workspace.
+    if (beta == zero) {
+        redistribute( Y, C22, opts );
+    }
+    else {
+        redistribute( C22, Z, opts );
+        add( one, Y, beta, Z, opts );
+        redistribute( Z, C22, opts );
+    }
+    Z.clear();
+
+    // Y = P3 + beta C12 = S4 B22 + beta C12; C12 = X + Y.
+    if (beta != zero)
+        redistribute( C12, Y, opts );
+    gemm_strassen( alpha, S4, B22, beta, Y, depth-1, nb, opts );
+    S4.clear();
+    B22.clear();
+    add( one, X, one, Y, opts );
+    redistribute( Y, C12, opts );
+
+    // Odd last column of A and row of B: C_e += alpha A(:, k) B(k, :).
+    if (k > 2*k2) {
+        auto Ak = A.slice( 0,    2*m2-1, 2*k2, k-1 );
+        auto Bk = B.slice( 2*k2, k-1,    0,    2*n2-1 );
+        auto Ce = C.slice( 0,    2*m2-1, 0,    2*n2-1 );
+        gemm( alpha, Ak, Bk, one, Ce, opts );
+    }
+    // Odd last row of C.
+    if (m > 2*m2) {
+        auto Am = A.slice( 2*m2, m-1, 0, k-1 );
+        auto Cm = C.slice( 2*m2, m-1, 0, n-1 );
+        gemm( alpha, Am, B, beta, Cm, opts );
+    }
+    // Odd last column of C, excluding its last row.
+    if (n > 2*n2) {
+        auto Ae = A.slice( 0, 2*m2-1, 0, k-1 );
+        auto Bn = B.slice( 0, k-1,    2*n2, n-1 );
+        auto Cn = C.slice( 0, 2*m2-1, 2*n2, n-1 );
+        gemm( alpha, Ae, Bn, beta, Cn, opts );
+    }
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel general matrix-matrix multiplication using the
+/// Strassen-Winograd algorithm. Performs the matrix-matrix operation
+/// \[
+///     C = \alpha A B + \beta C,
+/// \]
+/// where alpha and beta are scalars, and $A$, $B$, and $C$ are matrices, with
+/// $A$ an m-by-k matrix, $B$ a k-by-n matrix, and $C$ an m-by-n matrix.
+/// The matrices can be transposed or conjugate-transposed beforehand, e.g.,
+///
+///     auto AT = slate::transpose( A );
+///     auto BT = slate::conj_transpose( B );
+///     slate::gemm_strassen( alpha, AT, BT, beta, C );
+///
+/// Each level of recursion replaces 8 half-size products by 7, and
+/// 15 half-size additions, saving up to 12.5% of the flops per level for
+/// large matrices. Blocks are copied into workspaces on C's process grid,
+/// using at most about (3/2)(mk + kn) + (3/4)mn elements of workspace per
+/// level, as operands are freed after their last use.
+///
+/// The result is not as accurate as gemm: the bound on the normwise error
+/// grows by a factor of up to about 18 per level (Higham, 2002, sec. 23.2.2),
+/// and there is no componentwise bound.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///         One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] alpha
+///         The scalar alpha.
+///
+/// @param[in] A
+///         The m-by-k matrix A.
+///
+/// @param[in] B
+///         The k-by-n matrix B.
+///
+/// @param[in] beta
+///         The scalar beta.
+///
+/// @param[in,out] C
+///         On entry, the m-by-n matrix C.
+///         On exit, overwritten by the result $\alpha A B + \beta C$.
+///
+/// @param[in] opts
+///         Additional options, as map of name = value pairs. Possible options:
+///         - Option::StrassenDepth:
+///           Levels of recursion, >= 0. Default 1.
+///           Recursion stops early when a block is smaller than a tile.
+///         - Option::Lookahead:
+///           Number of blocks to overlap communication and computation.
+///           lookahead >= 0. Default 1.
+///         - Option::Target:
+///           Implementation to target. Possible values:
+///           - HostTask:  OpenMP tasks on CPU host [default].
+///           - HostNest:  nested OpenMP parallel for loop on CPU host.
+///           - HostBatch: batched BLAS on CPU host.
+///           - Devices:   batched BLAS on GPU device.
+///
+/// @ingroup gemm
+///
+template <typename scalar_t>
+void gemm_strassen(
+    scalar_t alpha, Matrix<scalar_t>& A,
+                    Matrix<scalar_t>& B,
+    scalar_t beta,  Matrix<scalar_t>& C,
+    Options const& opts)
+{
+    int64_t depth = get_option<int64_t>( opts, Option::StrassenDepth, 1 );
+    slate_assert( depth >= 0 );
+
+    // Products at the bottom of the recursion use the default method.
+    Options opts2 = opts;
+    opts2[ Option::MethodGemm ] = MethodGemm::Auto;
+
+    impl::gemm_strassen( alpha, A, B, beta, C, depth, C.tileNb( 0 ), opts2 );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void gemm_strassen<float>(
+    float alpha, Matrix<float>& A,
+                 Matrix<float>& B,
+    float beta,  Matrix<float>& C,
+    Options const& opts);
+
+template
+void gemm_strassen<double>(
+    double alpha, Matrix<double>& A,
+                  Matrix<double>& B,
+    double beta,  Matrix<double>& C,
+    Options const& opts);
+
+template
+void gemm_strassen< std::complex<float> >(
+    std::complex<float> alpha, Matrix< std::complex<float> >& A,
+                               Matrix< std::complex<float> >& B,
+    std::complex<float> beta,  Matrix< std::complex<float> >& C,
+    Options const& opts);
+
+template
+void gemm_strassen< std::complex<double> >(
+    std::complex<double> alpha, Matrix< std::complex<double> >& A,
+                                Matrix< std::complex<double> >& B,
+    std::complex<double> beta,  Matrix< std::complex<double> >& C,
+    Options const& opts);
+
+} // namespace slate
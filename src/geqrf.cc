@@ -174,8 +174,11 @@ void geqrf(
     uint8_t* block = block_vector.data();
     SLATE_UNUSED( block ); // Used only by OpenMP
 
-    // set min number for omp nested active parallel regions
-    slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
+    // Panels run on internal::ThreadTeam, so only HostNest needs
+    // omp nested active parallel regions. Otherwise, leaving nesting off
+    // keeps threaded BLAS inside tasks from creating nested teams.
+    slate::OmpSetMaxActiveLevels set_active_levels(
+        target == Target::HostNest ? MinOmpActiveLevels : 1 );
 
     #pragma omp parallel
     #pragma omp master
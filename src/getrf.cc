@@ -44,18 +44,26 @@ void getrf(
     int64_t max_panel_threads  = std::max( omp_get_max_threads()/2, 1 );
     max_panel_threads = get_option<int64_t>( opts, Option::MaxPanelThreads,
                                              max_panel_threads );
-
-    // Host can use Col/RowMajor for row swapping,
-    // RowMajor is slightly more efficient.
-    // Layout host_layout = Layout::RowMajor;
-    // Layout target_layout = Layout::RowMajor;
-    // todo: RowMajor causes issues with tileLayoutReset() when A origin is
-    //       ScaLAPACK
-    Layout host_layout = Layout::ColMajor;
-    Layout target_layout = Layout::ColMajor;
+    Options const gemm_opts = {
+        {Option::OzakiSlices,
+         get_option<int64_t>( opts, Option::OzakiSlices, 0 )},
+    };
+
+    // Host can use Col/RowMajor for row swapping and trailing updates.
+    // RowMajor makes row swaps contiguous; tiles are converted to RowMajor
+    // once, back to ColMajor when they enter the panel, and any remaining
+    // RowMajor tiles are reset to the matrix layout at the end.
+    Layout host_layout = get_option( opts, Option::HostLayout,
+                                     Layout::ColMajor );
+    Layout target_layout = host_layout;
     // GPU Devices use RowMajor for efficient row swapping.
     if (target == Target::Devices)
         target_layout = Layout::RowMajor;
+    // Only the HostTask trsm follows the tile layout;
+    // the row of U is broadcast in the layout trsm leaves it in.
+    Layout trsm_layout = Layout::ColMajor;
+    if (target == Target::HostTask)
+        trsm_layout = host_layout;
 
     int64_t A_nt = A.nt();
     int64_t A_mt = A.mt();
@@ -79,8 +87,11 @@ void getrf(
         A.reserveDeviceWorkspace();
     }
 
-    // set min number for omp nested active parallel regions
-    slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
+    // Panels run on internal::ThreadTeam, so only HostNest needs
+    // omp nested active parallel regions. Otherwise, leaving nesting off
+    // keeps threaded BLAS inside tasks from creating nested teams.
+    slate::OmpSetMaxActiveLevels set_active_levels(
+        target == Target::HostNest ? MinOmpActiveLevels : 1 );
 
     #pragma omp parallel
     #pragma omp master
@@ -109,7 +120,16 @@ void getrf(
 
                 // Root broadcasts the pivot to all ranks.
                 // todo: Panel ranks send the pivots to the right.
-                {
+                // In a dry run, all ranks have the same stand-in pivots,
+                // so the broadcast is only counted.
+                if (DryRun::enabled()) {
+                    int64_t bytes = sizeof(Pivot)*pivots.at(k).size();
+                    if (A.tileRank(k, k) == A.mpiRank())
+                        DryRun::send( bytes );
+                    else
+                        DryRun::recv( bytes );
+                }
+                else {
                     trace::Block trace_block("MPI_Bcast");
 
                     MPI_Bcast(pivots.at(k).data(),
@@ -137,18 +157,17 @@ void getrf(
                     internal::trsm<target>(
                         Side::Left,
                         one, std::move( Tkk ), A.sub(k, k, j, j),
-                        priority_1, Layout::ColMajor, queue_jk1 );
+                        priority_1, trsm_layout, queue_jk1 );
 
                     // send A(k, j) across column A(k+1:mt-1, j)
-                    // todo: trsm still operates in ColMajor
-                    A.tileBcast(k, j, A.sub(k+1, A_mt-1, j, j), Layout::ColMajor, tag_j);
+                    A.tileBcast(k, j, A.sub(k+1, A_mt-1, j, j), trsm_layout, tag_j);
 
                     // A(k+1:mt-1, j) -= A(k+1:mt-1, k) * A(k, j)
                     internal::gemm<target>(
                         -one, A.sub(k+1, A_mt-1, k, k),
                               A.sub(k, k, j, j),
                         one,  A.sub(k+1, A_mt-1, j, j),
-                        target_layout, priority_1, queue_jk1 );
+                        target_layout, priority_1, queue_jk1, gemm_opts );
                 }
             }
             // pivot to the left
@@ -194,7 +213,7 @@ void getrf(
                         Side::Left,
                         one, std::move( Tkk ),
                              A.sub(k, k, k+1+lookahead, A_nt-1),
-                        priority_0, Layout::ColMajor, queue_1 );
+                        priority_0, trsm_layout, queue_1 );
 
                     // send A(k, kl+1:A_nt-1) across A(k+1:mt-1, kl+1:nt-1)
                     BcastList bcast_list_A;
@@ -202,16 +221,15 @@ void getrf(
                         // send A(k, j) across column A(k+1:mt-1, j)
                         bcast_list_A.push_back({k, j, {A.sub(k+1, A_mt-1, j, j)}});
                     }
-                    // todo: trsm still operates in ColMajor
                     A.template listBcast<target>(
-                        bcast_list_A, Layout::ColMajor, tag_kl1);
+                        bcast_list_A, trsm_layout, tag_kl1);
 
                     // A(k+1:mt-1, kl+1:nt-1) -= A(k+1:mt-1, k) * A(k, kl+1:nt-1)
                     internal::gemm<target>(
                         -one, A.sub(k+1, A_mt-1, k, k),
                               A.sub(k, k, k+1+lookahead, A_nt-1),
                         one,  A.sub(k+1, A_mt-1, k+1+lookahead, A_nt-1),
-                        target_layout, priority_0, queue_1 );
+                        target_layout, priority_0, queue_1, gemm_opts );
                 }
             }
             if (is_shared) {
@@ -298,6 +316,13 @@ void getrf(
 ///      Strictness of the pivot selection.  Between 0 and 1 with 1 giving
 ///      partial pivoting and 0 giving no pivoting.  Default 1.
 ///
+///    - Option::HostLayout:
+///      Layout of host tiles during row swaps and trailing updates.
+///       - Layout::ColMajor [default].
+///       - Layout::RowMajor: row swaps are contiguous; for HostTask,
+///         trsm also works in RowMajor.
+///      On exit, tiles are in the matrix layout regardless.
+///
 ///    - Option::MethodLU:
 ///      Algorithm for LU factorization.
 ///       - MethodLU::PartialPiv: partial pivoting [default].
@@ -305,6 +330,14 @@ void getrf(
 ///       - MethodLU::NoPiv: no pivoting.
 ///         Note pivots vector is currently ignored for NoPiv.
 ///
+///    - Option::PivotTree:
+///      Tournament tree for MethodLU::CALU; see getrf_tntpiv.
+///
+///    - Option::OzakiSlices:
+///      For MethodLU::PartialPiv, HostTask, and double, number of slices
+///      to emulate the trailing updates with single-precision gemm;
+///      see slate::gemm. Default 0: native double-precision gemm.
+///
 /// TODO: return value
 /// @retval 0 successful exit
 /// @retval >0 for return value = $i$, $U(i,i)$ is exactly zero. The
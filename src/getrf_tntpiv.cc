@@ -9,6 +9,7 @@
 #include "slate/Tile_blas.hh"
 #include "slate/TriangularMatrix.hh"
 #include "internal/internal.hh"
+#include "internal/internal_util.hh"
 
 namespace slate {
 
@@ -44,6 +45,7 @@ void getrf_tntpiv(
     int64_t max_panel_threads  = std::max( omp_get_max_threads()/2, 1 );
     max_panel_threads = get_option<int64_t>( opts, Option::MaxPanelThreads,
                                              max_panel_threads );
+    PivotTree tree = get_option( opts, Option::PivotTree, PivotTree::Hybrid );
 
     // Host can use Col/RowMajor for row swapping,
     // RowMajor is slightly more efficient.
@@ -140,11 +142,19 @@ void getrf_tntpiv(
     uint8_t listBcastMT_token;
     SLATE_UNUSED(listBcastMT_token); // Only used by OpenMP
 
+    // For the hybrid tree, find which ranks share a node.
+    std::vector<int> node_ids;
+    if (tree == PivotTree::Hybrid)
+        node_ids = internal::mpi_node_ids( A.mpiComm() );
+
     // workspace
     auto Awork = A.emptyLike();
 
-    // set min number for omp nested active parallel regions
-    slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
+    // Panels run on internal::ThreadTeam, so only HostNest needs
+    // omp nested active parallel regions. Otherwise, leaving nesting off
+    // keeps threaded BLAS inside tasks from creating nested teams.
+    slate::OmpSetMaxActiveLevels set_active_levels(
+        target == Target::HostNest ? MinOmpActiveLevels : 1 );
 
     #pragma omp parallel
     #pragma omp master
@@ -166,7 +176,8 @@ void getrf_tntpiv(
                 internal::getrf_tntpiv_panel<target>(
                     A.sub(k, A_mt-1, k, k), std::move(Apanel),
                     dwork_array, dwork_bytes, diag_len, ib,
-                    pivots.at(k), max_panel_threads, priority_1 );
+                    pivots.at(k), tree, node_ids, max_panel_threads,
+                    priority_1 );
 
                 // Root broadcasts the pivot to all ranks.
                 // todo: Panel ranks send the pivots to the right.
@@ -361,7 +372,7 @@ void getrf_tntpiv(
 /// Distributed parallel LU factorization.
 ///
 /// Computes an LU factorization of a general m-by-n matrix $A$
-/// using partial pivoting with row interchanges.
+/// using tournament pivoting (CALU) with row interchanges.
 ///
 /// The factorization has the form
 /// \[
@@ -372,6 +383,13 @@ void getrf_tntpiv(
 /// triangular (upper trapezoidal if m < n).
 ///
 /// This is the right-looking Level 3 BLAS version of the algorithm.
+/// Each panel selects its pivot rows by a tournament: every rank factors
+/// its local tiles, then candidate rows (min( mb, nb ) per rank) are merged
+/// up a reduction tree, factoring each pair of candidate sets to select the
+/// winners. Only candidate rows are communicated. The root's last
+/// factorization is reused as the panel's diagonal block, and the rest of
+/// the panel is computed by a triangular solve, so the panel is not
+/// factored again.
 ///
 //------------------------------------------------------------------------------
 /// @tparam scalar_t
@@ -400,6 +418,13 @@ void getrf_tntpiv(
 ///       - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///       - HostBatch: batched BLAS on CPU host.
 ///       - Devices:   batched BLAS on GPU device.
+///     - Option::PivotTree:
+///       Shape of the tournament tree. Possible values:
+///       - Binary: binary tree over ranks; log2( p ) rounds.
+///       - Flat:   the diagonal rank merges all ranks in turn;
+///                 one message per rank, but p - 1 rounds on the root.
+///       - Hybrid: flat tree within each node (shared memory),
+///                 binary tree across nodes [default].
 ///
 /// TODO: return value
 /// @retval 0 successful exit
@@ -9,6 +9,7 @@
 #include "slate/Tile_blas.hh"
 #include "slate/HermitianBandMatrix.hh"
 #include "internal/internal.hh"
+#include "lapack/flops.hh"
 
 namespace slate {
 
@@ -80,7 +81,8 @@ void heev(
     Target target = get_option( opts, Option::Target, Target::HostTask );
 
     // Scale matrix to allowable range, if necessary.
-    real_t Anorm = norm( Norm::Max, A );
+    // A dry run has no values to scale.
+    real_t Anorm = DryRun::enabled() ? 1 : norm( Norm::Max, A );
     real_t alpha = 1.0;
     if (std::isnan( Anorm ) || std::isinf( Anorm )) {
         // todo: return error value? throw?
@@ -103,6 +105,31 @@ void heev(
     TriangularFactors<scalar_t> T;
     he2hb(A, T, opts);
 
+    // In a dry run, skip gathering the band, hb2st, the tri-diagonal
+    // solver, and their broadcasts, which run on rank 0 or need all ranks.
+    // Count the flops of this rank's tiles of Z in unmtr_hb2st, which
+    // applies n^2/2 Householder vectors, like unmqr with k = n;
+    // the flops of hb2st and the tri-diagonal solver are not counted.
+    if (DryRun::enabled()) {
+        Lambda.assign( n, 0 );
+        if (wantz) {
+            int64_t local_size = 0;
+            for (int64_t j = 0; j < Z.nt(); ++j) {
+                for (int64_t i = 0; i < Z.mt(); ++i) {
+                    if (Z.tileIsLocal( i, j ))
+                        local_size += Z.tileMb( i ) * Z.tileNb( j );
+                }
+            }
+            if (n > 0) {
+                double gflop = lapack::Gflop<scalar_t>::unmqr(
+                    lapack::Side::Left, n, n, n );
+                DryRun::flops( gflop * local_size / (double( n ) * n) );
+            }
+            unmtr_he2hb( Side::Left, Op::NoTrans, A, T, Z, opts );
+        }
+        return;
+    }
+
     // Copy band.
     // Currently, gathers band matrix to rank 0.
     int64_t nb = A.tileNb(0);
@@ -155,19 +182,26 @@ void heev(
             }
         }
 
-        // Find the total number of processors.
-        int mpi_size;
-        slate_mpi_call(
-            MPI_Comm_size(A.mpiComm(), &mpi_size));
+        // Back-transform: Z = Q1 * Q2 * Z.
+        if (target == Target::Devices) {
+            // Device kernels in unmtr_hb2st need each block column on one
+            // rank, so redistribute Z to 1D block column cyclic.
+            int mpi_size;
+            slate_mpi_call(
+                MPI_Comm_size(A.mpiComm(), &mpi_size));
 
-        Matrix<scalar_t> Z1d(Z.m(), Z.n(), Z.tileNb(0), 1, mpi_size, Z.mpiComm());
-        Z1d.insertLocalTiles(target);
-        redistribute(Z, Z1d, opts);
+            Matrix<scalar_t> Z1d(Z.m(), Z.n(), Z.tileNb(0), 1, mpi_size, Z.mpiComm());
+            Z1d.insertLocalTiles(target);
+            redistribute(Z, Z1d, opts);
 
-        // Back-transform: Z = Q1 * Q2 * Z.
-        unmtr_hb2st( Side::Left, Op::NoTrans, V, Z1d, opts );
+            unmtr_hb2st( Side::Left, Op::NoTrans, V, Z1d, opts );
 
-        redistribute(Z1d, Z, opts);
+            redistribute(Z1d, Z, opts);
+        }
+        else {
+            // Apply Q2 directly to the 2D distributed Z.
+            unmtr_hb2st( Side::Left, Op::NoTrans, V, Z, opts );
+        }
         unmtr_he2hb( Side::Left, Op::NoTrans, A, T, Z, opts );
     }
     else {
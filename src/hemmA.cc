@@ -5,6 +5,7 @@
 
 #include "slate/slate.hh"
 #include "internal/internal.hh"
+#include "internal/internal_util.hh"
 
 namespace slate {
 
@@ -44,6 +45,9 @@ void hemmA(
     // Options
     int64_t lookahead = get_option<int64_t>( opts, Option::Lookahead, 1 );
 
+    // Shape of the reductions of C; collective if node-aware.
+    internal::ReducePlan reduce_plan = internal::reducePlan( opts, C.mpiComm() );
+
     // if on right, change to left by transposing A, B, C to get
     // op(C) = op(A)*op(B)
     if (side == Side::Right) {
@@ -307,9 +311,14 @@ void hemmA(
                                   A.sub(i, A.mt()-1, i, i) }
                                 });
                         }
-                        C.template listReduce<target>(reduce_list_C, layout);
-                        reduce_list_C.clear();
-                        // Release the memory
+                    }
+                    // Reduce row i of C as one list, so reduce_plan can
+                    // spread reductions over the same ranks.
+                    C.template listReduce<target>(
+                        reduce_list_C, layout, 0, reduce_plan );
+                    reduce_list_C.clear();
+                    // Release the memory
+                    for (int64_t j = 0; j < C.nt(); ++j) {
                         if (C.tileExists(i, j) && ! C.tileIsLocal(i, j))
                             C.tileErase(i, j);
                     }
@@ -540,9 +549,14 @@ void hemmA(
                                   }
                                 });
                         }
-                        C.template listReduce<target>(reduce_list_C, layout);
-                        reduce_list_C.clear();
-                        // Release the memory
+                    }
+                    // Reduce row i of C as one list, so reduce_plan can
+                    // spread reductions over the same ranks.
+                    C.template listReduce<target>(
+                        reduce_list_C, layout, 0, reduce_plan );
+                    reduce_list_C.clear();
+                    // Release the memory
+                    for (int64_t j = 0; j < C.nt(); ++j) {
                         if (C.tileExists(i, j) && ! C.tileIsLocal(i, j))
                             C.tileErase(i, j);
                     }
@@ -609,6 +623,9 @@ void hemmA(
 ///           - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///           - HostBatch: batched BLAS on CPU host.
 ///           - Devices:   batched BLAS on GPU device.
+///         - Option::ReduceRadix, Option::ReduceSegment,
+///           Option::ReduceScatter, Option::ReduceNodeAware:
+///           Shape of the reductions of C; see gemmA.
 ///
 /// @ingroup hemm
 ///
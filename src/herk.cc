@@ -213,6 +213,12 @@ void herk(
 ///           - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///           - HostBatch: batched BLAS on CPU host.
 ///           - Devices:   batched BLAS on GPU device.
+///         - Option::ComplexGemm:
+///           With HostTask and complex types, how to multiply
+///           off-diagonal tiles:
+///           - Native: complex gemm [default].
+///           - Real4M: 4 real gemms on split real and imaginary parts.
+///           - Real3M: 3 real gemms, 25% fewer flops, less accurate.
 ///
 /// @ingroup herk
 ///
@@ -0,0 +1,270 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef SLATE_TILE_GEMM_OZAKI_HH
+#define SLATE_TILE_GEMM_OZAKI_HH
+
+#include <blas.hh>
+
+#include "slate/Tile.hh"
+#include "slate/Tile_blas.hh"
+#include "slate/internal/Trace.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+namespace slate {
+namespace tile {
+
+//------------------------------------------------------------------------------
+/// Double-precision tile split into slices of small integers stored as
+/// floats, for emulating double-precision gemm with single-precision gemm
+/// (Ozaki scheme). Split by rows, row i of op(T) is
+/// $2^{e_i} \sum_{s=1}^{S} 2^{-s \beta} Q_s(i, :)$, up to a truncation
+/// error below $2^{e_i - S \beta}$, where $|Q_s(i, l)| < 2^\beta$;
+/// split by columns, likewise for each column.
+///
+/// With $\beta$ = bits( k ), a product of two k-long slice vectors is a sum
+/// of k integers below $2^{2 \beta}$, which is below $2^{24}$, so
+/// single-precision gemm computes slice products exactly.
+///
+/// A tile with Inf or NaN cannot be split, as it has no finite exponent;
+/// then finite() is false, no slices are set, and callers use native gemm.
+/// @ingroup gemm_tile
+///
+class OzakiTile {
+public:
+    //--------------------------------------------------------------------------
+    /// @return bits per slice for inner dimension k,
+    /// the largest beta with $k 2^{2 \beta} \le 2^{24}$.
+    static int bits( int64_t k )
+    {
+        int log2_k = 0;
+        while ((int64_t( 1 ) << log2_k) < k)
+            ++log2_k;
+        int beta = (24 - log2_k) / 2;
+        slate_assert( beta >= 1 );
+        return beta;
+    }
+
+    int64_t mb()     const { return mb_; }
+    int64_t nb()     const { return nb_; }
+    int64_t slices() const { return slices_; }
+    int     bits()   const { return bits_; }
+
+    /// @return whether all entries of the split tile are finite.
+    bool finite() const { return finite_; }
+
+    /// @return exponent $e$ of row i (split by rows) or column i.
+    int exponent( int64_t i ) const { return exponents_[ i ]; }
+
+    /// @return column-major mb-by-nb slice s, 0 <= s < slices.
+    float const* slice( int64_t s ) const { return &data_[ s * mb_ * nb_ ]; }
+
+    //--------------------------------------------------------------------------
+    /// Sets this to the slices of op(T).
+    ///
+    /// @param[in] T
+    ///     Tile, which may be transposed and in either layout.
+    ///
+    /// @param[in] by_rows
+    ///     Whether to scale each row (left operand A), or each column
+    ///     (right operand B).
+    ///
+    /// @param[in] slices
+    ///     Number of slices S >= 1.
+    ///
+    void split( Tile<double> const& T, bool by_rows, int64_t slices )
+    {
+        mb_ = T.mb();
+        nb_ = T.nb();
+        slices_ = slices;
+        bits_ = bits( by_rows ? nb_ : mb_ );
+
+        int64_t mn = mb_ * nb_;
+        exponents_.assign( by_rows ? mb_ : nb_, 0 );
+        data_.assign( slices * mn, 0.0f );
+
+        // Element (i, j) of op(T) is data[ i*col_inc + j*row_inc ].
+        double const* data = T.data();
+        int64_t row_inc = T.rowIncrement();
+        int64_t col_inc = T.colIncrement();
+
+        // Exponent e with max |T(v, :)| < 2^e, or 0 for a zero row.
+        std::vector<double> max_abs( exponents_.size(), 0.0 );
+        finite_ = true;
+        for (int64_t j = 0; j < nb_; ++j) {
+            for (int64_t i = 0; i < mb_; ++i) {
+                int64_t v = by_rows ? i : j;
+                double t = data[ i*col_inc + j*row_inc ];
+                if (! std::isfinite( t ))
+                    finite_ = false;
+                max_abs[ v ] = std::max( max_abs[ v ], std::abs( t ) );
+            }
+        }
+        if (! finite_)
+            return;
+        for (size_t v = 0; v < exponents_.size(); ++v) {
+            if (max_abs[ v ] > 0)
+                std::frexp( max_abs[ v ], &exponents_[ v ] );
+        }
+
+        // Peel off bits_ bits at a time; each step is exact.
+        for (int64_t j = 0; j < nb_; ++j) {
+            for (int64_t i = 0; i < mb_; ++i) {
+                int e = exponents_[ by_rows ? i : j ];
+                double r = std::ldexp( data[ i*col_inc + j*row_inc ], -e );
+                for (int64_t s = 0; s < slices; ++s) {
+                    r = std::ldexp( r, bits_ );
+                    double q = std::trunc( r );
+                    data_[ s*mn + i + j*mb_ ] = float( q );
+                    r -= q;
+                }
+            }
+        }
+    }
+
+private:
+    int64_t mb_ = 0;
+    int64_t nb_ = 0;
+    int64_t slices_ = 0;
+    int bits_ = 0;
+    bool finite_ = true;
+    std::vector<int> exponents_;
+    std::vector<float> data_;
+};
+
+//------------------------------------------------------------------------------
+/// Emulated double-precision general matrix multiply (Ozaki scheme):
+/// $C = \alpha A B + \beta C$, where A is split by rows and B by columns
+/// into S slices each. Computes the $S (S+1)/2$ slice products
+/// $Q^A_s Q^B_t$ with $s + t \le S + 1$ exactly with single-precision gemm,
+/// sums those of equal $s + t$ exactly, and accumulates the sums, scaled,
+/// in double precision, from the smallest.
+///
+/// Dropping the slice products with $s + t > S + 1$ and the truncation of
+/// A and B each leave an error of order $S\, 2^{-S \beta} |A| |B|$, with
+/// $|A|$ and $|B|$ the row and column max magnitudes. So the result is as
+/// accurate as double-precision gemm when $S \beta \ge 53 + \log_2 S$,
+/// e.g., S = 8 for k = nb <= 1024; fewer slices are faster but less
+/// accurate.
+///
+/// This is an accuracy emulation, not a speedup on CPUs: it does
+/// $S (S+1)/2$ single-precision gemms in place of one double-precision
+/// gemm, e.g., 36 for S = 8, while sgemm is only about twice as fast as
+/// dgemm. It shows the accuracy that the Ozaki scheme reaches, as would
+/// a version with int8 or half-precision slices on hardware where those
+/// are much faster than double precision.
+///
+/// C must be NoTrans, in either layout.
+///
+/// @param[in] alpha
+///     Scalar, applied to the result.
+///
+/// @param[in] A
+///     m-by-k tile split by rows, with A.finite().
+///
+/// @param[in] B
+///     k-by-n tile split by columns, with the same bits as A,
+///     and B.finite().
+///
+/// @param[in] beta
+///     Scalar; if zero, C need not be set on input.
+///
+/// @param[in,out] C
+///     m-by-n tile.
+///
+/// @ingroup gemm_tile
+///
+inline void gemm_ozaki(
+    double alpha, OzakiTile const& A,
+                  OzakiTile const& B,
+    double beta,  Tile<double>& C )
+{
+    using blas::Layout;
+
+    trace::Block trace_block( "blas::gemm_ozaki" );
+
+    assert( C.op() == Op::NoTrans );
+    assert( A.mb() == C.mb() );
+    assert( B.nb() == C.nb() );
+    assert( A.nb() == B.mb() );
+    assert( A.bits() == B.bits() );
+    assert( A.finite() && B.finite() );
+
+    int64_t m = C.mb();
+    int64_t n = C.nb();
+    int64_t k = A.nb();
+    int64_t mn = m * n;
+    int64_t slices = std::min( A.slices(), B.slices() );
+    int bits = A.bits();
+
+    std::vector<float> P( mn );
+    std::vector<double> P_sum( mn ), AB( mn, 0.0 );
+    for (int64_t g = slices - 1; g >= 0; --g) {
+        // P_sum = sum_{s + t = g} Q^A_s Q^B_t, all integers below 2^53.
+        std::fill( P_sum.begin(), P_sum.end(), 0.0 );
+        for (int64_t s = 0; s <= g; ++s) {
+            blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans, m, n, k,
+                        1.0f, A.slice( s ), m, B.slice( g - s ), k,
+                        0.0f, P.data(), m );
+            for (int64_t ij = 0; ij < mn; ++ij)
+                P_sum[ ij ] += P[ ij ];
+        }
+        // Slices s and t (0-based) have weights 2^{-(s+1) beta}, 2^{-(t+1) beta}.
+        int shift = -bits * int( g + 2 );
+        for (int64_t ij = 0; ij < mn; ++ij)
+            AB[ ij ] += std::ldexp( P_sum[ ij ], shift );
+    }
+
+    // C = alpha diag(2^{e^A}) AB diag(2^{e^B}) + beta C.
+    double* data = C.data();
+    int64_t row_inc = C.rowIncrement();
+    int64_t col_inc = C.colIncrement();
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < m; ++i) {
+            double ab = std::ldexp( AB[ i + j*m ],
+                                    A.exponent( i ) + B.exponent( j ) );
+            double& c = data[ i*col_inc + j*row_inc ];
+            c = (beta == 0 ? alpha * ab : alpha * ab + beta * c);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// General matrix multiply: $C = \alpha op(A) op(B) + \beta C$.
+/// For double with slices > 0, splits A and B on the fly and emulates
+/// double-precision gemm (see gemm_ozaki above); this is for tiles that are
+/// not reused. Otherwise, or if A or B has Inf or NaN, calls tile::gemm,
+/// which propagates them.
+/// @ingroup gemm_tile
+///
+template <typename scalar_t>
+void gemm_ozaki(
+    int64_t slices,
+    scalar_t alpha, Tile<scalar_t> const& A,
+                    Tile<scalar_t> const& B,
+    scalar_t beta,  Tile<scalar_t>& C )
+{
+    if constexpr (std::is_same<scalar_t, double>::value) {
+        if (slices > 0) {
+            OzakiTile A_slices, B_slices;
+            A_slices.split( A, true, slices );
+            B_slices.split( B, false, slices );
+            if (A_slices.finite() && B_slices.finite()) {
+                gemm_ozaki( alpha, A_slices, B_slices, beta, C );
+                return;
+            }
+        }
+    }
+    gemm( alpha, A, B, beta, C );
+}
+
+} // namespace tile
+} // namespace slate
+
+#endif // SLATE_TILE_GEMM_OZAKI_HH
@@ -7,6 +7,7 @@
 #define SLATE_TILE_LAPACK_HH
 
 #include <blas.hh>
+#include <lapack/flops.hh>
 
 #include "slate/Tile.hh"
 #include "slate/internal/util.hh"
@@ -111,6 +112,84 @@ void genorm(Norm norm, NormScope scope, Tile<scalar_t> const&& A,
     return genorm(norm, scope, A, values);
 }
 
+//------------------------------------------------------------------------------
+/// General matrix max, one, inf, and Frobenius norms, fused into one pass
+/// over the tile. Any output may be null to skip that norm.
+/// @ingroup norm_tile
+///
+/// @param[out] max
+///     max_{i,j} abs( A_{i,j} ), propagating NaN.
+///
+/// @param[out] col_sums
+///     Array of length nb: col_sums[j] = sum_i abs( A_{i,j} ).
+///
+/// @param[out] row_sums
+///     Array of length mb: row_sums[i] = sum_j abs( A_{i,j} ).
+///
+/// @param[out] scale_sumsq
+///     Array of length 2: scale and sumsq such that
+///     scale^2 * sumsq = sum_{i,j} abs( A_{i,j} )^2.
+///
+template <typename scalar_t>
+void genorms(Tile<scalar_t> const& A,
+             blas::real_type<scalar_t>* max,
+             blas::real_type<scalar_t>* col_sums,
+             blas::real_type<scalar_t>* row_sums,
+             blas::real_type<scalar_t>* scale_sumsq)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    trace::Block trace_block("slate::genorms");
+
+    assert(A.uploPhysical() == Uplo::General);
+    assert(A.op() == Op::NoTrans);
+    int64_t mb = A.mb();
+    int64_t nb = A.nb();
+
+    if (max != nullptr)
+        *max = 0;
+    if (row_sums != nullptr)
+        std::fill_n(row_sums, mb, 0.0);
+    if (scale_sumsq != nullptr) {
+        scale_sumsq[0] = 0;  // scale
+        scale_sumsq[1] = 1;  // sumsq
+    }
+
+    for (int64_t j = 0; j < nb; ++j) {
+        const scalar_t* Aj = &A.at(0, j);
+        real_t col_max = 0;
+        real_t col_sum = 0;
+        for (int64_t i = 0; i < mb; ++i) {
+            real_t absa = std::abs( Aj[i] );  // A(i, j)
+            col_max = max_nan(absa, col_max);
+            col_sum += absa;
+            if (row_sums != nullptr)
+                row_sums[i] += absa;
+        }
+        if (max != nullptr)
+            *max = max_nan(col_max, *max);
+        if (col_sums != nullptr)
+            col_sums[j] = col_sum;
+        // Column is still in cache for lassq.
+        if (scale_sumsq != nullptr)
+            lapack::lassq(mb, Aj, 1, &scale_sumsq[0], &scale_sumsq[1]);
+    }
+}
+
+//-----------------------------------------
+/// Converts rvalue refs to lvalue refs.
+/// @ingroup norm_tile
+///
+template <typename scalar_t>
+void genorms(Tile<scalar_t> const&& A,
+             blas::real_type<scalar_t>* max,
+             blas::real_type<scalar_t>* col_sums,
+             blas::real_type<scalar_t>* row_sums,
+             blas::real_type<scalar_t>* scale_sumsq)
+{
+    genorms(A, max, col_sums, row_sums, scale_sumsq);
+}
+
 //------------------------------------------------------------------------------
 /// Trapezoid and triangular matrix norm.
 /// @ingroup norm_tile
@@ -267,6 +346,11 @@ int64_t potrf(Tile<scalar_t>& A)
 {
     trace::Block trace_block("lapack::potrf");
 
+    if (DryRun::enabled()) {
+        DryRun::flops( lapack::Gflop<scalar_t>::potrf( A.nb() ) );
+        return 0;
+    }
+
     return lapack::potrf(A.uploPhysical(),
                          A.nb(),
                          A.data(), A.stride());
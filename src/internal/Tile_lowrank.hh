@@ -0,0 +1,635 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef SLATE_TILE_LOWRANK_HH
+#define SLATE_TILE_LOWRANK_HH
+
+#include "slate/Tile.hh"
+#include "slate/Tile_aux.hh"
+#include "slate/types.hh"
+#include "slate/internal/mpi.hh"
+
+#include <blas.hh>
+#include <lapack.hh>
+
+#include <vector>
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Compressed (low-rank) tile holding an mb-by-nb matrix as $U V^H$,
+/// where U is mb-by-rank and V is nb-by-rank, both column-major with
+/// leading dimensions mb and nb, respectively.
+/// U and V are stored contiguously in one buffer, U first, so the tile
+/// can be communicated in a single message.
+/// The rank is chosen by tile::compress from an accuracy threshold.
+///
+template <typename scalar_t>
+class LowRankTile {
+public:
+    LowRankTile()
+        : mb_(0), nb_(0), rank_(0)
+    {}
+
+    LowRankTile(int64_t mb, int64_t nb, int64_t rank)
+        : mb_(mb), nb_(nb), rank_(rank), data_((mb + nb)*rank)
+    {}
+
+    /// Number of rows.
+    int64_t mb() const { return mb_; }
+
+    /// Number of columns.
+    int64_t nb() const { return nb_; }
+
+    /// Numerical rank, i.e., number of columns of U and V.
+    int64_t rank() const { return rank_; }
+
+    /// Number of elements stored; (mb + nb)*rank.
+    int64_t size() const { return data_.size(); }
+
+    /// Left factor U, mb-by-rank, leading dimension mb.
+    scalar_t* U() { return data_.data(); }
+    scalar_t const* U() const { return data_.data(); }
+
+    /// Right factor V, nb-by-rank, leading dimension nb.
+    scalar_t* V() { return data_.data() + mb_*rank_; }
+    scalar_t const* V() const { return data_.data() + mb_*rank_; }
+
+    /// Resize to mb-by-nb with given rank. Contents are not preserved.
+    void resize(int64_t mb, int64_t nb, int64_t rank)
+    {
+        mb_ = mb;
+        nb_ = nb;
+        rank_ = rank;
+        data_.resize((mb + nb)*rank);
+    }
+
+    void send(int dst, MPI_Comm mpi_comm, int tag = 0) const;
+    void isend(int dst, MPI_Comm mpi_comm, int tag, MPI_Request* request) const;
+    void recv(int src, MPI_Comm mpi_comm, int tag = 0);
+
+private:
+    int64_t mb_;
+    int64_t nb_;
+    int64_t rank_;
+    std::vector<scalar_t> data_;
+};
+
+//------------------------------------------------------------------------------
+/// Sends U and V to dst. The receiver must already know mb and nb;
+/// the rank is deduced from the message size.
+///
+template <typename scalar_t>
+void LowRankTile<scalar_t>::send(int dst, MPI_Comm mpi_comm, int tag) const
+{
+    trace::Block trace_block("MPI_Send");
+
+    slate_mpi_call(
+        MPI_Send(data_.data(), data_.size(), mpi_type<scalar_t>::value,
+                 dst, tag, mpi_comm));
+}
+
+//------------------------------------------------------------------------------
+/// Non-blocking variant of send. The tile must not be modified or destroyed
+/// until the request completes.
+///
+template <typename scalar_t>
+void LowRankTile<scalar_t>::isend(
+    int dst, MPI_Comm mpi_comm, int tag, MPI_Request* request) const
+{
+    trace::Block trace_block("MPI_Isend");
+
+    slate_mpi_call(
+        MPI_Isend(data_.data(), data_.size(), mpi_type<scalar_t>::value,
+                  dst, tag, mpi_comm, request));
+}
+
+//------------------------------------------------------------------------------
+/// Receives U and V from src. mb and nb must be set (e.g., by resize)
+/// before calling; the rank is taken from the incoming message size.
+///
+template <typename scalar_t>
+void LowRankTile<scalar_t>::recv(int src, MPI_Comm mpi_comm, int tag)
+{
+    trace::Block trace_block("MPI_Recv");
+
+    assert(mb_ + nb_ > 0);
+
+    MPI_Status status;
+    int count;
+    slate_mpi_call(
+        MPI_Probe(src, tag, mpi_comm, &status));
+    slate_mpi_call(
+        MPI_Get_count(&status, mpi_type<scalar_t>::value, &count));
+
+    resize(mb_, nb_, count / (mb_ + nb_));
+    slate_mpi_call(
+        MPI_Recv(data_.data(), count, mpi_type<scalar_t>::value,
+                 src, tag, mpi_comm, MPI_STATUS_IGNORE));
+}
+
+namespace tile {
+
+//------------------------------------------------------------------------------
+/// Compress op(A) into a low-rank tile B = U V^H using a truncated SVD.
+/// Singular values <= tol are dropped, so that
+/// $\| op(A) - U V^H \|_2 \le tol$.
+/// Singular values are folded into U.
+///
+/// @param[in] A
+///     Dense tile to compress.
+///
+/// @param[in] tol
+///     Absolute truncation threshold, >= 0.
+///
+/// @param[out] B
+///     On exit, compressed tile of the same dimensions as op(A).
+///
+/// @ingroup lowrank_tile
+///
+template <typename scalar_t>
+void compress(Tile<scalar_t> const& A, blas::real_type<scalar_t> tol,
+              LowRankTile<scalar_t>& B)
+{
+    trace::Block trace_block("lapack::gesvd");
+
+    using blas::conj;
+    using real_t = blas::real_type<scalar_t>;
+
+    int64_t mb = A.mb();
+    int64_t nb = A.nb();
+    int64_t kb = std::min(mb, nb);
+    if (kb == 0) {
+        B.resize(mb, nb, 0);
+        return;
+    }
+
+    // Copy op(A), since gesvd overwrites its input.
+    std::vector<scalar_t> W_data(mb*nb);
+    Tile<scalar_t> W(mb, nb, W_data.data(), mb, HostNum, TileKind::Workspace);
+    gecopy(A, W);
+
+    std::vector<real_t> S(kb);
+    std::vector<scalar_t> U(mb*kb);
+    std::vector<scalar_t> VT(kb*nb);
+    lapack::gesvd(lapack::Job::SomeVec, lapack::Job::SomeVec, mb, nb,
+                  W_data.data(), mb, S.data(),
+                  U.data(), mb, VT.data(), kb);
+
+    // Singular values are sorted in decreasing order.
+    int64_t rank = 0;
+    while (rank < kb && S[rank] > tol)
+        ++rank;
+
+    B.resize(mb, nb, rank);
+    scalar_t* BU = B.U();
+    scalar_t* BV = B.V();
+    for (int64_t k = 0; k < rank; ++k) {
+        for (int64_t i = 0; i < mb; ++i)
+            BU[i + k*mb] = U[i + k*mb] * S[k];
+        for (int64_t j = 0; j < nb; ++j)
+            BV[j + k*nb] = conj(VT[k + j*kb]);
+    }
+}
+
+//-----------------------------------------
+/// Converts rvalue refs to lvalue refs.
+/// @ingroup lowrank_tile
+///
+template <typename scalar_t>
+void compress(Tile<scalar_t> const&& A, blas::real_type<scalar_t> tol,
+              LowRankTile<scalar_t>& B)
+{
+    compress(A, tol, B);
+}
+
+//------------------------------------------------------------------------------
+/// Decompress low-rank tile A into dense tile C: op(C) = U V^H.
+/// @ingroup lowrank_tile
+///
+template <typename scalar_t>
+void decompress(LowRankTile<scalar_t> const& A, Tile<scalar_t>& C)
+{
+    trace::Block trace_block("blas::gemm");
+
+    assert(C.mb() == A.mb());
+    assert(C.nb() == A.nb());
+    assert(C.uploPhysical() == Uplo::General);
+
+    int64_t mb = A.mb();
+    int64_t nb = A.nb();
+    if (mb == 0 || nb == 0)
+        return;
+
+    if (C.op() == Op::NoTrans && C.layout() == Layout::ColMajor) {
+        blas::gemm(blas::Layout::ColMajor,
+                   Op::NoTrans, Op::ConjTrans,
+                   mb, nb, A.rank(),
+                   scalar_t(1.0), A.U(), mb,
+                                  A.V(), nb,
+                   scalar_t(0.0), C.data(), C.stride());
+    }
+    else {
+        std::vector<scalar_t> W_data(mb*nb);
+        Tile<scalar_t> W(mb, nb, W_data.data(), mb, HostNum,
+                         TileKind::Workspace);
+        blas::gemm(blas::Layout::ColMajor,
+                   Op::NoTrans, Op::ConjTrans,
+                   mb, nb, A.rank(),
+                   scalar_t(1.0), A.U(), mb,
+                                  A.V(), nb,
+                   scalar_t(0.0), W_data.data(), mb);
+        gecopy(W, C);
+    }
+}
+
+//-----------------------------------------
+/// Converts rvalue refs to lvalue refs.
+/// @ingroup lowrank_tile
+///
+template <typename scalar_t>
+void decompress(LowRankTile<scalar_t> const& A, Tile<scalar_t>&& C)
+{
+    decompress(A, C);
+}
+
+//------------------------------------------------------------------------------
+/// Returns the conjugate transpose $A^H = V U^H$ of a low-rank tile.
+/// This only swaps the factors, so costs O( (mb + nb) rank ).
+/// @ingroup lowrank_tile
+///
+template <typename scalar_t>
+LowRankTile<scalar_t> conj_transpose(LowRankTile<scalar_t> const& A)
+{
+    int64_t mb = A.mb();
+    int64_t nb = A.nb();
+    int64_t rank = A.rank();
+    LowRankTile<scalar_t> AH(nb, mb, rank);
+    lapack::lacpy(lapack::MatrixType::General, nb, rank,
+                  A.V(), nb, AH.U(), nb);
+    lapack::lacpy(lapack::MatrixType::General, mb, rank,
+                  A.U(), mb, AH.V(), mb);
+    return AH;
+}
+
+//------------------------------------------------------------------------------
+/// Low-rank update with recompression:
+///     $C = X Y^H + C$,
+/// where X is mb-by-k and Y is nb-by-k, column-major.
+/// The stacked factors [U_C, X] and [V_C, Y] are orthogonalized by QR,
+/// the small core $R_U R_V^H$ is truncated by SVD with threshold tol,
+/// and the result is written back to C.
+/// If the stacked rank is not smaller than min(mb, nb), the update is done
+/// densely and C recompressed, which bounds the cost by a dense SVD.
+/// @ingroup lowrank_tile
+///
+template <typename scalar_t>
+void lowrank_update(
+    int64_t k, scalar_t const* X, scalar_t const* Y,
+    blas::real_type<scalar_t> tol, LowRankTile<scalar_t>& C)
+{
+    trace::Block trace_block("lapack::lowrank_update");
+
+    using blas::conj;
+    using real_t = blas::real_type<scalar_t>;
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    int64_t mb = C.mb();
+    int64_t nb = C.nb();
+    int64_t rc = C.rank();
+    int64_t p  = rc + k;
+    if (k == 0)
+        return;
+
+    if (p >= std::min(mb, nb)) {
+        // Dense fallback: W = U_C V_C^H + X Y^H, then recompress.
+        std::vector<scalar_t> W_data(mb*nb);
+        blas::gemm(blas::Layout::ColMajor, Op::NoTrans, Op::ConjTrans,
+                   mb, nb, rc,
+                   one,  C.U(), mb, C.V(), nb,
+                   zero, W_data.data(), mb);
+        blas::gemm(blas::Layout::ColMajor, Op::NoTrans, Op::ConjTrans,
+                   mb, nb, k,
+                   one, X, mb, Y, nb,
+                   one, W_data.data(), mb);
+        Tile<scalar_t> W(mb, nb, W_data.data(), mb, HostNum,
+                         TileKind::Workspace);
+        compress(W, tol, C);
+        return;
+    }
+
+    // Stack Qu = [U_C, X] and Qv = [V_C, Y].
+    std::vector<scalar_t> Qu(mb*p), Qv(nb*p);
+    lapack::lacpy(lapack::MatrixType::General, mb, rc, C.U(), mb,
+                  &Qu[0], mb);
+    lapack::lacpy(lapack::MatrixType::General, mb, k, X, mb,
+                  &Qu[rc*mb], mb);
+    lapack::lacpy(lapack::MatrixType::General, nb, rc, C.V(), nb,
+                  &Qv[0], nb);
+    lapack::lacpy(lapack::MatrixType::General, nb, k, Y, nb,
+                  &Qv[rc*nb], nb);
+
+    // Qu Ru = [U_C, X], Qv Rv = [V_C, Y]; p <= min(mb, nb).
+    std::vector<scalar_t> tau_u(p), tau_v(p);
+    lapack::geqrf(mb, p, Qu.data(), mb, tau_u.data());
+    lapack::geqrf(nb, p, Qv.data(), nb, tau_v.data());
+
+    // M = Ru Rv^H, p-by-p.
+    std::vector<scalar_t> M(p*p, zero);
+    lapack::lacpy(lapack::MatrixType::Upper, p, p, Qu.data(), mb,
+                  M.data(), p);
+    blas::trmm(blas::Layout::ColMajor, Side::Right, Uplo::Upper,
+               Op::ConjTrans, Diag::NonUnit, p, p,
+               one, Qv.data(), nb, M.data(), p);
+
+    lapack::ungqr(mb, p, p, Qu.data(), mb, tau_u.data());
+    lapack::ungqr(nb, p, p, Qv.data(), nb, tau_v.data());
+
+    // M = Um S Vm^H.
+    std::vector<real_t> S(p);
+    std::vector<scalar_t> Um(p*p), VmT(p*p);
+    lapack::gesvd(lapack::Job::SomeVec, lapack::Job::SomeVec, p, p,
+                  M.data(), p, S.data(), Um.data(), p, VmT.data(), p);
+
+    int64_t rank = 0;
+    while (rank < p && S[rank] > tol)
+        ++rank;
+
+    // Um := Um S, Vm := VmT^H, truncated to rank columns.
+    std::vector<scalar_t> Vm(p*rank);
+    for (int64_t j = 0; j < rank; ++j) {
+        for (int64_t i = 0; i < p; ++i) {
+            Um[i + j*p] *= S[j];
+            Vm[i + j*p] = conj(VmT[j + i*p]);
+        }
+    }
+
+    // U_C = Qu Um, V_C = Qv Vm.
+    C.resize(mb, nb, rank);
+    blas::gemm(blas::Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+               mb, rank, p,
+               one,  Qu.data(), mb, Um.data(), p,
+               zero, C.U(), mb);
+    blas::gemm(blas::Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+               nb, rank, p,
+               one,  Qv.data(), nb, Vm.data(), p,
+               zero, C.V(), nb);
+}
+
+//------------------------------------------------------------------------------
+/// Low-rank general matrix multiply with recompression:
+///     $C = \alpha A B + C$,
+/// where A, B, and C are low-rank tiles.
+/// The product $U_A (V_A^H U_B) V_B^H$ is formed through the smaller of the
+/// two inner ranks, then added to C by lowrank_update.
+/// Use conj_transpose to form $A B^H$.
+/// @ingroup lowrank_tile
+///
+template <typename scalar_t>
+void gemm(
+    scalar_t alpha, LowRankTile<scalar_t> const& A,
+                    LowRankTile<scalar_t> const& B,
+                    LowRankTile<scalar_t>& C,
+    blas::real_type<scalar_t> tol)
+{
+    trace::Block trace_block("blas::gemm");
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    assert(A.mb() == C.mb());
+    assert(B.nb() == C.nb());
+    assert(A.nb() == B.mb());
+
+    int64_t mb = C.mb();
+    int64_t nb = C.nb();
+    int64_t kb = A.nb();
+    int64_t ra = A.rank();
+    int64_t rb = B.rank();
+    if (ra == 0 || rb == 0)
+        return;
+
+    // T = V_A^H U_B, ra-by-rb.
+    std::vector<scalar_t> T(ra*rb);
+    blas::gemm(blas::Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+               ra, rb, kb,
+               one,  A.V(), kb, B.U(), kb,
+               zero, T.data(), ra);
+
+    if (rb <= ra) {
+        // X = alpha U_A T (mb-by-rb), Y = V_B.
+        std::vector<scalar_t> X(mb*rb);
+        blas::gemm(blas::Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                   mb, rb, ra,
+                   alpha, A.U(), mb, T.data(), ra,
+                   zero,  X.data(), mb);
+        lowrank_update(rb, X.data(), B.V(), tol, C);
+    }
+    else {
+        // X = alpha U_A, Y = V_B T^H (nb-by-ra).
+        std::vector<scalar_t> X(mb*ra), Y(nb*ra);
+        lapack::lacpy(lapack::MatrixType::General, mb, ra, A.U(), mb,
+                      X.data(), mb);
+        blas::scal(mb*ra, alpha, X.data(), 1);
+        blas::gemm(blas::Layout::ColMajor, Op::NoTrans, Op::ConjTrans,
+                   nb, ra, rb,
+                   one,  B.V(), nb, T.data(), ra,
+                   zero, Y.data(), nb);
+        lowrank_update(ra, X.data(), Y.data(), tol, C);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Low-rank times low-rank into a dense tile:
+///     $C = \alpha A B + \beta C$,
+/// where A and B are low-rank tiles and C is a dense tile.
+/// @ingroup lowrank_tile
+///
+template <typename scalar_t>
+void gemm(
+    scalar_t alpha, LowRankTile<scalar_t> const& A,
+                    LowRankTile<scalar_t> const& B,
+    scalar_t beta,  Tile<scalar_t>& C)
+{
+    trace::Block trace_block("blas::gemm");
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    assert(A.mb() == C.mb());
+    assert(B.nb() == C.nb());
+    assert(A.nb() == B.mb());
+    assert(C.uploPhysical() == Uplo::General);
+    assert(C.op() == Op::NoTrans);
+
+    int64_t mb = C.mb();
+    int64_t nb = C.nb();
+    int64_t kb = A.nb();
+    int64_t ra = A.rank();
+    int64_t rb = B.rank();
+
+    // T = V_A^H U_B, ra-by-rb; X = U_A T, mb-by-rb.
+    std::vector<scalar_t> T(ra*rb), X(mb*rb);
+    blas::gemm(blas::Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+               ra, rb, kb,
+               one,  A.V(), kb, B.U(), kb,
+               zero, T.data(), ra);
+    blas::gemm(blas::Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+               mb, rb, ra,
+               one,  A.U(), mb, T.data(), ra,
+               zero, X.data(), mb);
+
+    // C = alpha X V_B^H + beta C.
+    blas::gemm(blas::Layout::ColMajor, Op::NoTrans, Op::ConjTrans,
+               mb, nb, rb,
+               alpha, X.data(), mb, B.V(), nb,
+               beta,  C.data(), C.stride());
+}
+
+//-----------------------------------------
+/// Converts rvalue refs to lvalue refs.
+/// @ingroup lowrank_tile
+///
+template <typename scalar_t>
+void gemm(
+    scalar_t alpha, LowRankTile<scalar_t> const& A,
+                    LowRankTile<scalar_t> const& B,
+    scalar_t beta,  Tile<scalar_t>&& C)
+{
+    gemm(alpha, A, B, beta, C);
+}
+
+//------------------------------------------------------------------------------
+/// Hermitian rank-k update of a dense tile by a low-rank tile:
+///     $C = \alpha A A^H + \beta C$,
+/// where A = U V^H is low-rank, so $A A^H = U (V^H V) U^H$.
+/// Computed as a her2k with T = U (V^H V), which keeps C exactly Hermitian.
+/// In the complex case, C cannot be transpose.
+/// @ingroup lowrank_tile
+///
+template <typename scalar_t>
+void herk(
+    blas::real_type<scalar_t> alpha, LowRankTile<scalar_t> const& A,
+    blas::real_type<scalar_t> beta,  Tile<scalar_t>& C)
+{
+    trace::Block trace_block("blas::herk");
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    assert(C.mb() == C.nb());  // square
+    assert(C.mb() == A.mb());  // n
+    if (C.is_complex && C.op() == Op::Trans)
+        throw std::exception();
+
+    int64_t mb = A.mb();
+    int64_t nb = A.nb();
+    int64_t rank = A.rank();
+
+    // G = V^H V, rank-by-rank.
+    std::vector<scalar_t> G(rank*rank), T(mb*rank);
+    blas::herk(blas::Layout::ColMajor, Uplo::Upper, Op::ConjTrans,
+               rank, nb,
+               1.0, A.V(), nb,
+               0.0, G.data(), rank);
+    // T = U G.
+    blas::hemm(blas::Layout::ColMajor, Side::Right, Uplo::Upper,
+               mb, rank,
+               one,  G.data(), rank, A.U(), mb,
+               zero, T.data(), mb);
+
+    // C = (alpha/2) (T U^H + U T^H) + beta C = alpha U G U^H + beta C.
+    blas::her2k(blas::Layout::ColMajor,
+                C.uploPhysical(), Op::NoTrans,
+                mb, rank,
+                scalar_t(alpha/2), T.data(), mb,
+                                   A.U(), mb,
+                beta, C.data(), C.stride());
+}
+
+//-----------------------------------------
+/// Converts rvalue refs to lvalue refs.
+/// @ingroup lowrank_tile
+///
+template <typename scalar_t>
+void herk(
+    blas::real_type<scalar_t> alpha, LowRankTile<scalar_t> const& A,
+    blas::real_type<scalar_t> beta,  Tile<scalar_t>&& C)
+{
+    herk(alpha, A, beta, C);
+}
+
+//------------------------------------------------------------------------------
+/// Triangular solve with a low-rank right-hand side:
+///     $B = \alpha op(A)^{-1} B$ or
+///     $B = \alpha B op(A)^{-1}$,
+/// where A is a dense triangular tile and B = U V^H is low-rank.
+/// Only one factor is updated, so the rank of B is unchanged:
+/// for side = Left, $U = \alpha op(A)^{-1} U$;
+/// for side = Right, $V = \bar\alpha op(A)^{-H} V$.
+/// Use transpose or conj_transpose to set $op(A)$.
+/// In the complex case, A cannot be transpose for side = Right.
+/// @ingroup lowrank_tile
+///
+template <typename scalar_t>
+void trsm(
+    Side side, Diag diag,
+    scalar_t alpha, Tile<scalar_t> const& A,
+                    LowRankTile<scalar_t>& B)
+{
+    trace::Block trace_block("blas::trsm");
+
+    using blas::conj;
+
+    assert(A.mb() == A.nb());  // square
+    assert(side == Side::Left ? A.mb() == B.mb()    // m
+                              : A.mb() == B.nb());  // n
+    if (B.rank() == 0)
+        return;
+
+    if (side == Side::Left) {
+        blas::trsm(blas::Layout::ColMajor,
+                   Side::Left, A.uploPhysical(), A.op(), diag,
+                   B.mb(), B.rank(),
+                   alpha, A.data(), A.stride(),
+                          B.U(), B.mb());
+    }
+    else {
+        // op(A)^{-H} = opH(A_physical)^{-1}.
+        Op opH;
+        if (A.op() == Op::NoTrans)
+            opH = Op::ConjTrans;
+        else if (A.op() == Op::ConjTrans || A.is_real)
+            opH = Op::NoTrans;
+        else
+            throw std::exception();
+
+        blas::trsm(blas::Layout::ColMajor,
+                   Side::Left, A.uploPhysical(), opH, diag,
+                   B.nb(), B.rank(),
+                   conj(alpha), A.data(), A.stride(),
+                                B.V(), B.nb());
+    }
+}
+
+//-----------------------------------------
+/// Converts rvalue refs to lvalue refs.
+/// @ingroup lowrank_tile
+///
+template <typename scalar_t>
+void trsm(
+    Side side, Diag diag,
+    scalar_t alpha, Tile<scalar_t> const&& A,
+                    LowRankTile<scalar_t>& B)
+{
+    trsm(side, diag, alpha, A, B);
+}
+
+} // namespace tile
+} // namespace slate
+
+#endif // SLATE_TILE_LOWRANK_HH
@@ -502,6 +502,7 @@ void getrf_tntpiv_panel(
     std::vector< char* > dwork_array, size_t dwork_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority=0);
 
 //-----------------------------------------
@@ -669,6 +670,30 @@ void norm1est(
     std::vector<int64_t>& isave,
     Options const& opts = Options());
 
+template <typename scalar_t>
+void norm1est_block(
+    Matrix<scalar_t>& X,
+    Matrix<scalar_t>& V,
+    Matrix<scalar_t>& S,
+    blas::real_type<scalar_t>* one_normest,
+    int* kase,
+    std::vector<int64_t>& isave,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// gbsv_spike, pbsv_spike
+template <typename scalar_t>
+int64_t gbsv_spike(
+    BandMatrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Options const& opts);
+
+template <typename scalar_t>
+int64_t pbsv_spike(
+    HermitianBandMatrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Options const& opts);
+
 } // namespace internal
 } // namespace slate
 
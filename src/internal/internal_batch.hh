@@ -6,11 +6,14 @@
 //------------------------------------------------------------------------------
 /// @file
 /// Provides simple precision-independent wrappers around MKL batch
-/// routines. Eventually to be replaced by BLAS++ batch routines.
+/// and packed gemm routines, and portable host batch routines used when
+/// the BLAS library has no batch interface. Eventually to be replaced by BLAS++ batch routines.
 #ifndef SLATE_INTERNAL_BATCH_HH
 #define SLATE_INTERNAL_BATCH_HH
 
 #include "slate/Exception.hh"
+#include "slate/internal/openmp.hh"
+#include "slate/internal/Trace.hh"
 
 #include <blas.hh>
 
@@ -20,6 +23,8 @@
 
 #include <complex>
 #include <set>
+#include <type_traits>
+#include <vector>
 
 namespace slate {
 namespace internal {
@@ -146,6 +151,256 @@ inline void cblas_gemm_batch(
 }
 #endif // BLAS_HAVE_MKL
 
+//------------------------------------------------------------------------------
+/// Batched gemm on host, in the grouped format of cblas_gemm_batch:
+/// group g has group_size[ g ] problems sharing op, m, n, k, alpha, beta,
+/// and leading dimensions; the A, B, and C pointer arrays hold the problems
+/// group by group.
+///
+/// With Intel MKL, adjacent groups with identical parameters are merged,
+/// so uniformly tiled updates become a few large groups, and
+/// cblas_gemm_batch is called.
+/// Otherwise, the problems are distributed over the threads of the
+/// enclosing OpenMP team with a taskloop, each calling blas::gemm,
+/// so Target::HostBatch works with any BLAS library.
+///
+template <typename scalar_t>
+void gemm_batch(
+    Layout layout,
+    Op const* opA_array,
+    Op const* opB_array,
+    int const* m_array,
+    int const* n_array,
+    int const* k_array,
+    scalar_t const* alpha_array,
+    scalar_t const** A_array,
+    int const* lda_array,
+    scalar_t const** B_array,
+    int const* ldb_array,
+    scalar_t const* beta_array,
+    scalar_t** C_array,
+    int const* ldc_array,
+    int group_count,
+    int const* group_size)
+{
+    // Merge adjacent groups with identical parameters.
+    std::vector<int> group_begin;
+    std::vector<int> merged_size;
+    for (int g = 0; g < group_count; ++g) {
+        int h = group_begin.empty() ? -1 : group_begin.back();
+        if (h >= 0
+            && opA_array[ g ] == opA_array[ h ]
+            && opB_array[ g ] == opB_array[ h ]
+            && m_array[ g ] == m_array[ h ]
+            && n_array[ g ] == n_array[ h ]
+            && k_array[ g ] == k_array[ h ]
+            && alpha_array[ g ] == alpha_array[ h ]
+            && beta_array[ g ] == beta_array[ h ]
+            && lda_array[ g ] == lda_array[ h ]
+            && ldb_array[ g ] == ldb_array[ h ]
+            && ldc_array[ g ] == ldc_array[ h ])
+        {
+            merged_size.back() += group_size[ g ];
+        }
+        else {
+            group_begin.push_back( g );
+            merged_size.push_back( group_size[ g ] );
+        }
+    }
+    int merged_count = group_begin.size();
+
+#ifdef BLAS_HAVE_MKL
+    trace::Block trace_block("cblas_gemm_batch");
+
+    std::vector<CBLAS_TRANSPOSE> opA_merged( merged_count );
+    std::vector<CBLAS_TRANSPOSE> opB_merged( merged_count );
+    std::vector<int> m_merged( merged_count ), n_merged( merged_count ),
+                     k_merged( merged_count );
+    std::vector<int> lda_merged( merged_count ), ldb_merged( merged_count ),
+                     ldc_merged( merged_count );
+    std::vector<scalar_t> alpha_merged( merged_count ),
+                          beta_merged( merged_count );
+    for (int g = 0; g < merged_count; ++g) {
+        int h = group_begin[ g ];
+        opA_merged[ g ]   = cblas_trans_const( opA_array[ h ] );
+        opB_merged[ g ]   = cblas_trans_const( opB_array[ h ] );
+        m_merged[ g ]     = m_array[ h ];
+        n_merged[ g ]     = n_array[ h ];
+        k_merged[ g ]     = k_array[ h ];
+        lda_merged[ g ]   = lda_array[ h ];
+        ldb_merged[ g ]   = ldb_array[ h ];
+        ldc_merged[ g ]   = ldc_array[ h ];
+        alpha_merged[ g ] = alpha_array[ h ];
+        beta_merged[ g ]  = beta_array[ h ];
+    }
+    cblas_gemm_batch(
+        (layout == Layout::ColMajor ? CblasColMajor : CblasRowMajor),
+        opA_merged.data(), opB_merged.data(),
+        m_merged.data(), n_merged.data(), k_merged.data(),
+        alpha_merged.data(), A_array, lda_merged.data(),
+                             B_array, ldb_merged.data(),
+        beta_merged.data(),  C_array, ldc_merged.data(),
+        merged_count, merged_size.data());
+#else
+    trace::Block trace_block("gemm_batch");
+
+    // Map each problem to its (unmerged) group.
+    std::vector<int> problem_group;
+    for (int g = 0; g < group_count; ++g)
+        problem_group.insert( problem_group.end(), group_size[ g ], g );
+    int64_t batch_count = problem_group.size();
+
+    #pragma omp taskloop slate_omp_default_none \
+        shared( problem_group, opA_array, opB_array, m_array, n_array, \
+                k_array, alpha_array, A_array, lda_array, B_array, \
+                ldb_array, beta_array, C_array, ldc_array ) \
+        firstprivate( layout, batch_count )
+    for (int64_t index = 0; index < batch_count; ++index) {
+        int g = problem_group[ index ];
+        blas::gemm( layout, opA_array[ g ], opB_array[ g ],
+                    m_array[ g ], n_array[ g ], k_array[ g ],
+                    alpha_array[ g ], A_array[ index ], lda_array[ g ],
+                                      B_array[ index ], ldb_array[ g ],
+                    beta_array[ g ],  C_array[ index ], ldc_array[ g ] );
+    }
+#endif
+}
+
+//------------------------------------------------------------------------------
+/// Batched trsm on host with a single triangular matrix A:
+/// B_array[ i ] = alpha op(A)^{-1} B_array[ i ] or
+/// B_array[ i ] = alpha B_array[ i ] op(A)^{-1}.
+/// The problems are distributed over the threads of the enclosing
+/// OpenMP team with a taskloop, each calling blas::trsm.
+///
+template <typename scalar_t>
+void trsm_batch(
+    Layout layout, Side side, Uplo uplo, Op opA, Diag diag,
+    int const* m_array,
+    int const* n_array,
+    scalar_t alpha,
+    scalar_t const* A, int lda,
+    scalar_t** B_array,
+    int const* ldb_array,
+    int64_t batch_count)
+{
+    trace::Block trace_block("trsm_batch");
+
+    #pragma omp taskloop slate_omp_default_none \
+        shared( m_array, n_array, B_array, ldb_array ) \
+        firstprivate( layout, side, uplo, opA, diag, alpha, A, lda, \
+                      batch_count )
+    for (int64_t index = 0; index < batch_count; ++index) {
+        blas::trsm( layout, side, uplo, opA, diag,
+                    m_array[ index ], n_array[ index ],
+                    alpha, A, lda,
+                           B_array[ index ], ldb_array[ index ] );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @return whether gemm_pack and gemm_compute are available for scalar_t:
+/// with Intel MKL, in real precisions.
+///
+template <typename scalar_t>
+constexpr bool gemm_pack_available()
+{
+#ifdef BLAS_HAVE_MKL
+    return std::is_same<scalar_t, float>::value
+           || std::is_same<scalar_t, double>::value;
+#else
+    return false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+/// @return size in bytes of the buffer for gemm_pack of the A operand
+/// (is_A = true) or B operand (is_A = false) of an m-by-n-by-k gemm.
+///
+template <typename scalar_t>
+size_t gemm_pack_size(bool is_A, int m, int n, int k)
+{
+#ifdef BLAS_HAVE_MKL
+    CBLAS_IDENTIFIER identifier = is_A ? CblasAMatrix : CblasBMatrix;
+    if constexpr (std::is_same<scalar_t, float>::value)
+        return cblas_sgemm_pack_get_size( identifier, m, n, k );
+    else if constexpr (std::is_same<scalar_t, double>::value)
+        return cblas_dgemm_pack_get_size( identifier, m, n, k );
+#endif
+    slate_not_implemented( "gemm_pack requires Intel MKL, in real precisions" );
+}
+
+//------------------------------------------------------------------------------
+/// Packs alpha op(src), the A operand (is_A = true) or B operand
+/// (is_A = false) of an m-by-n-by-k gemm, into dst, in the BLAS library's
+/// internal format, so gemm_compute calls sharing the operand skip
+/// repacking it. dst has gemm_pack_size bytes.
+///
+template <typename scalar_t>
+void gemm_pack(
+    Layout layout, bool is_A, Op op,
+    int m, int n, int k,
+    scalar_t alpha, scalar_t const* src, int ld,
+    scalar_t* dst)
+{
+    trace::Block trace_block("blas::gemm_pack");
+
+#ifdef BLAS_HAVE_MKL
+    CBLAS_LAYOUT layout_ = layout == Layout::ColMajor ? CblasColMajor
+                                                      : CblasRowMajor;
+    CBLAS_IDENTIFIER identifier = is_A ? CblasAMatrix : CblasBMatrix;
+    if constexpr (std::is_same<scalar_t, float>::value) {
+        cblas_sgemm_pack( layout_, identifier, cblas_trans_const( op ),
+                          m, n, k, alpha, src, ld, dst );
+        return;
+    }
+    else if constexpr (std::is_same<scalar_t, double>::value) {
+        cblas_dgemm_pack( layout_, identifier, cblas_trans_const( op ),
+                          m, n, k, alpha, src, ld, dst );
+        return;
+    }
+#endif
+    slate_not_implemented( "gemm_pack requires Intel MKL, in real precisions" );
+}
+
+//------------------------------------------------------------------------------
+/// gemm C = op(A) op(B) + beta C, where A, B, or both were packed by
+/// gemm_pack for the same m, k (A) or k, n (B); alpha was applied when
+/// packing. For a packed operand, op and ld are ignored.
+///
+template <typename scalar_t>
+void gemm_compute(
+    Layout layout,
+    Op opA, bool packed_A,
+    Op opB, bool packed_B,
+    int m, int n, int k,
+    scalar_t const* A, int lda,
+    scalar_t const* B, int ldb,
+    scalar_t beta, scalar_t* C, int ldc)
+{
+    trace::Block trace_block("blas::gemm");
+
+#ifdef BLAS_HAVE_MKL
+    CBLAS_LAYOUT layout_ = layout == Layout::ColMajor ? CblasColMajor
+                                                      : CblasRowMajor;
+    MKL_INT transA = packed_A ? MKL_INT( CblasPacked )
+                              : MKL_INT( cblas_trans_const( opA ) );
+    MKL_INT transB = packed_B ? MKL_INT( CblasPacked )
+                              : MKL_INT( cblas_trans_const( opB ) );
+    if constexpr (std::is_same<scalar_t, float>::value) {
+        cblas_sgemm_compute( layout_, transA, transB, m, n, k,
+                             A, lda, B, ldb, beta, C, ldc );
+        return;
+    }
+    else if constexpr (std::is_same<scalar_t, double>::value) {
+        cblas_dgemm_compute( layout_, transA, transB, m, n, k,
+                             A, lda, B, ldb, beta, C, ldc );
+        return;
+    }
+#endif
+    slate_not_implemented( "gemm_compute requires Intel MKL, in real precisions" );
+}
+
 } // namespace slate
 } // namespace internal
 
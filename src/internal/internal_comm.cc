@@ -8,6 +8,7 @@
 #include "internal/internal_util.hh"
 #include "slate/internal/Trace.hh"
 
+#include <algorithm>
 #include <cassert>
 #include <vector>
 
@@ -122,5 +123,98 @@ void cubeReducePattern(int size, int rank, int radix,
     cubeBcastPattern(size, rank, radix, send_to, recv_from);
 }
 
+//------------------------------------------------------------------------------
+/// [internal]
+/// Finds the ranks to receive from and the rank to send to for a reduction
+/// of one tile over reduce_set to root, according to plan.
+/// Without node ids, this is the cube reduction over the set,
+/// starting from root, with radix plan.radix.
+/// With node ids, ranks first reduce to their node's leader (the root on
+/// its node, otherwise the lowest participating rank), then the leaders
+/// reduce to the root, each with a cube reduction.
+///
+/// @param[in] reduce_set
+///     Ranks participating in the reduction, including root.
+///
+/// @param[in] root
+///     Rank receiving the sum.
+///
+/// @param[in] rank
+///     Rank of the local process.
+///
+/// @param[in] plan
+///     Radix and node ids.
+///
+/// @param[out] recv_from
+///     Ranks to receive and accumulate from, in order.
+///
+/// @param[out] send_to
+///     Rank to send the partial sum to, or -1 for the root.
+///
+void reducePattern(std::set<int> const& reduce_set, int root, int rank,
+                   ReducePlan const& plan,
+                   std::vector<int>& recv_from, int& send_to)
+{
+    recv_from.clear();
+    send_to = -1;
+
+    // Order ranks starting from root.
+    std::vector<int> ranks(reduce_set.begin(), reduce_set.end());
+    auto root_iter = std::find(ranks.begin(), ranks.end(), root);
+    assert(root_iter != ranks.end());
+    std::rotate(ranks.begin(), root_iter, ranks.end());
+
+    // Cube reduction over members, with members[0] as its root.
+    auto cube = [&](std::vector<int> const& members) {
+        int position = std::find(members.begin(), members.end(), rank)
+                     - members.begin();
+        std::list<int> from, to;
+        cubeReducePattern(members.size(), position, plan.radix, from, to);
+        for (int src : from)
+            recv_from.push_back(members[src]);
+        if (! to.empty())
+            send_to = members[to.front()];
+    };
+
+    if (plan.node_ids.empty()) {
+        cube(ranks);
+        return;
+    }
+
+    // Ranks on this node, and leaders of all nodes, in order from root.
+    int node = plan.node_ids[rank];
+    std::vector<int> node_ranks, leaders;
+    std::set<int> nodes_seen;
+    for (int r : ranks) {
+        if (plan.node_ids[r] == node)
+            node_ranks.push_back(r);
+        if (nodes_seen.insert(plan.node_ids[r]).second)
+            leaders.push_back(r);
+    }
+    cube(node_ranks);
+    if (rank == node_ranks[0])
+        cube(leaders);
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Builds a ReducePlan from options:
+/// Option::ReduceRadix, Option::ReduceSegment, Option::ReduceScatter,
+/// and Option::ReduceNodeAware.
+/// Collective over comm if Option::ReduceNodeAware is set.
+///
+ReducePlan reducePlan(Options const& opts, MPI_Comm comm)
+{
+    ReducePlan plan;
+    plan.radix = get_option<int64_t>( opts, Option::ReduceRadix, 2 );
+    slate_assert( plan.radix >= 2 );
+    plan.segment_size = get_option<int64_t>( opts, Option::ReduceSegment, 0 );
+    slate_assert( plan.segment_size >= 0 );
+    plan.scatter = get_option<int64_t>( opts, Option::ReduceScatter, 0 ) != 0;
+    if (get_option<int64_t>( opts, Option::ReduceNodeAware, 0 ) != 0)
+        plan.node_ids = mpi_node_ids( comm );
+    return plan;
+}
+
 } // namespace internal
 } // namespace slate
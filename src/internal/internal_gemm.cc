@@ -8,6 +8,10 @@
 #include "slate/Tile_blas.hh"
 #include "internal/internal.hh"
 #include "internal/internal_batch.hh"
+#include "internal/Tile_gemm_ozaki.hh"
+#include "internal/Tile_gemm_split.hh"
+
+#include <map>
 
 namespace slate {
 namespace internal {
@@ -50,10 +54,277 @@ void gemm(scalar_t alpha, Matrix<scalar_t>&& A,
          layout, priority, queue_index, opts);
 }
 
+//------------------------------------------------------------------------------
+/// Host OpenMP task gemm update whose A and B tiles are converted once and
+/// reused across local C tiles; shared by gemm_packed, gemm_split, and
+/// gemm_ozaki. Calls prepare_A( i, j ) for each A(i, 0) used by a local C
+/// tile, and prepare_B( i, j ) for each B(0, j) used by at least
+/// B_min_uses local C tiles, where C(i, j) is one such local tile.
+/// After those tasks finish, calls multiply( i, j, C(i, j) ) for each local
+/// C(i, j), after getting it for writing.
+/// @ingroup gemm_internal
+///
+template <typename scalar_t, typename prepare_A_t, typename prepare_B_t,
+          typename multiply_t>
+void gemm_prepared(
+    Matrix<scalar_t>& A, Matrix<scalar_t>& B, Matrix<scalar_t>& C,
+    Layout layout, int priority, bool call_tile_tick, int64_t B_min_uses,
+    prepare_A_t prepare_A, prepare_B_t prepare_B, multiply_t multiply)
+{
+    // Count local C tiles using each A(i, 0) and B(0, j), and record one
+    // such C tile.
+    std::vector<int64_t> A_uses( C.mt(), 0 ), B_uses( C.nt(), 0 );
+    std::vector<int64_t> A_j( C.mt() ), B_i( C.nt() );
+    for (int64_t i = 0; i < C.mt(); ++i) {
+        for (int64_t j = 0; j < C.nt(); ++j) {
+            if (C.tileIsLocal(i, j)) {
+                ++A_uses[ i ];
+                ++B_uses[ j ];
+                A_j[ i ] = j;
+                B_i[ j ] = i;
+            }
+        }
+    }
+
+    int err = 0;
+    std::string err_msg;
+    #pragma omp taskgroup
+    {
+        for (int64_t i = 0; i < C.mt(); ++i) {
+            if (A_uses[ i ] > 0) {
+                int64_t j = A_j[ i ];
+                #pragma omp task slate_omp_default_none \
+                    shared( prepare_A, err, err_msg ) \
+                    firstprivate( i, j ) priority( priority )
+                {
+                    try {
+                        prepare_A( i, j );
+                    }
+                    catch (std::exception& e) {
+                        err = __LINE__;
+                        err_msg = std::string(e.what());
+                    }
+                }
+            }
+        }
+        for (int64_t j = 0; j < C.nt(); ++j) {
+            if (B_uses[ j ] >= B_min_uses) {
+                int64_t i = B_i[ j ];
+                #pragma omp task slate_omp_default_none \
+                    shared( prepare_B, err, err_msg ) \
+                    firstprivate( i, j ) priority( priority )
+                {
+                    try {
+                        prepare_B( i, j );
+                    }
+                    catch (std::exception& e) {
+                        err = __LINE__;
+                        err_msg = std::string(e.what());
+                    }
+                }
+            }
+        }
+    }
+
+    if (err)
+        slate_error(err_msg+", line "+std::to_string(err));
+
+    // Without a host instance of C(i, j) yet, there is nothing to be near.
+    scalar_t no_tile = 0;
+    #pragma omp taskgroup
+    for (int64_t i = 0; i < C.mt(); ++i) {
+        for (int64_t j = 0; j < C.nt(); ++j) {
+            if (C.tileIsLocal(i, j)) {
+                scalar_t* C_ij = C.tileExists(i, j) ? C(i, j).data() : &no_tile;
+                #pragma omp task slate_omp_default_none \
+                    shared( A, B, C, multiply, err, err_msg ) \
+                    firstprivate(i, j, layout, call_tile_tick) \
+                    priority(priority) slate_omp_affinity( C_ij[ 0 ] )
+                {
+                    try {
+                        C.tileGetForWriting(i, j, LayoutConvert(layout));
+                        auto Cij = C(i, j);
+                        multiply( i, j, Cij );
+                        if (call_tile_tick) {
+                            A.tileTick(i, 0);
+                            B.tileTick(0, j);
+                        }
+                    }
+                    catch (std::exception& e) {
+                        err = __LINE__;
+                        err_msg = std::string(e.what());
+                    }
+                }
+            }
+        }
+    }
+
+    if (err)
+        slate_error(err_msg+", line "+std::to_string(err));
+}
+
+//------------------------------------------------------------------------------
+/// Host OpenMP task gemm update with packed operands, for types with
+/// gemm_pack_available. Each A(i, 0) is packed, scaled by alpha, and
+/// each B(0, j) used by more than one local C tile is packed; then each
+/// local C(i, j) is updated by gemm_compute. So the BLAS library does not
+/// repack A(i, 0) for every C(i, j) in block row i, nor B(0, j) for every
+/// C(i, j) in block column j.
+/// The packed format depends on all gemm dimensions, so A(i, 0) is packed
+/// once per distinct width of local C tiles in block row i, usually nb and
+/// the edge tile's, and B(0, j) once per distinct height in block column j.
+/// Tiles of A and B must be on the host in the given layout; op(C) must be
+/// NoTrans.
+/// @ingroup gemm_internal
+///
+template <typename scalar_t>
+void gemm_packed(
+    scalar_t alpha, Matrix<scalar_t>& A,
+                    Matrix<scalar_t>& B,
+    scalar_t beta,  Matrix<scalar_t>& C,
+    Layout layout, int priority, bool call_tile_tick)
+{
+    assert(C.op() == Op::NoTrans);
+
+    // A tiles are always packed, to apply alpha once per product;
+    // B tiles only if reused. Packed A(i, 0) are keyed by the width n of
+    // C(i, j), packed B(0, j) by the height m of C(i, j).
+    using packed_t = std::map< int64_t, std::vector<scalar_t> >;
+    std::vector< packed_t > A_packed( C.mt() ), B_packed( C.nt() );
+
+    gemm_prepared(
+        A, B, C, layout, priority, call_tile_tick, 2,
+        [&]( int64_t i, int64_t ) {
+            auto Ai0 = A(i, 0);
+            int m = Ai0.mb();
+            int k = Ai0.nb();
+            for (int64_t j = 0; j < C.nt(); ++j) {
+                int n = C.tileNb( j );
+                if (C.tileIsLocal( i, j ) && A_packed[ i ].count( n ) == 0) {
+                    auto& packed = A_packed[ i ][ n ];
+                    size_t bytes = gemm_pack_size<scalar_t>( true, m, n, k );
+                    packed.resize( ceildiv( bytes, sizeof(scalar_t) ) );
+                    gemm_pack( layout, true, Ai0.op(), m, n, k,
+                               alpha, Ai0.data(), Ai0.stride(),
+                               packed.data() );
+                }
+            }
+        },
+        [&]( int64_t, int64_t j ) {
+            auto B0j = B(0, j);
+            int n = B0j.nb();
+            int k = B0j.mb();
+            for (int64_t i = 0; i < C.mt(); ++i) {
+                int m = C.tileMb( i );
+                if (C.tileIsLocal( i, j ) && B_packed[ j ].count( m ) == 0) {
+                    auto& packed = B_packed[ j ][ m ];
+                    size_t bytes = gemm_pack_size<scalar_t>( false, m, n, k );
+                    packed.resize( ceildiv( bytes, sizeof(scalar_t) ) );
+                    gemm_pack( layout, false, B0j.op(), m, n, k,
+                               scalar_t( 1.0 ), B0j.data(), B0j.stride(),
+                               packed.data() );
+                }
+            }
+        },
+        [&]( int64_t i, int64_t j, Tile<scalar_t>& Cij ) {
+            auto Ai0 = A(i, 0);
+            auto B0j = B(0, j);
+            scalar_t const* A_data = A_packed[ i ].at( Cij.nb() ).data();
+            auto B_iter = B_packed[ j ].find( Cij.mb() );
+            bool packed_B = B_iter != B_packed[ j ].end();
+            gemm_compute(
+                layout, Ai0.op(), true, B0j.op(), packed_B,
+                Cij.mb(), Cij.nb(), Ai0.nb(),
+                A_data, Ai0.stride(),
+                (packed_B ? B_iter->second.data() : B0j.data()),
+                B0j.stride(),
+                beta, Cij.data(), Cij.stride() );
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// Host OpenMP task complex gemm update using real gemm, for
+/// ComplexGemm::Real4M or Real3M. Each A(i, 0), scaled by alpha, and each
+/// B(0, j) used by local C tiles is split once into real and imaginary
+/// parts; then each local C(i, j) is updated by tile::gemm_split.
+/// Tiles of A and B must be on the host; op(C) must be NoTrans.
+/// @ingroup gemm_internal
+///
+template <typename scalar_t>
+void gemm_split(
+    ComplexGemm method,
+    scalar_t alpha, Matrix<scalar_t>& A,
+                    Matrix<scalar_t>& B,
+    scalar_t beta,  Matrix<scalar_t>& C,
+    Layout layout, int priority, bool call_tile_tick)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    assert(C.op() == Op::NoTrans);
+
+    std::vector< tile::SplitTile<real_t> > A_split( C.mt() ), B_split( C.nt() );
+
+    gemm_prepared(
+        A, B, C, layout, priority, call_tile_tick, 1,
+        [&]( int64_t i, int64_t j ) {
+            A_split[ i ].split( alpha, A(i, 0), method );
+        },
+        [&]( int64_t i, int64_t j ) {
+            B_split[ j ].split( scalar_t( 1.0 ), B(0, j), method );
+        },
+        [&]( int64_t i, int64_t j, Tile<scalar_t>& Cij ) {
+            tile::gemm_split( method, A_split[ i ], B_split[ j ], beta, Cij );
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// Host OpenMP task double-precision gemm update emulated with
+/// single-precision gemm (Ozaki scheme), for Option::OzakiSlices > 0.
+/// Each A(i, 0) and B(0, j) used by local C tiles is split once into
+/// slices; then each local C(i, j) is updated by tile::gemm_ozaki, or by
+/// native gemm if A(i, 0) or B(0, j) has Inf or NaN.
+/// Tiles of A and B must be on the host; op(C) must be NoTrans.
+/// @ingroup gemm_internal
+///
+inline void gemm_ozaki(
+    int64_t slices,
+    double alpha, Matrix<double>& A,
+                  Matrix<double>& B,
+    double beta,  Matrix<double>& C,
+    Layout layout, int priority, bool call_tile_tick)
+{
+    assert(C.op() == Op::NoTrans);
+
+    std::vector< tile::OzakiTile > A_slices( C.mt() ), B_slices( C.nt() );
+
+    gemm_prepared(
+        A, B, C, layout, priority, call_tile_tick, 1,
+        [&]( int64_t i, int64_t j ) {
+            A_slices[ i ].split( A(i, 0), true, slices );
+        },
+        [&]( int64_t i, int64_t j ) {
+            B_slices[ j ].split( B(0, j), false, slices );
+        },
+        [&]( int64_t i, int64_t j, Tile<double>& Cij ) {
+            if (A_slices[ i ].finite() && B_slices[ j ].finite())
+                tile::gemm_ozaki( alpha, A_slices[ i ], B_slices[ j ], beta, Cij );
+            else
+                tile::gemm( alpha, A(i, 0), B(0, j), beta, Cij );
+        } );
+}
+
 //------------------------------------------------------------------------------
 /// General matrix multiply to update trailing matrix,
 /// where A is a single block column and B is a single block row.
 /// Host OpenMP task implementation.
+/// With Option::PackedGemm (default false), for types with
+/// gemm_pack_available, and op(C) = NoTrans, shared A and B tiles are
+/// packed once and reused across C tiles; see gemm_packed.
+/// With Option::ComplexGemm = Real4M or Real3M, complex types, and
+/// op(C) = NoTrans, tiles are multiplied with real gemm; see gemm_split.
+/// With Option::OzakiSlices > 0, double, and op(C) = NoTrans,
+/// double-precision gemm is emulated with single-precision gemm;
+/// see gemm_ozaki.
 /// @ingroup gemm_internal
 ///
 template <typename scalar_t>
@@ -94,14 +365,53 @@ void gemm(internal::TargetType<Target::HostTask>,
     A.tileGetForReading(A_tiles_set, LayoutConvert(layout));
     B.tileGetForReading(B_tiles_set, LayoutConvert(layout));
 
+    if constexpr (std::is_same<scalar_t, double>::value) {
+        int64_t ozaki_slices = get_option<int64_t>(
+            opts, Option::OzakiSlices, 0 );
+        if (ozaki_slices > 0
+            && C.op() == Op::NoTrans
+            && ! DryRun::enabled())
+        {
+            gemm_ozaki( ozaki_slices, alpha, A, B, beta, C,
+                        layout, priority, call_tile_tick );
+            return;
+        }
+    }
+
+    // A dry run counts flops in tile::gemm, so it takes the per-tile path.
+    bool packed = gemm_pack_available<scalar_t>()
+                  && get_option<int64_t>( opts, Option::PackedGemm, 0 ) != 0
+                  && C.op() == Op::NoTrans
+                  && ! DryRun::enabled();
+    if (packed) {
+        gemm_packed( alpha, A, B, beta, C, layout, priority, call_tile_tick );
+        return;
+    }
+
+    if constexpr (is_complex<scalar_t>::value) {
+        ComplexGemm complex_gemm = get_option(
+            opts, Option::ComplexGemm, ComplexGemm::Native );
+        if (complex_gemm != ComplexGemm::Native
+            && C.op() == Op::NoTrans
+            && ! DryRun::enabled())
+        {
+            gemm_split( complex_gemm, alpha, A, B, beta, C,
+                        layout, priority, call_tile_tick );
+            return;
+        }
+    }
+
     #pragma omp taskgroup
     for (int64_t i = 0; i < C.mt(); ++i) {
         for (int64_t j = 0; j < C.nt(); ++j) {
             if (C.tileIsLocal(i, j)) {
+                // Hint to run the update on the NUMA domain holding C(i, j);
+                // without a host instance yet, there is nothing to be near.
+                scalar_t* C_ij = C.tileExists(i, j) ? C(i, j).data() : &beta;
                 #pragma omp task slate_omp_default_none \
                     shared( A, B, C, err, err_msg ) \
                     firstprivate(i, j, layout, alpha, beta, call_tile_tick) \
-                    priority(priority)
+                    priority(priority) slate_omp_affinity( C_ij[ 0 ] )
                 {
                     try {
                         C.tileGetForWriting(i, j, LayoutConvert(layout));
@@ -201,7 +511,6 @@ void gemm(internal::TargetType<Target::HostBatch>,
           Layout layout, int priority, int64_t queue_index,
           Options const& opts )
 {
-#ifdef BLAS_HAVE_MKL
     using blas::conj;
     using std::swap;
     using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
@@ -280,11 +589,9 @@ void gemm(internal::TargetType<Target::HostBatch>,
         }
 
         // all same
-        std::vector<CBLAS_TRANSPOSE> opA_array(batch_count,
-                                               cblas_trans_const(opA));
+        std::vector<Op> opA_array(batch_count, opA);
         // all same
-        std::vector<CBLAS_TRANSPOSE> opB_array(batch_count,
-                                               cblas_trans_const(opB));
+        std::vector<Op> opB_array(batch_count, opB);
         std::vector<int> m_array(batch_count);
         std::vector<int> n_array(batch_count);
         std::vector<int> k_array(batch_count);
@@ -332,11 +639,9 @@ void gemm(internal::TargetType<Target::HostBatch>,
         }
 
         {
-            trace::Block trace_block("cblas_gemm_batch");
-            // mkl_set_num_threads_local(...);
             if (layout == Layout::ColMajor) {
-                cblas_gemm_batch(
-                    CblasColMajor,
+                gemm_batch(
+                    Layout::ColMajor,
                     opA_array.data(), opB_array.data(),
                     m_array.data(), n_array.data(), k_array.data(),
                     alpha_array.data(), a_array.data(), lda_array.data(),
@@ -345,8 +650,8 @@ void gemm(internal::TargetType<Target::HostBatch>,
                     batch_count, group_size.data());
             }
             else {
-                cblas_gemm_batch(
-                    CblasColMajor,
+                gemm_batch(
+                    Layout::ColMajor,
                     opB_array.data(), opA_array.data(),
                     n_array.data(), m_array.data(), k_array.data(),
                     alpha_array.data(), b_array.data(), ldb_array.data(),
@@ -354,7 +659,6 @@ void gemm(internal::TargetType<Target::HostBatch>,
                     beta_array.data(),  c_array.data(), ldc_array.data(),
                     batch_count, group_size.data());
             }
-            // mkl_set_num_threads_local(1);
         }
 
         for (int64_t i = 0; i < C.mt(); ++i) {
@@ -367,9 +671,6 @@ void gemm(internal::TargetType<Target::HostBatch>,
             }
         }
     }
-#else
-    slate_not_implemented( "HostBatch requires Intel MKL" );
-#endif
 }
 
 //------------------------------------------------------------------------------
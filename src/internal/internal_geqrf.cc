@@ -8,8 +8,10 @@
 #include "slate/types.hh"
 #include "internal/Tile_geqrf.hh"
 #include "internal/internal.hh"
+#include "internal/internal_thread_team.hh"
 #include "lapack.hh"
 #include "lapack/device.hh"
+#include "lapack/flops.hh"
 #include "blas/device.hh"
 
 namespace slate {
@@ -85,36 +87,33 @@ void geqrf(
         auto T00 = T(tile_indices[0], 0);
         T00.set(0);
 
+        // In a dry run, count the flops of this rank's rows instead.
+        if (DryRun::enabled()) {
+            int64_t mlocal = 0;
+            for (auto& tile : tiles)
+                mlocal += tile.mb();
+            DryRun::flops(
+                lapack::Gflop<scalar_t>::geqrf( mlocal, A.tileNb( 0 ) ) );
+            return;
+        }
+
         ThreadBarrier thread_barrier;
         std::vector<real_t> scale(thread_size);
         std::vector<real_t> sumsq(thread_size);
         real_t xnorm;
         std::vector< std::vector<scalar_t> > W(thread_size);
 
-        #if 1
-            #pragma omp parallel slate_omp_default_none \
-                num_threads(thread_size) \
-                shared(thread_barrier, scale, sumsq, xnorm, W, A, T00) \
-                shared(tile_indices, tiles) \
-                firstprivate(ib, thread_size)
-        #else
-            #pragma omp taskloop slate_omp_default_none \
-                num_tasks(thread_size) \
-                shared(thread_barrier, scale, sumsq, xnorm, W, A, T00) \
-                shared(tile_indices, tiles) \
-                firstprivate(ib, thread_size)
-        #endif
-        {
+        // Run the panel on a gang of persistent threads; see getrf_panel.
+        ThreadTeam::pool().run( thread_size, [&]( int thread_rank ) {
             // Factor the panel in parallel.
             // todo: double check the size of W.
-            int thread_rank = omp_get_thread_num();
             W.at(thread_rank).resize(ib*A.tileNb(0));
             geqrf(ib,
                   tiles, tile_indices, T00,
                   thread_rank, thread_size,
                   thread_barrier,
                   scale, sumsq, xnorm, W);
-        }
+        } );
     }
 }
 
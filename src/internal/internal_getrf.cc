@@ -8,6 +8,7 @@
 #include "slate/types.hh"
 #include "internal/Tile_getrf.hh"
 #include "internal/internal.hh"
+#include "internal/internal_thread_team.hh"
 
 namespace slate {
 
@@ -28,6 +29,33 @@ void getrf_panel(
     using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
     assert(A.nt() == 1);
 
+    // In a dry run, the panel is neither factored nor communicated, so its
+    // ranks need not be launched; count the flops of this rank's rows.
+    // All ranks take the same stand-in pivots, with pivot i from block
+    // row 1 + i mod (mt - 1), spreading the row swaps over the panel
+    // as pivots of a random matrix are.
+    if (DryRun::enabled()) {
+        int64_t mlocal = 0;
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal( i, 0 ))
+                mlocal += A.tileMb( i );
+        }
+        if (mlocal > 0) {
+            DryRun::flops(
+                lapack::Gflop<scalar_t>::getrf( mlocal, A.tileNb( 0 ) ) );
+        }
+        for (int64_t i = 0; i < diag_len; ++i) {
+            if (A.mt() > 1) {
+                int64_t tile_index = 1 + i % (A.mt() - 1);
+                pivot[ i ] = Pivot( tile_index, i % A.tileMb( tile_index ) );
+            }
+            else {
+                pivot[ i ] = Pivot( 0, i );
+            }
+        }
+        return;
+    }
+
     // Move the panel to the host.
     std::set<ij_tuple> A_tiles_set;
     for (int64_t i = 0; i < A.mt(); ++i) {
@@ -79,23 +107,11 @@ void getrf_panel(
         std::vector<scalar_t> top_block(ib*A.tileNb(0));
         std::vector< AuxPivot<scalar_t> > aux_pivot(diag_len);
 
-        #if 1
-            // Launching new threads for the panel guarantees progression.
-            // This should never deadlock, but may be detrimental to performance.
-            #pragma omp parallel for num_threads(thread_size) slate_omp_default_none \
-                shared(thread_barrier, max_value, max_index, max_offset) \
-                shared(top_block, aux_pivot, tiles, bcast_comm) \
-                firstprivate( tile_indices, bcast_root, bcast_rank, ib, \
-                              diag_len, thread_size, pivot_threshold )
-        #else
-            // Issuing panel operation as tasks may cause a deadlock.
-            #pragma omp taskloop num_tasks(thread_size) slate_omp_default_none \
-                shared(thread_barrier, max_value, max_index, max_offset) \
-                shared(top_block, aux_pivot, tiles, bcast_comm) \
-                firstprivate( tile_indices, bcast_root, bcast_rank, ib, \
-                              diag_len, thread_size, pivot_threshold )
-        #endif
-        for (int thread_rank = 0; thread_rank < thread_size; ++thread_rank) {
+        // Run the panel on a gang of persistent threads. Dedicated threads
+        // guarantee progression, as a nested parallel region did, without
+        // creating a new team for every panel.
+        // Issuing panel operations as tasks may cause a deadlock.
+        ThreadTeam::pool().run( thread_size, [&]( int thread_rank ) {
             // Factor the panel in parallel.
             getrf(diag_len, ib,
                   tiles, tile_indices,
@@ -105,7 +121,7 @@ void getrf_panel(
                   thread_barrier,
                   max_value, max_index, max_offset, top_block,
                   pivot_threshold);
-        }
+        } );
 
         // Copy pivot information from aux_pivot to pivot.
         for (int64_t i = 0; i < diag_len; ++i) {
@@ -9,6 +9,7 @@
 #include "internal/Tile_getrf.hh"
 #include "internal/Tile_getrf_tntpiv.hh"
 #include "internal/internal.hh"
+#include "internal/internal_thread_team.hh"
 #include "internal/internal_util.hh"
 #include "lapack.hh"
 #include "lapack/device.hh"
@@ -202,22 +203,8 @@ void getrf_tntpiv_local(
     std::vector<int64_t>  max_offset( thread_size );
     std::vector<scalar_t> top_block( ib * nb );
 
-    #if 1
-        // todo: this can be just `omp parallel` (no for). cf. internal_geqrf.cc
-        // Launching new threads for the panel guarantees progression.
-        // This should never deadlock, but may be detrimental to performance.
-        #pragma omp parallel for \
-                    num_threads( thread_size ) \
-                    shared( thread_barrier, max_value, max_index, max_offset, \
-                            top_block, aux_pivot )
-    #else
-        // Issuing panel operation as tasks may cause a deadlock.
-        #pragma omp taskloop \
-                    num_tasks( thread_size ) \
-                    shared( thread_barrier, max_value, max_index, max_offset, \
-                            top_block, aux_pivot )
-    #endif
-    for (int thread_id = 0; thread_id < thread_size; ++thread_id) {
+    // Run the panel on a gang of persistent threads; see getrf_panel.
+    ThreadTeam::pool().run( thread_size, [&]( int thread_id ) {
         // Factor the local panel in parallel.
         tile::getrf_tntpiv_local(
             diag_len, ib, stage,
@@ -227,7 +214,7 @@ void getrf_tntpiv_local(
             thread_id, thread_size,
             thread_barrier,
             max_value, max_index, max_offset, top_block);
-    }
+    } );
 }
 
 //------------------------------------------------------------------------------
@@ -342,6 +329,79 @@ void getrf_tntpiv_local(
     }
 }
 
+//------------------------------------------------------------------------------
+/// Finds this rank's place in the tournament tree over the panel's ranks.
+/// Ranks are identified by index, ordered by their first row in the panel,
+/// so the root, index 0, owns the diagonal tile.
+/// Within each group, the group's first rank merges the candidates of the
+/// others one after another (flat tree); the first ranks of groups are then
+/// merged by a binary tree. Hence one group is a flat tree, and singleton
+/// groups are a binary tree.
+///
+/// @param[in] groups
+///     groups[ idx ] is the group of rank idx, e.g., its node.
+///     Members of a group need not be contiguous.
+///
+/// @param[in] index
+///     Index of this rank.
+///
+/// @param[out] parent
+///     Index of the rank to send candidates to, or -1 for the root.
+///
+/// @param[out] children
+///     Indices of the ranks to receive and merge candidates from, in order.
+///
+inline void tournament_tree(
+    std::vector<int> const& groups, int index,
+    int& parent, std::vector<int>& children)
+{
+    int nranks = groups.size();
+    parent = -1;
+    children.clear();
+
+    // Leader (first member) of each group, in order of first appearance.
+    std::vector<int> leaders;
+    std::vector<int> leader_of( nranks );
+    for (int idx = 0; idx < nranks; ++idx) {
+        int lead = idx;
+        for (int l : leaders) {
+            if (groups[ l ] == groups[ idx ]) {
+                lead = l;
+                break;
+            }
+        }
+        if (lead == idx)
+            leaders.push_back( idx );
+        leader_of[ idx ] = lead;
+    }
+
+    if (leader_of[ index ] != index) {
+        parent = leader_of[ index ];
+        return;
+    }
+
+    // Flat tree within group.
+    for (int idx = index + 1; idx < nranks; ++idx) {
+        if (leader_of[ idx ] == index)
+            children.push_back( idx );
+    }
+
+    // Binary tree across group leaders.
+    int nleaders = leaders.size();
+    int pos = std::find( leaders.begin(), leaders.end(), index )
+            - leaders.begin();
+    for (int step = 1; step < nleaders; step *= 2) {
+        if (pos % (2*step) == 0) {
+            if (pos + step < nleaders)
+                children.push_back( leaders[ pos + step ] );
+        }
+        else {
+            parent = leaders[ pos - step ];
+            break;
+        }
+    }
+}
+
 //------------------------------------------------------------------------------
 /// LU factorization of a column of tiles.
 /// @ingroup gesv_internal
@@ -354,6 +414,7 @@ void getrf_tntpiv_panel(
     std::vector< char* > dwork_array, size_t work_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority)
 {
     assert( A.nt() == 1 );
@@ -468,8 +529,6 @@ void getrf_tntpiv_panel(
 
     // If participating in the panel factorization.
     if (index < nranks) {
-        int nlevels = int( ceil( log2( nranks ) ) );
-
         std::vector< std::vector< AuxPivot< scalar_t > > > aux_pivot( 2 );
         aux_pivot[ 0 ].resize( mb );
         aux_pivot[ 1 ].resize( mb );
@@ -530,94 +589,115 @@ void getrf_tntpiv_panel(
                 aux_pivot[ 0 ][ ii ].set_elementOffset( permute[ 0 ][ ii ].second );
             }
 
-            int64_t step = 1;
-            for (int level = 0; level < nlevels; ++level) {
-                if (index % (2*step) == 0) {
-                    if (index + step < nranks) {
-                        // This is the top, rank1, of the pair;
-                        // recv tile from bottom, rank2, and do LU factorization.
-                        int rank2  = rank_rows[ index+step ].first;
-                        int64_t i2 = rank_rows[ index+step ].second;
-                        int64_t i1 = rank_rows[ index ].second;
-
-                        Awork.tileRecv( i2, 0, rank2, layout );
-                        Awork.tileGetForWriting( i1, 0, LayoutConvert( layout ));
-
-                        MPI_Status status;
-                        MPI_Recv( aux_pivot[ 1 ].data(),
-                                  sizeof(AuxPivot<scalar_t>) * aux_pivot[ 1 ].size(),
-                                  MPI_BYTE, rank2, 0, A.mpiComm(),  &status );
-
-                        // Alocate workspace to copy tiles in the tree reduction.
-                        std::vector<scalar_t> data1( Awork.tileMb( i1 ) * nb );
-                        std::vector<scalar_t> data2( Awork.tileMb( i2 ) * nb );
-
-                        Tile<scalar_t> tile1( Awork.tileMb( i1 ), nb,
-                                              &data1[ 0 ], Awork.tileMb( i1 ),
-                                              slate::HostNum, TileKind::Workspace );
-                        Tile<scalar_t> tile2( Awork.tileMb( i2 ), nb,
-                                              &data2[ 0 ], Awork.tileMb( i2 ),
-                                              slate::HostNum, TileKind::Workspace );
-
-                        Awork( i1, 0 ).copyData( &tile1 );
-                        Awork( i2, 0 ).copyData( &tile2 );
-
-                        piv_len = std::min( tile1.mb(), nb );
-
-                        std::vector< Tile< scalar_t > > tmp_tiles;
-                        tmp_tiles.push_back( tile1 );
-                        tmp_tiles.push_back( tile2 );
-
-                        // Factor the panel locally in parallel.
-                        getrf_tntpiv_local(
-                            internal::TargetType<Target::HostTask>(),
-                            tmp_tiles, dwork_array, work_bytes, mlocal, device,
-                            queue, piv_len, ib, 1, mb, nb, tile_indices,
-                            aux_pivot, A.mpiRank(), max_panel_threads, priority );
-
-                        std::vector< Tile< scalar_t > > work_tiles;
-                        work_tiles.push_back( Awork( i1, 0 ) );
-                        work_tiles.push_back( Awork( i2, 0 ) );
-
-                        // Swap rows in tiles in Awork.
-                        // Swap (tile, row) (0, ii) and (ip, iip).
-
-                        for (int64_t ii = 0; ii < piv_len; ++ii) {
-                            int64_t ip  = aux_pivot[ 0 ][ ii ].localTileIndex();
-                            int64_t iip = aux_pivot[ 0 ][ ii ].localOffset();
-                            if (ip > 0 || iip > ii) {
-                                swapLocalRow(
-                                    0, nb,
-                                    work_tiles[ 0  ], ii,
-                                    work_tiles[ ip ], iip );
-                            }
-                        }
-                        if (level == nlevels-1) {
-                            // Copy the last factorization back to panel tile
-                            tile1.copyData( &work_tiles[ 0 ] );
-                            permutation_to_sequential_pivot(
-                                aux_pivot[ 0 ], diag_len, A.mt(), mb );
-                        }
-
-                        Awork.tileTick( i2, 0 );
+            // Group ranks for the tournament tree: ranks in the same
+            // group are merged by a flat tree, groups by a binary tree.
+            std::vector<int> groups( nranks );
+            for (int idx = 0; idx < nranks; ++idx) {
+                if (tree == PivotTree::Flat)
+                    groups[ idx ] = 0;
+                else if (tree == PivotTree::Hybrid && ! node_ids.empty())
+                    groups[ idx ] = node_ids[ rank_rows[ idx ].first ];
+                else
+                    groups[ idx ] = idx;
+            }
+            int parent;
+            std::vector<int> children;
+            tournament_tree( groups, index, parent, children );
+
+            // Top rows of Awork( i1, 0 ) hold the original (unfactored)
+            // candidate rows of this rank, in the order selected so far.
+            int64_t i1 = rank_rows[ index ].second;
+            Awork.tileGetForWriting( i1, 0, LayoutConvert( layout ) );
+            auto Awork_i1 = Awork( i1, 0 );
+
+            for (size_t c = 0; c < children.size(); ++c) {
+                // Recv only the child's candidate rows, not its whole tile,
+                // and merge them with ours by LU factorization.
+                int rank2  = rank_rows[ children[ c ] ].first;
+                int64_t i2 = rank_rows[ children[ c ] ].second;
+                int64_t piv_len2 = std::min( Awork.tileMb( i2 ), nb );
+
+                std::vector<scalar_t> rows2( piv_len2 * nb );
+                MPI_Status status;
+                MPI_Recv( rows2.data(), piv_len2 * nb,
+                          mpi_type<scalar_t>::value,
+                          rank2, 0, A.mpiComm(), &status );
+                MPI_Recv( aux_pivot[ 1 ].data(),
+                          sizeof(AuxPivot<scalar_t>) * piv_len2,
+                          MPI_BYTE, rank2, 0, A.mpiComm(), &status );
+
+                // Factor copies, keeping the original rows to permute.
+                std::vector<scalar_t> data1( piv_len  * nb );
+                std::vector<scalar_t> data2( piv_len2 * nb );
+                lapack::lacpy( lapack::MatrixType::General, piv_len, nb,
+                               Awork_i1.data(), Awork_i1.stride(),
+                               data1.data(), piv_len );
+                lapack::lacpy( lapack::MatrixType::General, piv_len2, nb,
+                               rows2.data(), piv_len2,
+                               data2.data(), piv_len2 );
+
+                Tile<scalar_t> tile1( piv_len, nb,
+                                      data1.data(), piv_len,
+                                      slate::HostNum, TileKind::Workspace );
+                Tile<scalar_t> tile2( piv_len2, nb,
+                                      data2.data(), piv_len2,
+                                      slate::HostNum, TileKind::Workspace );
+
+                std::vector< Tile< scalar_t > > tmp_tiles;
+                tmp_tiles.push_back( tile1 );
+                tmp_tiles.push_back( tile2 );
+
+                // Factor the candidates locally in parallel.
+                getrf_tntpiv_local(
+                    internal::TargetType<Target::HostTask>(),
+                    tmp_tiles, dwork_array, work_bytes, mlocal, device,
+                    queue, piv_len, ib, 1, mb, nb, tile_indices,
+                    aux_pivot, A.mpiRank(), max_panel_threads, priority );
+
+                std::vector< Tile< scalar_t > > work_tiles;
+                work_tiles.push_back( Awork_i1 );
+                work_tiles.push_back( Tile<scalar_t>(
+                    piv_len2, nb, rows2.data(), piv_len2,
+                    slate::HostNum, TileKind::Workspace ) );
+
+                // Swap original rows, moving the winners to the top.
+                // Swap (tile, row) (0, ii) and (ip, iip).
+                for (int64_t ii = 0; ii < piv_len; ++ii) {
+                    int64_t ip  = aux_pivot[ 0 ][ ii ].localTileIndex();
+                    int64_t iip = aux_pivot[ 0 ][ ii ].localOffset();
+                    if (ip > 0 || iip > ii) {
+                        swapLocalRow(
+                            0, nb,
+                            work_tiles[ 0  ], ii,
+                            work_tiles[ ip ], iip );
                     }
                 }
-                else {
-                    // This is bottom, rank2, of the pair;
-                    // send tile i2 and pivot data to top, rank1.
-                    int rank1  = rank_rows[ index - step ].first;
-                    int64_t i2 = rank_rows[ index ].second;
-                    Awork.tileSend( i2, 0, rank1 );
-
-                    MPI_Send( aux_pivot[ 0 ].data(),
-                              sizeof(AuxPivot<scalar_t>) * aux_pivot[ 0 ].size(),
-                              MPI_BYTE, rank1, 0, A.mpiComm() );
-
-                    // This rank is done!
-                    break;
+
+                if (parent < 0 && c == children.size() - 1) {
+                    // Root's last merge: its factors are the panel's
+                    // diagonal block; copy them back to the panel tile.
+                    lapack::lacpy( lapack::MatrixType::General, piv_len, nb,
+                                   tile1.data(), piv_len,
+                                   Awork_i1.data(), Awork_i1.stride() );
+                    permutation_to_sequential_pivot(
+                        aux_pivot[ 0 ], diag_len, A.mt(), mb );
                 }
-                step *= 2;
-            } // for loop over levels
+            }
+
+            if (parent >= 0) {
+                // Send this rank's candidate rows and pivot data to parent.
+                int rank1 = rank_rows[ parent ].first;
+                std::vector<scalar_t> rows1( piv_len * nb );
+                lapack::lacpy( lapack::MatrixType::General, piv_len, nb,
+                               Awork_i1.data(), Awork_i1.stride(),
+                               rows1.data(), piv_len );
+                MPI_Send( rows1.data(), piv_len * nb,
+                          mpi_type<scalar_t>::value,
+                          rank1, 0, A.mpiComm() );
+                MPI_Send( aux_pivot[ 0 ].data(),
+                          sizeof(AuxPivot<scalar_t>) * piv_len,
+                          MPI_BYTE, rank1, 0, A.mpiComm() );
+            }
         }
         else {
             if (target == Target::Devices) {
@@ -659,12 +739,13 @@ void getrf_tntpiv_panel(
     std::vector< char* > dwork_array, size_t work_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority)
 {
     getrf_tntpiv_panel(
         internal::TargetType<target>(),
         A, Awork, dwork_array, work_bytes,
-        diag_len, ib, pivot, max_panel_threads, priority );
+        diag_len, ib, pivot, tree, node_ids, max_panel_threads, priority );
 }
 
 //------------------------------------------------------------------------------
@@ -677,6 +758,7 @@ void getrf_tntpiv_panel<Target::HostTask, float>(
     std::vector< char* > dwork_array, size_t work_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority);
 
 // ----------------------------------------
@@ -687,6 +769,7 @@ void getrf_tntpiv_panel<Target::HostTask, double>(
     std::vector< char* > dwork_array, size_t work_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority);
 
 // ----------------------------------------
@@ -697,6 +780,7 @@ void getrf_tntpiv_panel< Target::HostTask, std::complex<float> >(
     std::vector< char* > dwork_array, size_t work_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority);
 
 // ----------------------------------------
@@ -707,6 +791,7 @@ void getrf_tntpiv_panel< Target::HostTask, std::complex<double> >(
     std::vector< char* > dwork_array, size_t work_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority);
 
 // ----------------------------------------
@@ -717,6 +802,7 @@ void getrf_tntpiv_panel<Target::HostNest, float>(
     std::vector< char* > dwork_array, size_t work_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority);
 
 // ----------------------------------------
@@ -727,6 +813,7 @@ void getrf_tntpiv_panel<Target::HostNest, double>(
     std::vector< char* > dwork_array, size_t work_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority);
 
 // ----------------------------------------
@@ -737,6 +824,7 @@ void getrf_tntpiv_panel<Target::HostNest, std::complex<float> >(
     std::vector< char* > dwork_array, size_t work_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority);
 
 // ----------------------------------------
@@ -747,6 +835,7 @@ void getrf_tntpiv_panel<Target::HostNest, std::complex<double> >(
     std::vector< char* > dwork_array, size_t work_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority);
 
 // ----------------------------------------
@@ -757,6 +846,7 @@ void getrf_tntpiv_panel<Target::HostBatch, float>(
     std::vector< char* > dwork_array, size_t work_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority);
 
 // ----------------------------------------
@@ -767,6 +857,7 @@ void getrf_tntpiv_panel<Target::HostBatch, double>(
     std::vector< char* > dwork_array, size_t work_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority);
 
 // ----------------------------------------
@@ -777,6 +868,7 @@ void getrf_tntpiv_panel<Target::HostBatch, std::complex<float> >(
     std::vector< char* > dwork_array, size_t work_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority);
 
 // ----------------------------------------
@@ -787,6 +879,7 @@ void getrf_tntpiv_panel<Target::HostBatch, std::complex<double> >(
     std::vector< char* > dwork_array, size_t work_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority);
 
 // ----------------------------------------
@@ -797,6 +890,7 @@ void getrf_tntpiv_panel<Target::Devices, float>(
     std::vector< char* > dwork_array, size_t work_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority);
 
 // ----------------------------------------
@@ -807,6 +901,7 @@ void getrf_tntpiv_panel<Target::Devices, double>(
     std::vector< char* > dwork_array, size_t work_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority);
 
 // ----------------------------------------
@@ -817,6 +912,7 @@ void getrf_tntpiv_panel<Target::Devices, std::complex<float> >(
     std::vector< char* > dwork_array, size_t work_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority);
 
 // ----------------------------------------
@@ -827,6 +923,7 @@ void getrf_tntpiv_panel<Target::Devices, std::complex<double> >(
     std::vector< char* > dwork_array, size_t work_bytes,
     int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
+    PivotTree tree, std::vector<int> const& node_ids,
     int max_panel_threads, int priority);
 
 } // namespace internal
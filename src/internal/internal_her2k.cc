@@ -9,6 +9,7 @@
 #include "slate/Tile_blas.hh"
 #include "internal/internal.hh"
 #include "internal/internal_batch.hh"
+#include "internal/Tile_gemm_split.hh"
 
 namespace slate {
 namespace internal {
@@ -46,6 +47,8 @@ void her2k(scalar_t alpha,                  Matrix<scalar_t>&& A,
 /// Hermitian rank-2k update of single block column (i.e., k = nb).
 /// Host OpenMP task implementation.
 /// Assumes A is NoTrans or ConjTrans; C is Lower, NoTrans or Upper, ConjTrans.
+/// With Option::ComplexGemm = Real4M or Real3M, off-diagonal tiles are
+/// multiplied with real gemm; see tile::gemm_split.
 /// @ingroup her2k_internal
 ///
 template <typename scalar_t>
@@ -73,6 +76,12 @@ void her2k(internal::TargetType<Target::HostTask>,
     bool call_tile_tick = tile_release_strategy == TileReleaseStrategy::Internal
                           || tile_release_strategy == TileReleaseStrategy::All;
 
+    // A dry run counts flops in tile::gemm.
+    ComplexGemm complex_gemm = get_option(
+        opts, Option::ComplexGemm, ComplexGemm::Native );
+    if (DryRun::enabled())
+        complex_gemm = ComplexGemm::Native;
+
     #pragma omp taskgroup
     for (int64_t j = 0; j < C.nt(); ++j) {
         for (int64_t i = j; i < C.mt(); ++i) { // lower
@@ -105,7 +114,7 @@ void her2k(internal::TargetType<Target::HostTask>,
                     #pragma omp task slate_omp_default_none \
                         shared( A, B, C, err ) \
                         firstprivate(i, j, layout, alpha, beta_, call_tile_tick) \
-                        priority(priority)
+                        firstprivate(complex_gemm) priority(priority)
                     {
                         try {
                             const scalar_t one = 1.0;
@@ -117,12 +126,15 @@ void her2k(internal::TargetType<Target::HostTask>,
                             C.tileGetForWriting(i, j, LayoutConvert(layout));
                             auto Aj0 = A(j, 0);
                             auto Bj0 = B(j, 0);
-                            tile::gemm(
+                            auto Cij = C(i, j);
+                            tile::gemm_split(
+                                complex_gemm,
                                 alpha, A(i, 0), conj_transpose( Bj0 ),
-                                beta_, C(i, j) );
-                            tile::gemm(
+                                beta_, Cij );
+                            tile::gemm_split(
+                                complex_gemm,
                                 conj(alpha), B(i, 0), conj_transpose( Aj0 ),
-                                one,         C(i, j) );
+                                one,         Cij );
                             if (call_tile_tick) {
                                 // todo: should tileRelease()?
                                 A.tileTick(i, 0);
@@ -253,7 +265,6 @@ void her2k(internal::TargetType<Target::HostBatch>,
            blas::real_type<scalar_t> beta, HermitianMatrix<scalar_t>& C,
            int priority, int queue_index, Layout layout, Options const& opts)
 {
-#ifdef BLAS_HAVE_MKL
     using blas::conj;
 
     // CPU assumes column major
@@ -322,11 +333,9 @@ void her2k(internal::TargetType<Target::HostBatch>,
         Op opB = (opA == Op::NoTrans ? Op::ConjTrans : Op::NoTrans);
 
         // all same
-        std::vector<CBLAS_TRANSPOSE> opA_array(batch_count,
-                                               cblas_trans_const(opA));
+        std::vector<Op> opA_array(batch_count, opA);
         // all same
-        std::vector<CBLAS_TRANSPOSE> opB_array(batch_count,
-                                               cblas_trans_const(opB));
+        std::vector<Op> opB_array(batch_count, opB);
         std::vector<int> m_array(batch_count);
         std::vector<int> n_array(batch_count);
         std::vector<int> k_array(batch_count);
@@ -385,19 +394,17 @@ void her2k(internal::TargetType<Target::HostBatch>,
         }
 
         {
-            trace::Block trace_block("cblas_gemm_batch");
             const scalar_t one = 1.0;
 
-            // mkl_set_num_threads_local(...);
-            cblas_gemm_batch(CblasColMajor,
-                             opA_array.data(), opB_array.data(),
-                             m_array.data(), n_array.data(), k_array.data(),
-                             alpha_array.data(),
-                             ai_array.data(), ldai_array.data(),
-                             bj_array.data(), ldbj_array.data(),
-                             beta_array.data(),
-                             c_array.data(), ldc_array.data(),
-                             batch_count, group_size.data());
+            gemm_batch(Layout::ColMajor,
+                       opA_array.data(), opB_array.data(),
+                       m_array.data(), n_array.data(), k_array.data(),
+                       alpha_array.data(),
+                       ai_array.data(), ldai_array.data(),
+                       bj_array.data(), ldbj_array.data(),
+                       beta_array.data(),
+                       c_array.data(), ldc_array.data(),
+                       batch_count, group_size.data());
 
             // ai => bi, bj => aj, conjugate alpha, set beta = 1
             if (is_complex<scalar_t>::value) {
@@ -405,16 +412,15 @@ void her2k(internal::TargetType<Target::HostBatch>,
                           alpha_array.end(), conj(alpha));
             }
             std::fill( beta_array.begin(), beta_array.end(), one );
-            cblas_gemm_batch(CblasColMajor,
-                             opA_array.data(), opB_array.data(),
-                             m_array.data(), n_array.data(), k_array.data(),
-                             alpha_array.data(),
-                             bi_array.data(), ldbi_array.data(),
-                             aj_array.data(), ldaj_array.data(),
-                             beta_array.data(),
-                             c_array.data(), ldc_array.data(),
-                             batch_count, group_size.data());
-            // mkl_set_num_threads_local(1);
+            gemm_batch(Layout::ColMajor,
+                       opA_array.data(), opB_array.data(),
+                       m_array.data(), n_array.data(), k_array.data(),
+                       alpha_array.data(),
+                       bi_array.data(), ldbi_array.data(),
+                       aj_array.data(), ldaj_array.data(),
+                       beta_array.data(),
+                       c_array.data(), ldc_array.data(),
+                       batch_count, group_size.data());
         }
 
         for (int64_t j = 0; j < C.nt(); ++j) {
@@ -434,10 +440,6 @@ void her2k(internal::TargetType<Target::HostBatch>,
 
     if (err)
         throw std::exception();
-#else
-    slate_not_implemented(
-        "slate::Target::HostBatch needs Intel MKL.");
-#endif
 }
 
 //------------------------------------------------------------------------------
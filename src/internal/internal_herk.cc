@@ -9,6 +9,8 @@
 #include "slate/Tile_blas.hh"
 #include "internal/internal.hh"
 #include "internal/internal_batch.hh"
+#include "internal/Tile_gemm_ozaki.hh"
+#include "internal/Tile_gemm_split.hh"
 
 namespace slate {
 namespace internal {
@@ -41,6 +43,10 @@ void herk(blas::real_type<scalar_t> alpha, Matrix<scalar_t>&& A,
 /// Hermitian rank-k update of single block column (i.e., k = nb).
 /// Host OpenMP task implementation.
 /// Assumes A is NoTrans or ConjTrans; C is Lower, NoTrans or Upper, ConjTrans.
+/// With Option::ComplexGemm = Real4M or Real3M, off-diagonal tiles are
+/// multiplied with real gemm; see tile::gemm_split.
+/// With Option::OzakiSlices > 0, for double, off-diagonal tiles are
+/// multiplied with emulated double-precision gemm; see tile::gemm_ozaki.
 /// @ingroup herk_internal
 ///
 template <typename scalar_t>
@@ -65,16 +71,29 @@ void herk(internal::TargetType<Target::HostTask>,
     //       by watching 'layout' and 'C(i, j).layout()'
     assert(layout == Layout::ColMajor);
 
+    // A dry run counts flops in tile::gemm.
+    ComplexGemm complex_gemm = get_option(
+        opts, Option::ComplexGemm, ComplexGemm::Native );
+    int64_t ozaki_slices = get_option<int64_t>( opts, Option::OzakiSlices, 0 );
+    if (DryRun::enabled()) {
+        complex_gemm = ComplexGemm::Native;
+        ozaki_slices = 0;
+    }
+
     // Lower, NoTrans
     int err = 0;
+    // Without a host instance of C(i, j) yet, there is nothing to be near.
+    scalar_t no_tile = 0;
     #pragma omp taskgroup
     for (int64_t j = 0; j < C.nt(); ++j) {
         for (int64_t i = j; i < C.mt(); ++i) {  // lower
             if (C.tileIsLocal(i, j)) {
+                scalar_t* C_ij = C.tileExists(i, j) ? C(i, j).data() : &no_tile;
                 if (i == j) {
                     #pragma omp task slate_omp_default_none \
                         shared( A, C, err ) priority( priority ) \
-                        firstprivate(j, layout, alpha, beta, call_tile_tick)
+                        firstprivate(j, layout, alpha, beta, call_tile_tick) \
+                        slate_omp_affinity( C_ij[ 0 ] )
                     {
                         try {
                             A.tileGetForReading(j, 0, LayoutConvert(layout));
@@ -98,16 +117,28 @@ void herk(internal::TargetType<Target::HostTask>,
                 else {
                     #pragma omp task slate_omp_default_none \
                         shared( A, C, err ) priority( priority ) \
-                        firstprivate(i, j, layout, alpha_, beta_, call_tile_tick)
+                        firstprivate(i, j, layout, alpha_, beta_, call_tile_tick) \
+                        firstprivate(complex_gemm, ozaki_slices) \
+                        slate_omp_affinity( C_ij[ 0 ] )
                     {
                         try {
                             A.tileGetForReading(i, 0, LayoutConvert(layout));
                             A.tileGetForReading(j, 0, LayoutConvert(layout));
                             C.tileGetForWriting(i, j, LayoutConvert(layout));
                             auto Aj0 = A(j, 0);
-                            tile::gemm(
-                                alpha_, A(i, 0), conj_transpose( Aj0 ),
-                                beta_,  C(i, j) );
+                            auto Cij = C(i, j);
+                            if (ozaki_slices > 0) {
+                                tile::gemm_ozaki(
+                                    ozaki_slices,
+                                    alpha_, A(i, 0), conj_transpose( Aj0 ),
+                                    beta_,  Cij );
+                            }
+                            else {
+                                tile::gemm_split(
+                                    complex_gemm,
+                                    alpha_, A(i, 0), conj_transpose( Aj0 ),
+                                    beta_,  Cij );
+                            }
 
                             if (call_tile_tick) {
                                 // todo: should tileRelease()?
@@ -227,7 +258,6 @@ void herk(internal::TargetType<Target::HostBatch>,
           blas::real_type<scalar_t> beta,  HermitianMatrix<scalar_t>& C,
           int priority, int queue_index, Layout layout, Options const& opts)
 {
-#ifdef BLAS_HAVE_MKL
     // CPU assumes column major
     // todo: relax this assumption, by allowing Tile_blas.hh::herk()
     //       to take layout param
@@ -295,11 +325,9 @@ void herk(internal::TargetType<Target::HostBatch>,
         Op opB = (opA == Op::NoTrans ? Op::ConjTrans : Op::NoTrans);
 
         // all same
-        std::vector<CBLAS_TRANSPOSE> opA_array(batch_count,
-                                               cblas_trans_const(opA));
+        std::vector<Op> opA_array(batch_count, opA);
         // all same
-        std::vector<CBLAS_TRANSPOSE> opB_array(batch_count,
-                                               cblas_trans_const(opB));
+        std::vector<Op> opB_array(batch_count, opB);
         std::vector<int> m_array(batch_count);
         std::vector<int> n_array(batch_count);
         std::vector<int> k_array(batch_count);
@@ -347,18 +375,15 @@ void herk(internal::TargetType<Target::HostBatch>,
         }
 
         {
-            trace::Block trace_block("cblas_gemm_batch");
-            // mkl_set_num_threads_local(...);
-            cblas_gemm_batch(CblasColMajor,
-                             opA_array.data(), opB_array.data(),
-                             m_array.data(), n_array.data(), k_array.data(),
-                             alpha_array.data(),
-                             a_array.data(), lda_array.data(),
-                             b_array.data(), ldb_array.data(),
-                             beta_array.data(),
-                             c_array.data(), ldc_array.data(),
-                             batch_count, group_size.data());
-            // mkl_set_num_threads_local(1);
+            gemm_batch(Layout::ColMajor,
+                       opA_array.data(), opB_array.data(),
+                       m_array.data(), n_array.data(), k_array.data(),
+                       alpha_array.data(),
+                       a_array.data(), lda_array.data(),
+                       b_array.data(), ldb_array.data(),
+                       beta_array.data(),
+                       c_array.data(), ldc_array.data(),
+                       batch_count, group_size.data());
         }
 
         for (int64_t j = 0; j < C.nt(); ++j) {
@@ -374,10 +399,6 @@ void herk(internal::TargetType<Target::HostBatch>,
 
     if (err)
         throw std::exception();
-#else
-    slate_not_implemented(
-        "slate::Target::HostBatch needs Intel MKL.");
-#endif
 }
 
 //------------------------------------------------------------------------------
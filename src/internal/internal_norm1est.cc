@@ -10,6 +10,9 @@
 #include "internal/internal.hh"
 #include "internal/internal_util.hh"
 
+#include <algorithm>
+#include <set>
+
 namespace slate {
 namespace internal {
 
@@ -476,6 +479,386 @@ void norm1est(
     }
 }
 
+//------------------------------------------------------------------------------
+/// Returns a pseudo-random sign, +1 or -1, for global row i of column j.
+/// It depends only on (i, j), so all ranks agree without communication.
+inline int norm1est_random_sign(int64_t i, int64_t j)
+{
+    // splitmix64 finalizer
+    uint64_t z = uint64_t( i ) * 0x9e3779b97f4a7c15ull + uint64_t( j );
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    z ^= z >> 31;
+    return (z & 1) ? 1 : -1;
+}
+
+//------------------------------------------------------------------------------
+/// Returns sign(x): +1 or -1 for real x; x / |x|, or 1 if x = 0, for complex x.
+template <typename scalar_t>
+scalar_t norm1est_sign(scalar_t x)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    if constexpr (blas::is_complex<scalar_t>::value) {
+        real_t absx = std::abs( x );
+        if (absx > std::numeric_limits<real_t>::min())
+            return x / absx;
+        else
+            return scalar_t( 1.0 );
+    }
+    else {
+        return x >= 0 ? scalar_t( 1.0 ) : scalar_t( -1.0 );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Entry h_i of the row-wise max used to pick the next unit vectors.
+template <typename real_t>
+struct norm1est_candidate {
+    real_t value;
+    int64_t index;
+};
+
+//------------------------------------------------------------------------------
+/// Distributed parallel block estimate of the 1-norm of a square matrix A,
+/// using the Higham-Tisseur algorithm with t columns.
+/// Generic implementation for any target.
+///
+/// Like norm1est, uses reverse communication for evaluating matrix products,
+/// but X has t columns, so each iteration is one multi-RHS product with A or
+/// A^H instead of t single-vector ones. Each return does at most one
+/// collective: an MPI_Allreduce after A X, which sums the column norms and
+/// (for real) the sign-vector inner products together, or an MPI_Allgather
+/// after A^H S, which exchanges each rank's best candidate unit vectors.
+/// All ranks reach the same decisions, so kase and isave need no broadcast.
+/// The estimate is more reliable than norm1est for t > 1.
+///
+/// Unlike Higham-Tisseur, columns of S parallel to each other are not
+/// resampled; the initial random columns make this rare for t << n.
+///
+/// Reference: N. J. Higham and F. Tisseur, "A block algorithm for matrix
+/// 1-norm estimation, with an application to 1-norm pseudospectra",
+/// SIAM J. Matrix Anal. Appl., 21(4), 2000.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] X
+///     The n-by-t matrix $X$, 1 <= t <= n, with one block column.
+///     On an intermediate return, X should be overwritten by
+///       A * X,   if kase=1
+///       A^H * X,   if kase=2
+///
+/// @param[in,out] V
+///     The n-by-1 matrix $V$, distributed like the rows of X.
+///     On exit, V = A*W, where est = norm(V) / norm(W)
+///     (W is not returned).
+///
+/// @param[in,out] S
+///     The n-by-t workspace $S$, distributed like X,
+///     holding the sign matrix between calls.
+///
+/// @param[in,out] est
+///     On entry, with kase = 1 or 2, est should be unchanged
+///     from the previous call to norm1est_block.
+///     On exit, est is an estimate for norm(A).
+///
+/// @param[in,out] kase
+///     On the initial call to norm1est_block, kase should be 0.
+///     On an intermediate return, kase will be 1 or 2, indicating whether
+///     X should be overwritten by A * X or A^H * X.
+///     On exit, kase will again be 0.
+///
+/// @param[in,out] isave
+///     isave is used to save variables between calls to norm1est_block;
+///     it is resized as needed.
+///     isave[0]:  the step to do in the next iteration
+///     isave[1]:  number of iterations
+///     isave[2]:  index of the unit vector giving the best estimate
+///     isave[3:]: indices of unit vectors used so far;
+///                the last t are the current columns of X.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// The t = 1 case is close to LAPACK lacn2; for t > 1, this is the
+/// algorithm of MATLAB normest1.
+///
+/// @ingroup cond_internal
+///
+template <typename scalar_t>
+void norm1est_block(
+           Matrix<scalar_t>& X,
+           Matrix<scalar_t>& V,
+           Matrix<scalar_t>& S,
+           blas::real_type<scalar_t>* est,
+           int* kase,
+           std::vector<int64_t>& isave,
+           Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+    using candidate_t = norm1est_candidate<real_t>;
+    using blas::real;
+    const auto mpi_real_type = mpi_type<real_t>::value;
+
+    const int itmax = 5;
+
+    int64_t n  = X.m();
+    int64_t t  = X.n();
+    int64_t mt = X.mt();
+    int64_t nb = X.tileMb( 0 );
+    MPI_Comm comm = X.mpiComm();
+
+    assert( X.nt() == 1 );
+    assert( t <= n );
+
+    if (*kase == 0) {
+        // Initialize X(:, 0) = 1/n, X(:, 1:t-1) = random +-1/n.
+        isave.assign( 3, 0 );
+        isave[ 0 ] = 1;
+        isave[ 1 ] = 1;
+        isave[ 2 ] = -1;
+        *est = 0.;
+        real_t rn = real_t( 1.0 ) / real_t( n );
+        for (int64_t i = 0; i < mt; ++i) {
+            if (X.tileIsLocal( i, 0 )) {
+                X.tileGetForWriting( i, 0, LayoutConvert::ColMajor );
+                auto Xi = X( i, 0 );
+                for (int64_t ii = 0; ii < Xi.mb(); ++ii) {
+                    Xi.at( ii, 0 ) = rn;
+                    for (int64_t j = 1; j < t; ++j) {
+                        Xi.at( ii, j ) = rn * real_t(
+                            norm1est_random_sign( i*nb + ii, j ) );
+                    }
+                }
+            }
+        }
+        // X to be overwritten by A*X, so kase = 1.
+        *kase = 1;
+        return;
+    }
+
+    int64_t iter = isave[ 1 ];
+
+    if (isave[ 0 ] == 1) {
+        // X has been overwritten by Y = A X.
+        // Sum, in a single reduction, the column 1-norms of Y and, for real,
+        // the inner products of sign(Y) with the columns of the previous S.
+        // sign(Y(:, j)) is parallel to S(:, l) iff |inner product| = n.
+        bool check_parallel = ! blas::is_complex<scalar_t>::value && iter >= 2;
+        int64_t nsums = check_parallel ? t + t*t : t;
+        std::vector<real_t> sums_local( nsums, 0. ), sums( nsums );
+        for (int64_t i = 0; i < mt; ++i) {
+            if (X.tileIsLocal( i, 0 )) {
+                X.tileGetForWriting( i, 0, LayoutConvert::ColMajor );
+                auto Xi = X( i, 0 );
+                auto Si = S( i, 0 );
+                for (int64_t j = 0; j < t; ++j) {
+                    for (int64_t ii = 0; ii < Xi.mb(); ++ii) {
+                        sums_local[ j ] += std::abs( Xi.at( ii, j ) );
+                        if (check_parallel) {
+                            scalar_t sign = norm1est_sign( Xi.at( ii, j ) );
+                            for (int64_t l = 0; l < t; ++l) {
+                                sums_local[ t + j*t + l ]
+                                    += real( sign * Si.at( ii, l ) );
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        slate_mpi_call(
+            MPI_Allreduce( sums_local.data(), sums.data(), nsums,
+                           mpi_real_type, MPI_SUM, comm ) );
+
+        real_t est_old = *est;
+        int64_t best = 0;
+        for (int64_t j = 1; j < t; ++j) {
+            if (sums[ j ] > sums[ best ])
+                best = j;
+        }
+        *est = sums[ best ];
+
+        if (iter >= 2 && (*est > est_old || iter == 2)) {
+            isave[ 2 ] = isave[ isave.size() - t + best ];
+        }
+        if (*est > est_old) {
+            // V = Y(:, best)
+            for (int64_t i = 0; i < mt; ++i) {
+                if (X.tileIsLocal( i, 0 )) {
+                    auto Xi = X( i, 0 );
+                    auto Vi = V( i, 0 );
+                    for (int64_t ii = 0; ii < Xi.mb(); ++ii)
+                        Vi.at( ii, 0 ) = Xi.at( ii, best );
+                }
+            }
+        }
+        if (iter >= 2 && *est <= est_old) {
+            // No improvement; converged.
+            *est = est_old;
+            *kase = 0;
+            return;
+        }
+        if (iter > itmax) {
+            *kase = 0;
+            return;
+        }
+        if (check_parallel) {
+            // Converged if every column of sign(Y) is parallel to
+            // some column of the previous S.
+            bool all_parallel = true;
+            for (int64_t j = 0; j < t && all_parallel; ++j) {
+                bool parallel = false;
+                for (int64_t l = 0; l < t; ++l) {
+                    if (std::abs( sums[ t + j*t + l ] ) >= real_t( n ) - 0.5)
+                        parallel = true;
+                }
+                all_parallel = parallel;
+            }
+            if (all_parallel) {
+                *kase = 0;
+                return;
+            }
+        }
+
+        // S = sign(Y), X = S.
+        for (int64_t i = 0; i < mt; ++i) {
+            if (X.tileIsLocal( i, 0 )) {
+                auto Xi = X( i, 0 );
+                auto Si = S( i, 0 );
+                for (int64_t j = 0; j < t; ++j) {
+                    for (int64_t ii = 0; ii < Xi.mb(); ++ii) {
+                        Si.at( ii, j ) = norm1est_sign( Xi.at( ii, j ) );
+                        Xi.at( ii, j ) = Si.at( ii, j );
+                    }
+                }
+            }
+        }
+        // X to be overwritten by A^H*X, so kase = 2.
+        *kase = 2;
+        isave[ 0 ] = 2;
+        return;
+    }
+    else if (isave[ 0 ] == 2) {
+        // X has been overwritten by Z = A^H S; let h_i = max_j |Z(i, j)|.
+        // In a single allgather, each rank contributes h(ind_best) if it
+        // owns it, its t largest h_i, and its t largest h_i whose unit
+        // vectors have not been used yet.
+        std::set<int64_t> history( isave.begin() + 3, isave.end() );
+        int64_t ind_best = isave[ 2 ];
+        const candidate_t none = { -1., -1 };
+
+        candidate_t h_best = none;
+        std::vector<candidate_t> h_all, h_new;
+        for (int64_t i = 0; i < mt; ++i) {
+            if (X.tileIsLocal( i, 0 )) {
+                X.tileGetForWriting( i, 0, LayoutConvert::ColMajor );
+                auto Xi = X( i, 0 );
+                for (int64_t ii = 0; ii < Xi.mb(); ++ii) {
+                    candidate_t h = { 0., i*nb + ii };
+                    for (int64_t j = 0; j < t; ++j)
+                        h.value = std::max( h.value, std::abs( Xi.at( ii, j ) ) );
+                    h_all.push_back( h );
+                    if (history.count( h.index ) == 0)
+                        h_new.push_back( h );
+                    if (h.index == ind_best)
+                        h_best = h;
+                }
+            }
+        }
+
+        // Order by decreasing value, breaking ties by smaller index.
+        auto greater = [](candidate_t const& a, candidate_t const& b) {
+            return a.value > b.value
+                   || (a.value == b.value && a.index < b.index);
+        };
+        auto top_t = [&](std::vector<candidate_t>& h) {
+            int64_t k = std::min( t, int64_t( h.size() ) );
+            std::partial_sort( h.begin(), h.begin() + k, h.end(), greater );
+            h.resize( t, none );
+        };
+        top_t( h_all );
+        top_t( h_new );
+
+        std::vector<candidate_t> local;
+        local.reserve( 2*t + 1 );
+        local.push_back( h_best );
+        local.insert( local.end(), h_all.begin(), h_all.end() );
+        local.insert( local.end(), h_new.begin(), h_new.end() );
+
+        int mpi_size;
+        slate_mpi_call(
+            MPI_Comm_size( comm, &mpi_size ) );
+        std::vector<candidate_t> gathered( mpi_size * local.size() );
+        int count = local.size() * sizeof( candidate_t );
+        slate_mpi_call(
+            MPI_Allgather( local.data(), count, MPI_BYTE,
+                           gathered.data(), count, MPI_BYTE, comm ) );
+
+        // Merge the contributions of all ranks.
+        h_best = none;
+        h_all.clear();
+        h_new.clear();
+        for (int rank = 0; rank < mpi_size; ++rank) {
+            auto begin = gathered.begin() + rank * local.size();
+            if (begin->index >= 0)
+                h_best = *begin;
+            for (int64_t k = 0; k < t; ++k) {
+                if (begin[ 1 + k ].index >= 0)
+                    h_all.push_back( begin[ 1 + k ] );
+                if (begin[ 1 + t + k ].index >= 0)
+                    h_new.push_back( begin[ 1 + t + k ] );
+            }
+        }
+        std::sort( h_all.begin(), h_all.end(), greater );
+        std::sort( h_new.begin(), h_new.end(), greater );
+
+        // Converged if the best unit vector also maximizes h.
+        if (iter >= 2 && h_best.index >= 0
+            && h_all[ 0 ].value == h_best.value) {
+            *kase = 0;
+            return;
+        }
+        // Converged if the t largest h_i all have been used already.
+        if (t > 1) {
+            bool all_used = true;
+            for (int64_t k = 0; k < t && k < int64_t( h_all.size() ); ++k) {
+                if (history.count( h_all[ k ].index ) == 0)
+                    all_used = false;
+            }
+            if (all_used) {
+                *kase = 0;
+                return;
+            }
+        }
+        if (h_new.empty()) {
+            *kase = 0;
+            return;
+        }
+
+        // X(:, j) = e_{ind_j} for the t largest unused h_i;
+        // any column left over, when fewer than t remain, is zero.
+        slate::set( scalar_t( 0.0 ), scalar_t( 0.0 ), X );
+        for (int64_t j = 0; j < t; ++j) {
+            int64_t ind = j < int64_t( h_new.size() ) ? h_new[ j ].index : -1;
+            isave.push_back( ind );
+            if (ind >= 0) {
+                int64_t i = ind / nb;
+                if (X.tileIsLocal( i, 0 )) {
+                    X.tileGetForWriting( i, 0, LayoutConvert::ColMajor );
+                    X( i, 0 ).at( ind - i*nb, j ) = scalar_t( 1.0 );
+                }
+            }
+        }
+        isave[ 1 ] = iter + 1;
+        // X to be overwritten by A*X, so kase = 1.
+        *kase = 1;
+        isave[ 0 ] = 1;
+        return;
+    }
+}
+
 //------------------------------------------------------------------------------
 // Explicit instantiations.
 // ----------------------------------------
@@ -519,5 +902,46 @@ void norm1est< std::complex<double> >(
     std::vector<int64_t>& isave,
     Options const& opts);
 
+// ----------------------------------------
+template
+void norm1est_block<float>(
+    Matrix<float>& X,
+    Matrix<float>& V,
+    Matrix<float>& S,
+    float* est,
+    int* kase,
+    std::vector<int64_t>& isave,
+    Options const& opts);
+
+template
+void norm1est_block<double>(
+    Matrix<double>& X,
+    Matrix<double>& V,
+    Matrix<double>& S,
+    double* est,
+    int* kase,
+    std::vector<int64_t>& isave,
+    Options const& opts);
+
+template
+void norm1est_block< std::complex<float> >(
+    Matrix< std::complex<float> >& X,
+    Matrix< std::complex<float> >& V,
+    Matrix< std::complex<float> >& S,
+    float* est,
+    int* kase,
+    std::vector<int64_t>& isave,
+    Options const& opts);
+
+template
+void norm1est_block< std::complex<double> >(
+    Matrix< std::complex<double> >& X,
+    Matrix< std::complex<double> >& V,
+    Matrix< std::complex<double> >& S,
+    double* est,
+    int* kase,
+    std::vector<int64_t>& isave,
+    Options const& opts);
+
 } // namespace internal
 } // namespace slate
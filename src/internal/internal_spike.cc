@@ -0,0 +1,593 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/Matrix.hh"
+#include "slate/BandMatrix.hh"
+#include "slate/HermitianBandMatrix.hh"
+#include "internal/internal.hh"
+
+#include <algorithm>
+#include <limits>
+#include <set>
+#include <string>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Splits block rows 0 : mt-1 of A into contiguous groups, one per MPI rank,
+/// each with at least min_rows rows.
+/// Returns the first block row of each group, followed by mt.
+/// Ranks beyond the number of groups get no rows.
+///
+template <typename matrix_type>
+std::vector<int64_t> spike_groups(
+    matrix_type& A, int mpi_size, int64_t min_rows)
+{
+    int64_t mt = A.mt();
+    int64_t target = std::max( ceildiv( A.m(), int64_t( mpi_size ) ), min_rows );
+
+    std::vector<int64_t> first = { 0 };
+    int64_t rows = 0;
+    for (int64_t i = 0; i < mt; ++i) {
+        rows += A.tileMb( i );
+        if (rows >= target && i < mt-1) {
+            first.push_back( i+1 );
+            rows = 0;
+        }
+    }
+    // Merge a short trailing group into the previous one.
+    if (rows < min_rows && first.size() > 1)
+        first.pop_back();
+    first.push_back( mt );
+    return first;
+}
+
+//------------------------------------------------------------------------------
+/// Partitioned (SPIKE) band solver, shared by the general and Hermitian cases.
+///
+/// The rows are split into P contiguous partitions: block rows are grouped
+/// into one contiguous range per MPI rank (a 1D distribution), and each rank
+/// splits its range into up to omp_get_max_threads() partitions of at least
+/// kl + ku rows. Writing A as block tridiagonal with diagonal band blocks A_p,
+/// the system is solved in three steps:
+///
+/// 1. Each partition factors A_p (LAPACK gbtrf, or pbtrf if Hermitian) and
+///    solves for the spikes and modified rhs,
+///        [ G_p, W_p, V_p ] = A_p^{-1} [ B_p, [C_p; 0], [0; D_p] ],
+///    where C_p and D_p couple A_p to its previous and next partitions.
+///
+/// 2. The top ku and bottom kl rows of each partition give a reduced band
+///    system of order P (kl + ku) for the interface unknowns,
+///        x_p^{t,b} + V_p^{t,b} x_{p+1}^t + W_p^{t,b} x_{p-1}^b = G_p^{t,b}.
+///    Its pieces are allgathered and every rank solves it redundantly
+///    with LAPACK gbsv, avoiding a broadcast of the solution.
+///
+/// 3. Each partition recovers x_p = G_p - V_p x_{p+1}^t - W_p x_{p-1}^b.
+///
+/// Pivoting is done only within partitions, so this requires the
+/// diagonal blocks A_p be nonsingular; it is always the case when
+/// A is Hermitian positive definite or diagonally dominant.
+/// A is not modified.
+///
+/// @return 0 on success, or, on all ranks, i > 0 if a partition's diagonal
+/// block fails to factor at global row i, or the reduced system is singular
+/// at interface row i. Then B is not modified, so the caller can fall back
+/// to a factorization that pivots across partitions.
+///
+/// @param[in] kl
+///     Lower bandwidth. For Hermitian, the bandwidth kd.
+///
+/// @param[in] ku
+///     Upper bandwidth. For Hermitian, the bandwidth kd.
+///
+/// @param[in] hermitian
+///     Whether A is a HermitianBandMatrix, storing only one triangle.
+///
+template <typename scalar_t, typename matrix_type>
+int64_t spike_solve(
+    matrix_type& A, int64_t kl, int64_t ku, bool hermitian,
+    Matrix<scalar_t>& B,
+    Options const& opts)
+{
+    using blas::conj;
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const Layout layout = Layout::ColMajor;
+    const int tag_0 = 0;
+
+    int64_t n    = A.n();
+    int64_t mt   = A.mt();
+    int64_t nt   = A.nt();
+    int64_t nrhs = B.n();
+    int64_t Bnt  = B.nt();
+    int64_t nb   = A.tileNb( 0 );
+    int64_t klt  = ceildiv( kl, nb );
+    int64_t kut  = ceildiv( ku, nb );
+    bool lower = hermitian && A.uplo() == Uplo::Lower;
+    bool upper = hermitian && A.uplo() == Uplo::Upper;
+
+    int mpi_rank = A.mpiRank();
+    MPI_Comm mpi_comm = A.mpiComm();
+    int mpi_size;
+    slate_mpi_call(
+        MPI_Comm_size( mpi_comm, &mpi_size ) );
+
+    // Interface unknowns per partition.
+    int64_t kb = kl + ku;
+    int64_t ncols = nrhs + kb;
+
+    std::vector<int64_t> first
+        = spike_groups( A, mpi_size, std::max( kb, int64_t( 1 ) ) );
+    int64_t ngroups = first.size() - 1;
+    auto group_of = [ &first ]( int64_t i ) {
+        return int( std::upper_bound( first.begin(), first.end(), i )
+                    - first.begin() - 1 );
+    };
+
+    // Global row offset of each block row.
+    std::vector<int64_t> row0( mt + 1, 0 );
+    for (int64_t i = 0; i < mt; ++i)
+        row0[ i+1 ] = row0[ i ] + A.tileMb( i );
+
+    // Ranks needing tile (i, j) of A: the owner of block row i and,
+    // for Hermitian, also of block row j to get the other triangle.
+    auto A_dst_set = [ & ]( int64_t i, int64_t j ) {
+        std::set<int> dst_set = { group_of( i ) };
+        if (hermitian)
+            dst_set.insert( group_of( j ) );
+        return dst_set;
+    };
+
+    //----------
+    // Redistribute band tiles of A and tiles of B to the 1D layout.
+    // All ranks visit tiles in the same order, so blocking send / recv
+    // pairs cannot deadlock.
+    for (int64_t i = 0; i < mt; ++i) {
+        int64_t j_begin = std::max( i - (upper ? 0 : klt), int64_t( 0 ) );
+        int64_t j_end   = std::min( i + (lower ? 0 : kut), nt-1 );
+        for (int64_t j = j_begin; j <= j_end; ++j) {
+            int src = A.tileRank( i, j );
+            for (int dst : A_dst_set( i, j )) {
+                if (dst == src)
+                    continue;
+                if (src == mpi_rank) {
+                    A.tileGetForReading( i, j, LayoutConvert( layout ) );
+                    A.tileSend( i, j, dst, tag_0 );
+                }
+                else if (dst == mpi_rank) {
+                    A.tileRecv( i, j, src, layout, tag_0 );
+                }
+            }
+        }
+        for (int64_t j = 0; j < Bnt; ++j) {
+            int src = B.tileRank( i, j );
+            int dst = group_of( i );
+            if (dst == src)
+                continue;
+            if (src == mpi_rank) {
+                B.tileGetForReading( i, j, LayoutConvert( layout ) );
+                B.tileSend( i, j, dst, tag_0 );
+            }
+            else if (dst == mpi_rank) {
+                B.tileRecv( i, j, src, layout, tag_0 );
+            }
+        }
+    }
+
+    //----------
+    // Copy local rows R0 : R1-1 of A into row-wise band storage,
+    // A(r, c) = Arows[ (r - R0)*(kb + 1) + c - r + kl ],
+    // and the same rows of B into column-major Brows.
+    bool has_rows = mpi_rank < ngroups;
+    int64_t i_begin = has_rows ? first[ mpi_rank ]     : 0;
+    int64_t i_end   = has_rows ? first[ mpi_rank + 1 ] : 0;
+    int64_t R0 = row0[ i_begin ];
+    int64_t R1 = row0[ i_end ];
+    int64_t M  = R1 - R0;
+
+    std::vector<scalar_t> Arows( M*(kb + 1), zero );
+    std::vector<scalar_t> Brows( M*nrhs );
+    if (has_rows) {
+        for (int64_t i = 0; i < mt; ++i) {
+            int64_t j_begin = std::max( i - (upper ? 0 : klt), int64_t( 0 ) );
+            int64_t j_end   = std::min( i + (lower ? 0 : kut), nt-1 );
+            for (int64_t j = j_begin; j <= j_end; ++j) {
+                if (A_dst_set( i, j ).count( mpi_rank ) == 0)
+                    continue;
+
+                A.tileGetForReading( i, j, LayoutConvert( layout ) );
+                auto T = A( i, j );
+                for (int64_t jj = 0; jj < T.nb(); ++jj) {
+                    for (int64_t ii = 0; ii < T.mb(); ++ii) {
+                        int64_t r = row0[ i ] + ii;
+                        int64_t c = row0[ j ] + jj;
+                        if (c - r < -kl || c - r > ku)
+                            continue;
+                        if ((lower && r < c) || (upper && r > c))
+                            continue;
+
+                        scalar_t a = T( ii, jj );
+                        if (hermitian && r != c && R0 <= c && c < R1)
+                            Arows[ (c - R0)*(kb + 1) + r - c + kl ] = conj( a );
+                        if (R0 <= r && r < R1)
+                            Arows[ (r - R0)*(kb + 1) + c - r + kl ] = a;
+                    }
+                }
+            }
+        }
+
+        for (int64_t i = i_begin; i < i_end; ++i) {
+            for (int64_t j = 0; j < Bnt; ++j) {
+                B.tileGetForReading( i, j, LayoutConvert( layout ) );
+                auto T = B( i, j );
+                int64_t jj0 = j * B.tileNb( 0 );
+                for (int64_t jj = 0; jj < T.nb(); ++jj) {
+                    for (int64_t ii = 0; ii < T.mb(); ++ii) {
+                        Brows[ (row0[ i ] - R0 + ii) + (jj0 + jj)*M ] = T( ii, jj );
+                    }
+                }
+            }
+        }
+    }
+
+    //----------
+    // Local partitions, each with at least kb rows.
+    int64_t nparts = 0;
+    if (has_rows) {
+        nparts = std::min( int64_t( omp_get_max_threads() ),
+                           kb > 0 ? M / kb : M );
+        nparts = std::max( nparts, int64_t( 1 ) );
+    }
+    std::vector<int64_t> part_first( nparts + 1, R0 );
+    for (int64_t p = 1; p <= nparts; ++p)
+        part_first[ p ] = R0 + M*p / nparts;
+
+    // Global index of the first local partition, and total partitions.
+    std::vector<int> nparts_all( mpi_size );
+    int nparts_int = int( nparts );
+    slate_mpi_call(
+        MPI_Allgather( &nparts_int, 1, MPI_INT,
+                       nparts_all.data(), 1, MPI_INT, mpi_comm ) );
+    int64_t part_offset = 0;
+    for (int r = 0; r < mpi_rank; ++r)
+        part_offset += nparts_all[ r ];
+    int64_t P = 0;
+    for (int r = 0; r < mpi_size; ++r)
+        P += nparts_all[ r ];
+
+    // Entry A(r, c) for r in local rows; zero outside the band and matrix.
+    auto A_get = [ & ]( int64_t r, int64_t c ) {
+        if (c - r < -kl || c - r > ku || c < 0 || c >= n)
+            return zero;
+        return Arows[ (r - R0)*(kb + 1) + c - r + kl ];
+    };
+
+    //----------
+    // Step 1: factor each partition and solve for [ G_p, W_p, V_p ],
+    // stored in GWV[ p ] as m-by-(nrhs + kl + ku), column major.
+    std::vector< std::vector<scalar_t> > GWV( nparts );
+
+    // First failing global row (1-based) of each partition, or 0.
+    std::vector<int64_t> part_info( nparts, 0 );
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        for (int64_t p = 0; p < nparts; ++p) {
+            #pragma omp task slate_omp_default_none \
+                shared( GWV, Brows, part_first, part_info, A_get ) \
+                firstprivate( p, kl, ku, kb, ncols, nrhs, M, R0, \
+                              hermitian, zero )
+            {
+                int64_t r0 = part_first[ p ];
+                int64_t r1 = part_first[ p+1 ];
+                int64_t m  = r1 - r0;
+
+                std::vector<scalar_t>& G = GWV[ p ];
+                G.assign( m*ncols, zero );
+                for (int64_t k = 0; k < nrhs; ++k) {
+                    for (int64_t i = 0; i < m; ++i)
+                        G[ i + k*m ] = Brows[ (r0 - R0 + i) + k*M ];
+                }
+                // C_p = A(r0 : r0+kl-1, r0-kl : r0-1)
+                for (int64_t k = 0; k < kl; ++k) {
+                    for (int64_t i = 0; i < std::min( kl, m ); ++i)
+                        G[ i + (nrhs + k)*m ] = A_get( r0 + i, r0 - kl + k );
+                }
+                // D_p = A(r1-ku : r1-1, r1 : r1+ku-1)
+                for (int64_t k = 0; k < ku; ++k) {
+                    for (int64_t i = std::max( m - ku, int64_t( 0 ) ); i < m; ++i)
+                        G[ i + (nrhs + kl + k)*m ] = A_get( r0 + i, r1 + k );
+                }
+
+                int64_t info;
+                if (hermitian) {
+                    int64_t ldab = kl + 1;
+                    std::vector<scalar_t> AB( ldab*m, zero );
+                    for (int64_t j = 0; j < m; ++j) {
+                        for (int64_t i = j; i < std::min( m, j + kl + 1 ); ++i)
+                            AB[ i - j + j*ldab ] = A_get( r0 + i, r0 + j );
+                    }
+                    info = lapack::pbtrf( Uplo::Lower, m, kl, AB.data(), ldab );
+                    if (info == 0) {
+                        lapack::pbtrs( Uplo::Lower, m, kl, ncols,
+                                       AB.data(), ldab, G.data(), m );
+                    }
+                }
+                else {
+                    int64_t ldab = 2*kl + ku + 1;
+                    std::vector<scalar_t> AB( ldab*m, zero );
+                    std::vector<int64_t> ipiv( m );
+                    for (int64_t j = 0; j < m; ++j) {
+                        int64_t i_begin = std::max( j - ku, int64_t( 0 ) );
+                        int64_t i_end   = std::min( j + kl + 1, m );
+                        for (int64_t i = i_begin; i < i_end; ++i)
+                            AB[ kl + ku + i - j + j*ldab ] = A_get( r0 + i, r0 + j );
+                    }
+                    info = lapack::gbtrf( m, m, kl, ku, AB.data(), ldab,
+                                          ipiv.data() );
+                    if (info == 0) {
+                        lapack::gbtrs( Op::NoTrans, m, kl, ku, ncols,
+                                       AB.data(), ldab, ipiv.data(),
+                                       G.data(), m );
+                    }
+                }
+                if (info > 0)
+                    part_info[ p ] = r0 + info;
+            }
+        }
+    }
+
+    // Reduce to the first failing row over all ranks, so all ranks return it.
+    const int64_t no_info = std::numeric_limits<int64_t>::max();
+    int64_t info = no_info;
+    for (int64_t p = 0; p < nparts; ++p) {
+        if (part_info[ p ] > 0)
+            info = std::min( info, part_info[ p ] );
+    }
+    int64_t info_min;
+    slate_mpi_call(
+        MPI_Allreduce( &info, &info_min, 1, MPI_INT64_T, MPI_MIN, mpi_comm ) );
+    if (info_min != no_info) {
+        A.releaseWorkspace();
+        B.releaseWorkspace();
+        return info_min;
+    }
+
+    //----------
+    // Step 2: solve the reduced system for the interface unknowns,
+    // y_p = [ x_p(0 : ku-1); x_p(m-kl : m-1) ], into Y (P kb-by-nrhs).
+    int64_t N = P*kb;
+    std::vector<scalar_t> Y( N*nrhs );
+    if (P > 1 && kb > 0) {
+        // Pack top ku and bottom kl rows of each local [ G_p, W_p, V_p ].
+        int64_t block_size = kb*ncols;
+        std::vector<scalar_t> packed( nparts*block_size );
+        for (int64_t p = 0; p < nparts; ++p) {
+            int64_t m = part_first[ p+1 ] - part_first[ p ];
+            scalar_t* Yp = &packed[ p*block_size ];
+            for (int64_t k = 0; k < ncols; ++k) {
+                for (int64_t t = 0; t < ku; ++t)
+                    Yp[ t + k*kb ] = GWV[ p ][ t + k*m ];
+                for (int64_t b = 0; b < kl; ++b)
+                    Yp[ ku + b + k*kb ] = GWV[ p ][ m - kl + b + k*m ];
+            }
+        }
+
+        std::vector<int> counts( mpi_size ), displs( mpi_size );
+        for (int r = 0, disp = 0; r < mpi_size; ++r) {
+            counts[ r ] = int( nparts_all[ r ]*block_size );
+            displs[ r ] = disp;
+            disp += counts[ r ];
+        }
+        std::vector<scalar_t> packed_all( P*block_size );
+        slate_mpi_call(
+            MPI_Allgatherv( packed.data(), counts[ mpi_rank ],
+                            mpi_type<scalar_t>::value,
+                            packed_all.data(), counts.data(), displs.data(),
+                            mpi_type<scalar_t>::value, mpi_comm ) );
+
+        // Assemble reduced matrix S in LAPACK band storage, with
+        // bandwidths kls = kb + kl - 1 and kus = kb + ku - 1.
+        int64_t kls = kb + kl - 1;
+        int64_t kus = kb + ku - 1;
+        int64_t ldabs = 2*kls + kus + 1;
+        std::vector<scalar_t> SAB( ldabs*N, zero );
+        auto S = [ & ]( int64_t i, int64_t j ) -> scalar_t& {
+            return SAB[ kls + kus + i - j + j*ldabs ];
+        };
+        for (int64_t p = 0; p < P; ++p) {
+            scalar_t const* Yp = &packed_all[ p*block_size ];
+            for (int64_t t = 0; t < kb; ++t) {
+                int64_t i = p*kb + t;
+                S( i, i ) = one;
+                for (int64_t k = 0; k < nrhs; ++k)
+                    Y[ i + k*N ] = Yp[ t + k*kb ];
+                if (p > 0) {
+                    for (int64_t c = 0; c < kl; ++c)
+                        S( i, (p-1)*kb + ku + c ) = Yp[ t + (nrhs + c)*kb ];
+                }
+                if (p < P-1) {
+                    for (int64_t c = 0; c < ku; ++c)
+                        S( i, (p+1)*kb + c ) = Yp[ t + (nrhs + kl + c)*kb ];
+                }
+            }
+        }
+        std::vector<int64_t> ipiv( N );
+        int64_t info_reduced
+            = lapack::gbsv( N, kls, kus, nrhs, SAB.data(), ldabs, ipiv.data(),
+                            Y.data(), N );
+        // Every rank solves the same reduced system, so all ranks return.
+        if (info_reduced > 0) {
+            A.releaseWorkspace();
+            B.releaseWorkspace();
+            return info_reduced;
+        }
+    }
+
+    //----------
+    // Step 3: x_p = G_p - V_p x_{p+1}^t - W_p x_{p-1}^b, copied to Brows.
+    #pragma omp parallel
+    #pragma omp master
+    {
+        for (int64_t p = 0; p < nparts; ++p) {
+            #pragma omp task slate_omp_default_none \
+                shared( GWV, Brows, Y, part_first ) \
+                firstprivate( p, P, part_offset, kl, ku, kb, nrhs, N, M, R0, \
+                              one )
+            {
+                int64_t m  = part_first[ p+1 ] - part_first[ p ];
+                int64_t pg = part_offset + p;
+                scalar_t* G = GWV[ p ].data();
+                if (pg < P-1 && ku > 0) {
+                    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                                m, nrhs, ku,
+                                -one, &G[ (nrhs + kl)*m ], m,
+                                      &Y[ (pg+1)*kb ], N,
+                                one,  G, m );
+                }
+                if (pg > 0 && kl > 0) {
+                    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                                m, nrhs, kl,
+                                -one, &G[ nrhs*m ], m,
+                                      &Y[ (pg-1)*kb + ku ], N,
+                                one,  G, m );
+                }
+                int64_t r0 = part_first[ p ];
+                for (int64_t k = 0; k < nrhs; ++k) {
+                    for (int64_t i = 0; i < m; ++i)
+                        Brows[ (r0 - R0 + i) + k*M ] = G[ i + k*m ];
+                }
+            }
+        }
+    }
+
+    //----------
+    // Copy solution into B tiles and send them back to their owners.
+    for (int64_t i = i_begin; i < i_end; ++i) {
+        for (int64_t j = 0; j < Bnt; ++j) {
+            B.tileGetForWriting( i, j, LayoutConvert( layout ) );
+            auto T = B( i, j );
+            int64_t jj0 = j * B.tileNb( 0 );
+            for (int64_t jj = 0; jj < T.nb(); ++jj) {
+                for (int64_t ii = 0; ii < T.mb(); ++ii) {
+                    T.at( ii, jj ) = Brows[ (row0[ i ] - R0 + ii) + (jj0 + jj)*M ];
+                }
+            }
+        }
+    }
+    for (int64_t i = 0; i < mt; ++i) {
+        for (int64_t j = 0; j < Bnt; ++j) {
+            int src = group_of( i );
+            int dst = B.tileRank( i, j );
+            if (dst == src)
+                continue;
+            if (src == mpi_rank) {
+                B( i, j ).send( dst, mpi_comm, tag_0 );
+            }
+            else if (dst == mpi_rank) {
+                B.tileGetForWriting( i, j, LayoutConvert( layout ) );
+                B( i, j ).recv( src, mpi_comm, layout, tag_0 );
+            }
+        }
+    }
+
+    B.tileUpdateAllOrigin();
+    A.releaseWorkspace();
+    B.releaseWorkspace();
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Partitioned (SPIKE) solve of $A X = B$ for general band $A$.
+/// A is not modified. See spike_solve.
+/// @return 0 on success, or > 0 if a partition failed; then B is not modified.
+/// @ingroup gbsv_internal
+///
+template <typename scalar_t>
+int64_t gbsv_spike(
+    BandMatrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Options const& opts)
+{
+    slate_assert( A.op() == Op::NoTrans );
+    return spike_solve( A, A.lowerBandwidth(), A.upperBandwidth(), false,
+                        B, opts );
+}
+
+//------------------------------------------------------------------------------
+/// Partitioned (SPIKE) solve of $A X = B$ for Hermitian positive definite
+/// band $A$. A is not modified. See spike_solve.
+/// @return 0 on success, or > 0 if a partition failed; then B is not modified.
+/// @ingroup pbsv_internal
+///
+template <typename scalar_t>
+int64_t pbsv_spike(
+    HermitianBandMatrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Options const& opts)
+{
+    int64_t kd = A.bandwidth();
+    return spike_solve( A, kd, kd, true, B, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+// ----------------------------------------
+template
+int64_t gbsv_spike<float>(
+    BandMatrix<float>& A,
+    Matrix<float>& B,
+    Options const& opts);
+
+template
+int64_t gbsv_spike<double>(
+    BandMatrix<double>& A,
+    Matrix<double>& B,
+    Options const& opts);
+
+template
+int64_t gbsv_spike< std::complex<float> >(
+    BandMatrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& B,
+    Options const& opts);
+
+template
+int64_t gbsv_spike< std::complex<double> >(
+    BandMatrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& B,
+    Options const& opts);
+
+// ----------------------------------------
+template
+int64_t pbsv_spike<float>(
+    HermitianBandMatrix<float>& A,
+    Matrix<float>& B,
+    Options const& opts);
+
+template
+int64_t pbsv_spike<double>(
+    HermitianBandMatrix<double>& A,
+    Matrix<double>& B,
+    Options const& opts);
+
+template
+int64_t pbsv_spike< std::complex<float> >(
+    HermitianBandMatrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& B,
+    Options const& opts);
+
+template
+int64_t pbsv_spike< std::complex<double> >(
+    HermitianBandMatrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& B,
+    Options const& opts);
+
+} // namespace internal
+} // namespace slate
@@ -7,6 +7,7 @@
 #include "slate/types.hh"
 #include "internal/internal.hh"
 #include "internal/internal_swap.hh"
+#include "slate/internal/DryRun.hh"
 
 #include <map>
 #include <vector>
@@ -210,6 +211,15 @@ void permuteRows(
     int comm_size;
     MPI_Comm_size(comm, &comm_size);
 
+    // A dry run may size a grid with more ranks than the communicator.
+    if (DryRun::enabled()) {
+        for (int64_t j = 0; j < A.nt(); ++j) {
+            for (int64_t i = 0; i < A.mt(); ++i) {
+                comm_size = std::max( comm_size, A.tileRank( i, j ) + 1 );
+            }
+        }
+    }
+
     {
         trace::Block trace_block("internal::permuteRows");
 
@@ -284,6 +294,20 @@ void permuteRows(
                     remote_count[r] = remote_index[r] - remote_offsets[r];
                 }
 
+                if (DryRun::enabled()) {
+                    // Count the gather and scatter of remote rows,
+                    // without moving any rows.
+                    for (int r = 0; r < comm_size; ++r) {
+                        if (remote_count[r] != 0) {
+                            int64_t bytes = remote_count[r]*nb*sizeof(scalar_t);
+                            DryRun::recv( bytes );
+                            DryRun::send( bytes );
+                        }
+                    }
+                    MPI_Type_free(&row_type);
+                    continue;
+                }
+
                 std::vector<scalar_t> remote_rows_vect (remote_offsets[comm_size]*nb);
                 scalar_t* remote_rows = remote_rows_vect.data();
 
@@ -363,6 +387,18 @@ void permuteRows(
                     }
                 }
 
+                if (DryRun::enabled()) {
+                    // Count the send and recv of local pivot rows,
+                    // without moving any rows.
+                    if (remote_length > 0) {
+                        int64_t bytes = remote_length*nb*sizeof(scalar_t);
+                        DryRun::send( bytes );
+                        DryRun::recv( bytes );
+                    }
+                    MPI_Type_free(&row_type);
+                    continue;
+                }
+
                 if (remote_length > 0) {
                     std::vector<scalar_t> remote_rows_vect (nb*remote_length);
                     scalar_t* remote_rows = remote_rows_vect.data();
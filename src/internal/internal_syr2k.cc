@@ -246,7 +246,6 @@ void syr2k(internal::TargetType<Target::HostBatch>,
            scalar_t beta,  SymmetricMatrix<scalar_t>& C,
            int priority, int queue_index, Layout layout, Options const& opts)
 {
-#ifdef BLAS_HAVE_MKL
     // CPU assumes column major
     // todo: relax this assumption, by allowing Tile_blas.hh::syr2k() to
     //       take layout param
@@ -313,11 +312,9 @@ void syr2k(internal::TargetType<Target::HostBatch>,
         Op opB = (opA == Op::NoTrans ? Op::Trans : Op::NoTrans);
 
         // all same
-        std::vector<CBLAS_TRANSPOSE> opA_array(batch_count,
-                                               cblas_trans_const(opA));
+        std::vector<Op> opA_array(batch_count, opA);
         // all same
-        std::vector<CBLAS_TRANSPOSE> opB_array(batch_count,
-                                               cblas_trans_const(opB));
+        std::vector<Op> opB_array(batch_count, opB);
         std::vector<int> m_array(batch_count);
         std::vector<int> n_array(batch_count);
         std::vector<int> k_array(batch_count);
@@ -375,32 +372,29 @@ void syr2k(internal::TargetType<Target::HostBatch>,
         }
 
         {
-            trace::Block trace_block("cblas_gemm_batch");
                 const scalar_t one = 1.0;
 
-            // mkl_set_num_threads_local(...);
-            cblas_gemm_batch(CblasColMajor,
-                             opA_array.data(), opB_array.data(),
-                             m_array.data(), n_array.data(), k_array.data(),
-                             alpha_array.data(),
-                             ai_array.data(), ldai_array.data(),
-                             bj_array.data(), ldbj_array.data(),
-                             beta_array.data(),
-                             c_array.data(), ldc_array.data(),
-                             batch_count, group_size.data());
+            gemm_batch(Layout::ColMajor,
+                       opA_array.data(), opB_array.data(),
+                       m_array.data(), n_array.data(), k_array.data(),
+                       alpha_array.data(),
+                       ai_array.data(), ldai_array.data(),
+                       bj_array.data(), ldbj_array.data(),
+                       beta_array.data(),
+                       c_array.data(), ldc_array.data(),
+                       batch_count, group_size.data());
 
             // ai => bi, bj => aj, set beta = 1
             std::fill( beta_array.begin(), beta_array.end(), one );
-            cblas_gemm_batch(CblasColMajor,
-                             opA_array.data(), opB_array.data(),
-                             m_array.data(), n_array.data(), k_array.data(),
-                             alpha_array.data(),
-                             bi_array.data(), ldbi_array.data(),
-                             aj_array.data(), ldaj_array.data(),
-                             beta_array.data(),
-                             c_array.data(), ldc_array.data(),
-                             batch_count, group_size.data());
-            // mkl_set_num_threads_local(1);
+            gemm_batch(Layout::ColMajor,
+                       opA_array.data(), opB_array.data(),
+                       m_array.data(), n_array.data(), k_array.data(),
+                       alpha_array.data(),
+                       bi_array.data(), ldbi_array.data(),
+                       aj_array.data(), ldaj_array.data(),
+                       beta_array.data(),
+                       c_array.data(), ldc_array.data(),
+                       batch_count, group_size.data());
         }
 
         for (int64_t j = 0; j < C.nt(); ++j) {
@@ -418,10 +412,6 @@ void syr2k(internal::TargetType<Target::HostBatch>,
 
     if (err)
         throw std::exception();
-#else
-    slate_not_implemented(
-        "slate::Target::HostBatch needs Intel MKL.");
-#endif
 }
 
 //------------------------------------------------------------------------------
@@ -66,15 +66,18 @@ void syrk(internal::TargetType<Target::HostTask>,
 
     // Lower, NoTrans
     int err = 0;
+    // Without a host instance of C(i, j) yet, there is nothing to be near.
+    scalar_t no_tile = 0;
     #pragma omp taskgroup
     for (int64_t j = 0; j < C.nt(); ++j) {
         for (int64_t i = j; i < C.mt(); ++i) {  // lower
             if (C.tileIsLocal(i, j)) {
+                scalar_t* C_ij = C.tileExists(i, j) ? C(i, j).data() : &no_tile;
                 if (i == j) {
                     #pragma omp task slate_omp_default_none \
                         shared( A, C, err ) \
                         firstprivate(j, layout, alpha, beta, call_tile_tick) \
-                        priority(priority)
+                        priority(priority) slate_omp_affinity( C_ij[ 0 ] )
                     {
                         try {
                             A.tileGetForReading(j, 0, LayoutConvert(layout));
@@ -97,7 +100,7 @@ void syrk(internal::TargetType<Target::HostTask>,
                     #pragma omp task slate_omp_default_none \
                         shared( A, C, err ) \
                         firstprivate(i, j, layout, alpha, beta, call_tile_tick) \
-                        priority(priority)
+                        priority(priority) slate_omp_affinity( C_ij[ 0 ] )
                     {
                         try {
                             A.tileGetForReading(i, 0, LayoutConvert(layout));
@@ -224,7 +227,6 @@ void syrk(internal::TargetType<Target::HostBatch>,
           int priority, int queue_index, Layout layout,
           Options const& opts)
 {
-#ifdef BLAS_HAVE_MKL
     // CPU assumes column major
     // todo: relax this assumption, by allowing Tile_blas.hh::syrk()
     //       to take layout param
@@ -290,11 +292,9 @@ void syrk(internal::TargetType<Target::HostBatch>,
         Op opB = (opA == Op::NoTrans ? Op::Trans : Op::NoTrans);
 
         // all same
-        std::vector<CBLAS_TRANSPOSE> opA_array(batch_count,
-                                               cblas_trans_const(opA));
+        std::vector<Op> opA_array(batch_count, opA);
         // all same
-        std::vector<CBLAS_TRANSPOSE> opB_array(batch_count,
-                                               cblas_trans_const(opB));
+        std::vector<Op> opB_array(batch_count, opB);
         std::vector<int> m_array(batch_count);
         std::vector<int> n_array(batch_count);
         std::vector<int> k_array(batch_count);
@@ -342,18 +342,15 @@ void syrk(internal::TargetType<Target::HostBatch>,
         }
 
         {
-            trace::Block trace_block("cblas_gemm_batch");
-            // mkl_set_num_threads_local(...);
-            cblas_gemm_batch(CblasColMajor,
-                             opA_array.data(), opB_array.data(),
-                             m_array.data(), n_array.data(), k_array.data(),
-                             alpha_array.data(),
-                             a_array.data(), lda_array.data(),
-                             b_array.data(), ldb_array.data(),
-                             beta_array.data(),
-                             c_array.data(), ldc_array.data(),
-                             batch_count, group_size.data());
-            // mkl_set_num_threads_local(1);
+            gemm_batch(Layout::ColMajor,
+                       opA_array.data(), opB_array.data(),
+                       m_array.data(), n_array.data(), k_array.data(),
+                       alpha_array.data(),
+                       a_array.data(), lda_array.data(),
+                       b_array.data(), ldb_array.data(),
+                       beta_array.data(),
+                       c_array.data(), ldc_array.data(),
+                       batch_count, group_size.data());
         }
 
         for (int64_t j = 0; j < C.nt(); ++j) {
@@ -369,10 +366,6 @@ void syrk(internal::TargetType<Target::HostBatch>,
 
     if (err)
         throw std::exception();
-#else
-    slate_not_implemented(
-        "slate::Target::HostBatch needs Intel MKL.");
-#endif
 }
 
 //------------------------------------------------------------------------------
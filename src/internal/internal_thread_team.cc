@@ -0,0 +1,166 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "internal/internal_thread_team.hh"
+#include "slate/internal/openmp.hh"
+#include "slate/internal/Trace.hh"
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// State shared by the threads of one ThreadTeam::run() call.
+struct ThreadTeam::Job {
+    std::function<void (int thread_rank)> const* body;
+    std::atomic<int> remaining;
+    std::mutex mutex;
+    std::exception_ptr exception;
+};
+
+//------------------------------------------------------------------------------
+/// A pool thread, and the job and rank it was last given.
+struct ThreadTeam::Worker {
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable wake;
+    Job* job = nullptr;
+    int thread_rank = 0;
+    bool shutdown = false;
+};
+
+//------------------------------------------------------------------------------
+/// @return the process-wide pool.
+///
+ThreadTeam& ThreadTeam::pool()
+{
+    static ThreadTeam pool_;
+    return pool_;
+}
+
+//------------------------------------------------------------------------------
+/// Stops and joins all workers. Must not be called while a run() is active.
+///
+ThreadTeam::~ThreadTeam()
+{
+    for (auto& worker : workers_) {
+        {
+            std::lock_guard<std::mutex> guard( worker->mutex );
+            worker->shutdown = true;
+        }
+        worker->wake.notify_one();
+        worker->thread.join();
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Worker loop: sleep until given a job, run body( thread_rank ), repeat.
+///
+void ThreadTeam::work( Worker* worker )
+{
+    omp_set_num_threads( 1 );
+    while (true) {
+        Job* job;
+        int thread_rank;
+        {
+            std::unique_lock<std::mutex> lock( worker->mutex );
+            worker->wake.wait( lock, [worker] {
+                return worker->shutdown || worker->job != nullptr;
+            } );
+            if (worker->job == nullptr)
+                return;  // shutdown
+            job = worker->job;
+            thread_rank = worker->thread_rank;
+            worker->job = nullptr;
+        }
+        // omp_get_thread_num() is 0 on this thread, so trace events go
+        // in the row of thread_rank instead, as in a nested parallel region.
+        trace::Trace::thread_slot( thread_rank );
+        try {
+            (*job->body)( thread_rank );
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> guard( job->mutex );
+            if (! job->exception)
+                job->exception = std::current_exception();
+        }
+        --job->remaining;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Runs body( thread_rank ) for thread_rank = 0, ..., size-1 concurrently,
+/// with rank 0 on the calling thread, and returns when all have finished.
+/// Concurrent calls from different threads get disjoint workers.
+///
+/// @param[in] size
+///     Number of threads, including the calling thread.
+///
+/// @param[in] body
+///     Function to run on each thread.
+///     If any thread throws, the first exception is rethrown after all
+///     threads finish.
+///
+void ThreadTeam::run(
+    int size, std::function<void (int thread_rank)> const& body )
+{
+    if (size <= 1) {
+        body( 0 );
+        return;
+    }
+
+    // Take size - 1 idle workers, creating any that are missing.
+    std::vector< Worker* > team;
+    {
+        std::lock_guard<std::mutex> guard( mutex_ );
+        while (int( team.size() ) < size - 1) {
+            if (idle_.empty()) {
+                workers_.push_back( std::make_unique<Worker>() );
+                Worker* worker = workers_.back().get();
+                worker->thread = std::thread( &ThreadTeam::work, worker );
+                team.push_back( worker );
+            }
+            else {
+                team.push_back( idle_.back() );
+                idle_.pop_back();
+            }
+        }
+    }
+
+    Job job;
+    job.body = &body;
+    job.remaining = size - 1;
+    for (int k = 0; k < size - 1; ++k) {
+        {
+            std::lock_guard<std::mutex> guard( team[ k ]->mutex );
+            team[ k ]->job = &job;
+            team[ k ]->thread_rank = k + 1;
+        }
+        team[ k ]->wake.notify_one();
+    }
+
+    try {
+        body( 0 );
+    }
+    catch (...) {
+        std::lock_guard<std::mutex> guard( job.mutex );
+        if (! job.exception)
+            job.exception = std::current_exception();
+    }
+
+    // Panels are short; spin rather than sleep.
+    while (job.remaining > 0)
+        std::this_thread::yield();
+
+    {
+        std::lock_guard<std::mutex> guard( mutex_ );
+        idle_.insert( idle_.end(), team.begin(), team.end() );
+    }
+
+    if (job.exception)
+        std::rethrow_exception( job.exception );
+}
+
+} // namespace internal
+} // namespace slate
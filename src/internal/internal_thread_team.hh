@@ -0,0 +1,70 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+//------------------------------------------------------------------------------
+/// @file
+///
+#ifndef SLATE_INTERNAL_THREAD_TEAM_HH
+#define SLATE_INTERNAL_THREAD_TEAM_HH
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Persistent pool of threads that run panel kernels.
+///
+/// Panel kernels (getrf, geqrf, getrf_tntpiv panels) need size threads
+/// running concurrently, since they synchronize with ThreadBarrier.
+/// Previously each panel opened a nested `omp parallel` region, which
+/// creates a new team on every call. ThreadTeam::run() instead gangs the
+/// calling thread (as rank 0) with size - 1 idle workers from the pool,
+/// creating workers only when none are idle. Workers sleep between calls
+/// and persist across calls and routines.
+///
+/// Workers set their OpenMP max threads to 1, so BLAS called within a panel
+/// is single-threaded, as it was inside the nested parallel region.
+///
+class ThreadTeam {
+public:
+    static ThreadTeam& pool();
+
+    /// Creates an empty team; workers are created by run().
+    /// Drivers use the process-wide pool() instead.
+    ThreadTeam() = default;
+    ~ThreadTeam();
+
+    void run( int size, std::function<void (int thread_rank)> const& body );
+
+    /// @return number of worker threads created so far.
+    int num_workers() const
+    {
+        std::lock_guard<std::mutex> guard( mutex_ );
+        return int( workers_.size() );
+    }
+
+private:
+    struct Job;
+    struct Worker;
+
+    static void work( Worker* worker );
+
+    mutable std::mutex mutex_;
+    std::vector< std::unique_ptr<Worker> > workers_;
+    std::vector< Worker* > idle_;
+};
+
+} // namespace internal
+} // namespace slate
+
+#endif // SLATE_INTERNAL_THREAD_TEAM_HH
@@ -45,17 +45,17 @@ void trsm(internal::TargetType<Target::HostTask>,
           int priority, Layout layout, int64_t queue_index,
           Options const& opts)
 {
-    // CPU assumes column major
-    // todo: relax this assumption, by allowing Tile_blas.hh::trsm()
-    //       to take layout param
+    // tile::trsm follows the tiles' layout, so A and B are converted to
+    // the requested layout, ColMajor or RowMajor.
     // todo: optimize for the number of layout conversions,
     //       by watching 'layout' and 'B(i, j).layout()'
-    assert(layout == Layout::ColMajor);
     assert(A.mt() == 1);
 
     if (B.numLocalTiles() > 0) {
         A.tileGetForReading(0, 0, LayoutConvert(layout));
     }
+    // Without a host instance of B(i, j) yet, there is nothing to be near.
+    scalar_t no_tile = 0;
     // alternatively, if (side == right), (conj)-transpose both A and B,
     // then assume side == left; see slate::trsm
     #pragma omp taskgroup
@@ -63,9 +63,11 @@ void trsm(internal::TargetType<Target::HostTask>,
         assert(B.nt() == 1);
         for (int64_t i = 0; i < B.mt(); ++i) {
             if (B.tileIsLocal(i, 0)) {
+                scalar_t* B_ij = B.tileExists(i, 0) ? B(i, 0).data() : &no_tile;
                 #pragma omp task slate_omp_default_none \
                     shared( A, B ) \
-                    firstprivate(i, layout, side, alpha) priority(priority)
+                    firstprivate(i, layout, side, alpha) priority(priority) \
+                    slate_omp_affinity( B_ij[ 0 ] )
                 {
                     B.tileGetForWriting(i, 0, LayoutConvert(layout));
                     tile::trsm(
@@ -81,9 +83,11 @@ void trsm(internal::TargetType<Target::HostTask>,
         assert(B.mt() == 1);
         for (int64_t j = 0; j < B.nt(); ++j) {
             if (B.tileIsLocal(0, j)) {
+                scalar_t* B_ij = B.tileExists(0, j) ? B(0, j).data() : &no_tile;
                 #pragma omp task slate_omp_default_none \
                     shared( A, B ) \
-                    firstprivate(j, layout, side, alpha) priority(priority)
+                    firstprivate(j, layout, side, alpha) priority(priority) \
+                    slate_omp_affinity( B_ij[ 0 ] )
                 {
                     B.tileGetForWriting(0, j, LayoutConvert(layout));
                     tile::trsm(
@@ -117,6 +121,8 @@ void trsm(internal::TargetType<Target::HostNest>,
 //------------------------------------------------------------------------------
 /// Triangular solve matrix (multiple right-hand sides).
 /// Host batched implementation.
+/// All local tiles of B are solved against the same tile A(0, 0)
+/// in one call to trsm_batch.
 /// @ingroup trsm_internal
 ///
 template <typename scalar_t>
@@ -127,8 +133,86 @@ void trsm(internal::TargetType<Target::HostBatch>,
           int priority, Layout layout, int64_t queue_index,
           Options const& opts)
 {
-    trsm( internal::TargetType<Target::HostTask>(),
-            side, alpha, A, B, priority, layout, queue_index, opts );
+    using blas::conj;
+    using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
+
+    // CPU assumes column major
+    assert(layout == Layout::ColMajor);
+    assert(A.mt() == 1);
+
+    std::set<ij_tuple> B_tiles_set;
+    if (side == Side::Right) {
+        assert(B.nt() == 1);
+        for (int64_t i = 0; i < B.mt(); ++i) {
+            if (B.tileIsLocal(i, 0))
+                B_tiles_set.insert({i, 0});
+        }
+    }
+    else {
+        assert(B.mt() == 1);
+        for (int64_t j = 0; j < B.nt(); ++j) {
+            if (B.tileIsLocal(0, j))
+                B_tiles_set.insert({0, j});
+        }
+    }
+
+    int64_t batch_count = B_tiles_set.size();
+    if (batch_count == 0)
+        return;
+
+    A.tileGetForReading(0, 0, LayoutConvert(layout));
+    B.tileGetForWriting(B_tiles_set, LayoutConvert(layout));
+
+    auto T = A(0, 0);
+
+    // if op(B) is NoTrans, solve as is; otherwise
+    // switch op(A) <=> op(B), side left <=> right, m <=> n, as in tile::trsm
+    Side side2 = side;
+    Op opA = T.op();
+    if (B.op() != Op::NoTrans) {
+        if (T.is_complex && T.op() != Op::NoTrans && T.op() != B.op())
+            throw std::exception();
+
+        side2 = (side == Side::Left ? Side::Right : Side::Left);
+        if (T.op() == Op::NoTrans)
+            opA = B.op();
+        else if (T.op() == B.op() || T.is_real) {
+            // A and B are both Trans or both ConjTrans;
+            // Trans == ConjTrans if real
+            opA = Op::NoTrans;
+        }
+        else
+            throw std::exception();
+
+        if (B.op() == Op::ConjTrans)
+            alpha = conj(alpha);
+    }
+
+    std::vector<int> m_array(batch_count);
+    std::vector<int> n_array(batch_count);
+    std::vector<int> ldb_array(batch_count);
+    std::vector<scalar_t*> b_array(batch_count);
+
+    int64_t index = 0;
+    for (auto ij : B_tiles_set) {
+        auto Bij = B(std::get<0>(ij), std::get<1>(ij));
+        m_array[ index ] = (B.op() == Op::NoTrans ? Bij.mb() : Bij.nb());
+        n_array[ index ] = (B.op() == Op::NoTrans ? Bij.nb() : Bij.mb());
+        ldb_array[ index ] = Bij.stride();
+        b_array[ index ] = Bij.data();
+        ++index;
+    }
+
+    trsm_batch(Layout::ColMajor, side2, T.uploPhysical(), opA, A.diag(),
+               m_array.data(), n_array.data(),
+               alpha, T.data(), T.stride(),
+               b_array.data(), ldb_array.data(),
+               batch_count);
+
+    for (int64_t k = 0; k < batch_count; ++k) {
+        // todo: should tileRelease()?
+        A.tileTick(0, 0);
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -27,6 +27,391 @@ void unmtr_hb2st(
                 side, op, V, C, opts);
 }
 
+//------------------------------------------------------------------------------
+/// @return whether each block column of C is on a single rank,
+/// as the task-parallel unmtr_hb2st requires.
+///
+template <typename scalar_t>
+bool is_block_col_local(Matrix<scalar_t>& C)
+{
+    for (int64_t k = 0; k < C.nt(); ++k) {
+        for (int64_t i = 1; i < C.mt(); ++i) {
+            if (C.tileRank(i, k) != C.tileRank(0, k))
+                return false;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+/// Reflector blocks of one sweep j, for consecutive block rows
+/// i0, ..., i0 + nblk - 1, merged into one WY block, Q = I - V Tc V^H,
+/// where V = [ V(i0) ... V(i0 + nblk - 1) ] and block b of V covers
+/// block rows i0 + b and i0 + b + 1 of C, with the 1st row of i0 + b
+/// sliced off. Used by unmtr_hb2st_2d.
+///
+template <typename scalar_t>
+struct WYBlock {
+    int64_t i0, nblk, r0;           ///< first block row, # blocks, V index
+    int64_t row_end;                ///< last block row of C touched
+    int64_t wrows;                  ///< rows of W = V^H C, sum of vnb
+    std::vector<int64_t> vnb, mb0, mb1, woff;  ///< per block b
+    std::vector<scalar_t> Tc;       ///< wrows-by-wrows, block lower triangular
+    std::vector<scalar_t> tau;      ///< diag of V tiles, restored at the end
+    std::vector<int64_t> cols;      ///< local block cols of C touched
+    std::vector<int64_t> col_off;   ///< offset of each col in W, W2
+    std::vector<scalar_t> W, W2;    ///< V^H C and Tc V^H C for local cols
+};
+
+//------------------------------------------------------------------------------
+/// unmtr_hb2st for C with a 2D distribution, e.g., 2D block cyclic with
+/// p > 1, where the block rows that a reflector block updates together
+/// may be on different ranks.
+///
+/// Reflector blocks are merged into WY blocks of up to wy_blocks blocks of
+/// one sweep, applied as C -= V (Tc (V^H C)) with gemm. Reflector blocks
+/// that share no block row of C commute, so the WY blocks are applied in
+/// wavefronts f = 2 j - c, for chunk c of sweep j, from the last wavefront
+/// to the first; WY blocks in one wavefront share no rows.
+///
+/// For each wavefront, each rank computes the partial W = V^H C on its
+/// tiles, then exchanges partial W with the other owners of the same
+/// block columns, in one message per pair of ranks for the whole
+/// wavefront, with receives posted before W is computed. Each rank sums W,
+/// forms Tc W for the blocks touching its tiles, and updates its tiles.
+/// The V tiles of the next wavefront are broadcast, and its Tc formed,
+/// while the current wavefront is updated.
+///
+/// Merging costs extra flops for Tc W, about (wy_blocks + 1)/8 of the
+/// unmerged update, in exchange for wy_blocks times fewer exchanges.
+/// Computes on the host.
+///
+/// @ingroup heev_internal
+///
+template <typename scalar_t>
+void unmtr_hb2st_2d(
+    Matrix<scalar_t>& V,
+    Matrix<scalar_t>& C)
+{
+    const scalar_t zero = 0, one = 1;
+    // Reflector blocks per WY block.
+    const int64_t wy_blocks = 2;
+
+    int64_t nb = V.tileNb(0);
+    int64_t mt = C.mt();
+    int64_t nt = C.nt();
+    int mpi_rank = C.mpiRank();
+
+    // Slice off 1st row of V.
+    auto V_ = V.slice( 1, V.m()-1, 0, V.n()-1 );
+
+    C.tileGetAllForWriting( HostNum, LayoutConvert::ColMajor );
+
+    // Tags of V broadcasts are j < mt.
+    int tag_0 = mt;
+    MPI_Comm comm = C.mpiComm();
+
+    // Broadcasts V tiles of wavefront f and forms Tc of its WY blocks.
+    auto prepare = [&]( int64_t f ) {
+        std::vector< WYBlock<scalar_t> > blocks;
+        for (int64_t j = 0; j < mt; ++j) {
+            int64_t c = 2*j - f;
+            int64_t i0 = j + c*wy_blocks;
+            if (c < 0 || i0 >= mt)
+                continue;
+
+            blocks.emplace_back();
+            WYBlock<scalar_t>& wy = blocks.back();
+            wy.i0 = i0;
+            wy.nblk = std::min( wy_blocks, mt - i0 );
+            wy.row_end = std::min( i0 + wy.nblk, mt-1 );
+            // Index of block of V, using lower triangular packed indexing.
+            wy.r0 = i0 - j + j*mt - j*(j-1)/2;
+
+            auto C_rows = C.sub( i0, wy.row_end, 0, nt-1 );
+            for (int64_t b = 0; b < wy.nblk; ++b) {
+                V.tileBcast( 0, wy.r0 + b, C_rows, Layout::ColMajor, j );
+            }
+
+            for (int64_t k = 0; k < nt; ++k) {
+                for (int64_t i = i0; i <= wy.row_end; ++i) {
+                    if (C.tileIsLocal( i, k )) {
+                        wy.cols.push_back( k );
+                        break;
+                    }
+                }
+            }
+            if (wy.cols.empty())
+                continue;
+
+            wy.wrows = 0;
+            for (int64_t b = 0; b < wy.nblk; ++b) {
+                int64_t i = i0 + b;
+                wy.mb0.push_back( C.tileMb( i ) - 1 );
+                wy.mb1.push_back( i+1 < mt ? C.tileMb( i+1 ) : 0 );
+                wy.vnb.push_back( std::min( nb, wy.mb0[ b ] + wy.mb1[ b ] ) );
+                wy.woff.push_back( wy.wrows );
+                wy.wrows += wy.vnb[ b ];
+            }
+
+            // Copy tau, which is stored on diag(V), and set diag(V) = 1.
+            // diag(V) is restored later.
+            int64_t ldt = wy.wrows;
+            wy.tau.resize( wy.wrows );
+            wy.Tc.assign( wy.wrows * wy.wrows, zero );
+            std::vector<scalar_t> S( nb*nb ), Y( nb*wy.wrows );
+            for (int64_t b = 0; b < wy.nblk; ++b) {
+                auto Vb = V_( 0, wy.r0 + b );
+                scalar_t* Vb_data = Vb.data();
+                int64_t ldv = Vb.stride();
+                int64_t vnb = wy.vnb[ b ];
+                int64_t off = wy.woff[ b ];
+                for (int64_t ii = 0; ii < vnb; ++ii) {
+                    wy.tau[ off + ii ] = Vb_data[ ii + ii*ldv ];
+                    Vb_data[ ii + ii*ldv ] = 1;
+                }
+
+                // Diagonal block: T of reflector block b.
+                scalar_t* Tbb = &wy.Tc[ off + off*ldt ];
+                lapack::larft( Direction::Forward, lapack::StoreV::Columnwise,
+                               wy.mb0[ b ] + wy.mb1[ b ], vnb,
+                               Vb_data, ldv, &wy.tau[ off ], Tbb, ldt );
+
+                // Block b is applied after blocks 0 : b-1, so
+                // Tc(b, 0:b-1) = -T_b V_b^H V(0:b-1) Tc(0:b-1, 0:b-1),
+                // where only V_{b-1} overlaps V_b, in block row i0 + b:
+                // V_b^H V(0:b-1) = [ 0 ... 0 S ].
+                if (b > 0) {
+                    auto Vp = V_( 0, wy.r0 + b-1 );
+                    int64_t vnb_p = wy.vnb[ b-1 ];
+                    int64_t off_p = wy.woff[ b-1 ];
+                    // S = V_b(0:mb0, :)^H V_{b-1}(mb0_{b-1} + 1 : end, :)
+                    blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+                                vnb, vnb_p, wy.mb0[ b ],
+                                one,  Vb_data, ldv,
+                                      &Vp.data()[ wy.mb0[ b-1 ] + 1 ], Vp.stride(),
+                                zero, S.data(), vnb );
+                    // Y = S Tc(b-1, 0:b-1)
+                    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                                vnb, off, vnb_p,
+                                one,  S.data(), vnb,
+                                      &wy.Tc[ off_p ], ldt,
+                                zero, Y.data(), vnb );
+                    // Tc(b, 0:b-1) = -T_b Y
+                    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                                vnb, off, vnb,
+                                -one, Tbb, ldt,
+                                      Y.data(), vnb,
+                                zero, &wy.Tc[ off ], ldt );
+                }
+            }
+
+            wy.col_off.resize( wy.cols.size() + 1, 0 );
+            for (size_t c = 0; c < wy.cols.size(); ++c) {
+                wy.col_off[ c+1 ] = wy.col_off[ c ]
+                                  + wy.wrows * C.tileNb( wy.cols[ c ] );
+            }
+            wy.W.resize( wy.col_off.back() );
+            wy.W2.resize( wy.col_off.back() );
+        }
+        return blocks;
+    };
+
+    int64_t f_first = 2*(mt-1);
+    int64_t f_last  = -ceildiv( mt, wy_blocks );
+    std::vector< WYBlock<scalar_t> > blocks = prepare( f_first ), next;
+    for (int64_t f = f_first; f >= f_last; --f) {
+        // Partners: other owners of tiles in the rows of a WY block,
+        // for each local block col, in the same order on both ranks.
+        std::map< int, std::vector< std::pair<WYBlock<scalar_t>*, size_t> > >
+            partner_cols;
+        for (auto& wy : blocks) {
+            for (size_t c = 0; c < wy.cols.size(); ++c) {
+                std::set<int> owners;
+                for (int64_t i = wy.i0; i <= wy.row_end; ++i)
+                    owners.insert( C.tileRank( i, wy.cols[ c ] ) );
+                owners.erase( mpi_rank );
+                for (int partner : owners)
+                    partner_cols[ partner ].push_back( { &wy, c } );
+            }
+        }
+
+        // Post receives before computing W.
+        std::map< int, std::vector<scalar_t> > send_bufs, recv_bufs;
+        std::vector<MPI_Request> requests;
+        for (auto& item : partner_cols) {
+            int count = 0;
+            for (auto& wy_c : item.second) {
+                auto* wy = wy_c.first;
+                count += wy->col_off[ wy_c.second+1 ] - wy->col_off[ wy_c.second ];
+            }
+            auto& recv_buf = recv_bufs[ item.first ];
+            recv_buf.resize( count );
+            requests.push_back( MPI_REQUEST_NULL );
+            slate_mpi_call(
+                MPI_Irecv( recv_buf.data(), count, mpi_type<scalar_t>::value,
+                           item.first, tag_0 + f - f_last, comm,
+                           &requests.back() ));
+        }
+
+        // Partial W = V^H C, for local tiles,
+        // W_b += V_b(0:mb0, :)^H C(i0 + b, 1:end, :), with 1st row sliced off,
+        // W_b += V_b(mb0:end, :)^H C(i0 + b + 1, :, :).
+        #pragma omp taskgroup
+        for (auto& block : blocks) {
+            for (size_t c = 0; c < block.cols.size(); ++c) {
+                WYBlock<scalar_t>* wy_ptr = &block;
+                #pragma omp task slate_omp_default_none \
+                    shared( C, V_ ) firstprivate( wy_ptr, c, zero, one )
+                {
+                    auto& wy = *wy_ptr;
+                    int64_t k = wy.cols[ c ];
+                    int64_t cnb = C.tileNb( k );
+                    scalar_t* Wk = &wy.W[ wy.col_off[ c ] ];
+                    std::fill( Wk, Wk + wy.wrows*cnb, zero );
+                    for (int64_t i = wy.i0; i <= wy.row_end; ++i) {
+                        if (! C.tileIsLocal( i, k ))
+                            continue;
+                        auto Ci = C( i, k );
+                        int64_t b = i - wy.i0;
+                        if (b < wy.nblk) {
+                            auto Vb = V_( 0, wy.r0 + b );
+                            blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+                                        wy.vnb[ b ], cnb, wy.mb0[ b ],
+                                        one, Vb.data(), Vb.stride(),
+                                             &Ci.data()[ 1 ], Ci.stride(),
+                                        one, &Wk[ wy.woff[ b ] ], wy.wrows );
+                        }
+                        b = i - wy.i0 - 1;
+                        if (b >= 0) {
+                            auto Vb = V_( 0, wy.r0 + b );
+                            blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+                                        wy.vnb[ b ], cnb, wy.mb1[ b ],
+                                        one, &Vb.data()[ wy.mb0[ b ] ], Vb.stride(),
+                                             Ci.data(), Ci.stride(),
+                                        one, &Wk[ wy.woff[ b ] ], wy.wrows );
+                        }
+                    }
+                }
+            }
+        }
+
+        // Exchange partial W, one message per partner, and sum.
+        for (auto& item : partner_cols) {
+            auto& send_buf = send_bufs[ item.first ];
+            for (auto& wy_c : item.second) {
+                auto* wy = wy_c.first;
+                send_buf.insert( send_buf.end(),
+                                 wy->W.begin() + wy->col_off[ wy_c.second ],
+                                 wy->W.begin() + wy->col_off[ wy_c.second+1 ] );
+            }
+            requests.push_back( MPI_REQUEST_NULL );
+            slate_mpi_call(
+                MPI_Isend( send_buf.data(), send_buf.size(),
+                           mpi_type<scalar_t>::value,
+                           item.first, tag_0 + f - f_last, comm,
+                           &requests.back() ));
+        }
+        slate_mpi_call(
+            MPI_Waitall( requests.size(), requests.data(),
+                         MPI_STATUSES_IGNORE ));
+        for (auto& item : partner_cols) {
+            scalar_t* recv_data = recv_bufs[ item.first ].data();
+            for (auto& wy_c : item.second) {
+                auto* wy = wy_c.first;
+                int64_t begin = wy->col_off[ wy_c.second ];
+                int64_t count = wy->col_off[ wy_c.second+1 ] - begin;
+                blas::axpy( count, one, recv_data, 1, &wy->W[ begin ], 1 );
+                recv_data += count;
+            }
+        }
+
+        // For blocks b touching local tiles,
+        // W2_b = Tc(b, 0:b) W(0:b), as Tc is block lower triangular.
+        // C(i0 + b, 1:end, :) -= V_b(0:mb0, :) W2_b,
+        // C(i0 + b + 1, :, :) -= V_b(mb0:end, :) W2_b.
+        // Meanwhile, prepare the next wavefront.
+        #pragma omp taskgroup
+        {
+            for (auto& block : blocks) {
+                for (size_t c = 0; c < block.cols.size(); ++c) {
+                    WYBlock<scalar_t>* wy_ptr = &block;
+                    #pragma omp task slate_omp_default_none \
+                        shared( C, V_ ) firstprivate( wy_ptr, c, zero, one )
+                    {
+                        auto& wy = *wy_ptr;
+                        int64_t k = wy.cols[ c ];
+                        int64_t cnb = C.tileNb( k );
+                        scalar_t* Wk  = &wy.W [ wy.col_off[ c ] ];
+                        scalar_t* W2k = &wy.W2[ wy.col_off[ c ] ];
+                        std::vector<bool> needed( wy.nblk, false );
+                        for (int64_t i = wy.i0; i <= wy.row_end; ++i) {
+                            if (C.tileIsLocal( i, k )) {
+                                if (i - wy.i0 < wy.nblk)
+                                    needed[ i - wy.i0 ] = true;
+                                if (i - wy.i0 - 1 >= 0)
+                                    needed[ i - wy.i0 - 1 ] = true;
+                            }
+                        }
+                        for (int64_t b = 0; b < wy.nblk; ++b) {
+                            if (needed[ b ]) {
+                                int64_t off = wy.woff[ b ];
+                                blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                                            wy.vnb[ b ], cnb, off + wy.vnb[ b ],
+                                            one,  &wy.Tc[ off ], wy.wrows,
+                                                  Wk, wy.wrows,
+                                            zero, &W2k[ off ], wy.wrows );
+                            }
+                        }
+                        for (int64_t i = wy.i0; i <= wy.row_end; ++i) {
+                            if (! C.tileIsLocal( i, k ))
+                                continue;
+                            auto Ci = C( i, k );
+                            int64_t b = i - wy.i0;
+                            if (b < wy.nblk) {
+                                auto Vb = V_( 0, wy.r0 + b );
+                                blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                                            wy.mb0[ b ], cnb, wy.vnb[ b ],
+                                            -one, Vb.data(), Vb.stride(),
+                                                  &W2k[ wy.woff[ b ] ], wy.wrows,
+                                            one,  &Ci.data()[ 1 ], Ci.stride() );
+                            }
+                            b = i - wy.i0 - 1;
+                            if (b >= 0) {
+                                auto Vb = V_( 0, wy.r0 + b );
+                                blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                                            wy.mb1[ b ], cnb, wy.vnb[ b ],
+                                            -one, &Vb.data()[ wy.mb0[ b ] ], Vb.stride(),
+                                                  &W2k[ wy.woff[ b ] ], wy.wrows,
+                                            one,  Ci.data(), Ci.stride() );
+                            }
+                        }
+                    }
+                }
+            }
+
+            if (f > f_last)
+                next = prepare( f-1 );
+        }
+
+        // Restore diag(V) = tau, and release received V tiles.
+        for (auto& wy : blocks) {
+            for (int64_t b = 0; b < wy.nblk; ++b) {
+                int64_t r = wy.r0 + b;
+                if (V_.tileIsLocal( 0, r ) && ! wy.cols.empty()) {
+                    auto Vb = V_( 0, r );
+                    for (int64_t ii = 0; ii < wy.vnb[ b ]; ++ii) {
+                        Vb.data()[ ii + ii*Vb.stride() ] = wy.tau[ wy.woff[ b ] + ii ];
+                    }
+                }
+                V.releaseRemoteWorkspaceTile( 0, r );
+            }
+        }
+        blocks = std::move( next );
+        next.clear();
+    }
+}
+
 //------------------------------------------------------------------------------
 /// Generic implementation of unmtr_hb2st
 ///
@@ -45,6 +430,11 @@ void unmtr_hb2st( internal::TargetType<target>,
 {
     slate_assert(side == Side::Left);
 
+    if (! is_block_col_local( C )) {
+        unmtr_hb2st_2d( V, C );
+        return;
+    }
+
     const scalar_t zero = 0, one = 1;
 
     int64_t mb = V.tileMb(0); // == 2 nb
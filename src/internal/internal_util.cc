@@ -48,5 +48,125 @@ void mpi_max_nan(void* invec, void* inoutvec, int* len, MPI_Datatype* datatype)
     }
 }
 
+//------------------------------------------------------------------------------
+/// [internal]
+/// Implements a custom MPI reduction on (scale, sumsq) pairs, combining them
+/// as LAPACK lassq does, so the Frobenius norm does not overflow.
+/// The datatype must be from mpi_type_sumsq, so each element is one pair
+/// and the reduction is elementwise, however MPI segments the buffer.
+///
+void mpi_combine_sumsq(void* invec, void* inoutvec, int* len, MPI_Datatype* datatype)
+{
+    int size;
+    slate_mpi_call(
+        MPI_Type_size(*datatype, &size));
+
+    if (size == 2*sizeof(double)) {
+        double* x = (double*) invec;
+        double* y = (double*) inoutvec;
+        for (int i = 0; i < *len; ++i)
+            combine_sumsq(y[2*i], y[2*i+1], x[2*i], x[2*i+1]);
+    }
+    else if (size == 2*sizeof(float)) {
+        float* x = (float*) invec;
+        float* y = (float*) inoutvec;
+        for (int i = 0; i < *len; ++i)
+            combine_sumsq(y[2*i], y[2*i+1], x[2*i], x[2*i+1]);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Implements a custom MPI reduction on the packed local norms of
+/// slate::norms, [ max, scale, sumsq, sums... ]: max propagating NaNs,
+/// (scale, sumsq) combined as LAPACK lassq does, and the column and row sums
+/// added. Each element of the datatype is one whole buffer, from
+/// MPI_Type_contiguous, so the reduction is correct however MPI segments
+/// the message.
+///
+template <typename real_t>
+void mpi_reduce_norms(void* invec, void* inoutvec, int* len, MPI_Datatype* datatype)
+{
+    int size;
+    slate_mpi_call(
+        MPI_Type_size(*datatype, &size));
+    int64_t count = size / sizeof(real_t);
+
+    real_t* x = (real_t*) invec;
+    real_t* y = (real_t*) inoutvec;
+    for (int k = 0; k < *len; ++k) {
+        y[0] = max_nan(x[0], y[0]);
+        combine_sumsq(y[1], y[2], x[1], x[2]);
+        for (int64_t i = 3; i < count; ++i)
+            y[i] += x[i];
+        x += count;
+        y += count;
+    }
+}
+
+//------------------------------
+// explicit instantiation
+template
+void mpi_reduce_norms<float>(
+    void* invec, void* inoutvec, int* len, MPI_Datatype* datatype);
+
+template
+void mpi_reduce_norms<double>(
+    void* invec, void* inoutvec, int* len, MPI_Datatype* datatype);
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Creates and commits the datatype of one (scale, sumsq) pair,
+/// for reductions with mpi_combine_sumsq. Free it with MPI_Type_free.
+///
+/// @param[in] real_type
+///     MPI_DOUBLE or MPI_FLOAT.
+///
+MPI_Datatype mpi_type_sumsq(MPI_Datatype real_type)
+{
+    MPI_Datatype pair_type;
+    slate_mpi_call(
+        MPI_Type_contiguous(2, real_type, &pair_type));
+    slate_mpi_call(
+        MPI_Type_commit(&pair_type));
+    return pair_type;
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Identifies which ranks of a communicator share a node (shared-memory
+/// domain). Collective over comm.
+///
+/// @return vector of length comm size, where entry r is the lowest rank in
+///     comm on the same node as rank r, so ranks on the same node have
+///     the same id.
+///
+std::vector<int> mpi_node_ids(MPI_Comm comm)
+{
+    int mpi_rank, mpi_size;
+    slate_mpi_call(
+        MPI_Comm_rank(comm, &mpi_rank));
+    slate_mpi_call(
+        MPI_Comm_size(comm, &mpi_size));
+
+    // Ranks are ordered by comm rank within node_comm,
+    // so node rank 0 is the lowest comm rank on the node.
+    MPI_Comm node_comm;
+    slate_mpi_call(
+        MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, mpi_rank,
+                            MPI_INFO_NULL, &node_comm));
+    int node_id = mpi_rank;
+    slate_mpi_call(
+        MPI_Bcast(&node_id, 1, MPI_INT, 0, node_comm));
+    slate_mpi_call(
+        MPI_Comm_free(&node_comm));
+
+    std::vector<int> node_ids(mpi_size);
+    slate_mpi_call(
+        MPI_Allgather(&node_id, 1, MPI_INT,
+                      node_ids.data(), 1, MPI_INT, comm));
+    return node_ids;
+}
+
 } // namespace internal
 } // namespace slate
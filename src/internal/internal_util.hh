@@ -14,6 +14,7 @@
 
 #include <cmath>
 #include <complex>
+#include <vector>
 
 #include <blas.hh>
 
@@ -25,6 +26,17 @@ T pow(T base, T exp);
 
 void mpi_max_nan(void* invec, void* inoutvec, int* len, MPI_Datatype* datatype);
 
+void mpi_combine_sumsq(void* invec, void* inoutvec, int* len, MPI_Datatype* datatype);
+
+template <typename real_t>
+void mpi_reduce_norms(void* invec, void* inoutvec, int* len, MPI_Datatype* datatype);
+
+MPI_Datatype mpi_type_sumsq(MPI_Datatype real_type);
+
+std::vector<int> mpi_node_ids(MPI_Comm comm);
+
+ReducePlan reducePlan(Options const& opts, MPI_Comm comm);
+
 //------------------------------------------
 inline float real(float val) { return val; }
 inline double real(double val) { return val; }
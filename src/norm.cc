@@ -30,6 +30,7 @@ norm(
     using scalar_t = typename matrix_type::value_type;
     using real_t = blas::real_type<scalar_t>;
     using internal::mpi_max_nan;
+    using internal::mpi_combine_sumsq;
 
     // Undo any transpose, which switches one <=> inf norms.
     if (A.op() == Op::ConjTrans || A.op() == Op::Trans) {
@@ -157,8 +158,7 @@ norm(
     else if (in_norm == Norm::Fro) {
 
         real_t local_values[2];
-        real_t local_sumsq;
-        real_t global_sumsq;
+        real_t global_values[2];
 
         if (target == Target::Devices) {
             A.reserveDeviceWorkspace();
@@ -170,20 +170,36 @@ norm(
             internal::norm<target>(in_norm, NormScope::Matrix, std::move(A), local_values);
         }
 
+        // Reduce the (scale, sumsq) pair, propagating scale to avoid overflow.
+        MPI_Op op_combine_sumsq;
+        MPI_Datatype type_sumsq;
+        #pragma omp critical(slate_mpi)
+        {
+            slate_mpi_call(
+                MPI_Op_create(mpi_combine_sumsq, true, &op_combine_sumsq));
+            type_sumsq = internal::mpi_type_sumsq(mpi_type<real_t>::value);
+        }
+
         #pragma omp critical(slate_mpi)
         {
             trace::Block trace_block("MPI_Allreduce");
-            // todo: propogate scale
-            local_sumsq = local_values[0] * local_values[0] * local_values[1];
             slate_mpi_call(
-                MPI_Allreduce(&local_sumsq, &global_sumsq,
-                              1, mpi_type<real_t>::value,
-                              MPI_SUM, A.mpiComm()));
+                MPI_Allreduce(local_values, global_values,
+                              1, type_sumsq,
+                              op_combine_sumsq, A.mpiComm()));
+        }
+
+        #pragma omp critical(slate_mpi)
+        {
+            slate_mpi_call(
+                MPI_Op_free(&op_combine_sumsq));
+            slate_mpi_call(
+                MPI_Type_free(&type_sumsq));
         }
 
         A.releaseWorkspace();
 
-        return sqrt(global_sumsq);
+        return global_values[0] * sqrt(global_values[1]);
     }
     else {
         slate_error("invalid norm.");
@@ -0,0 +1,573 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal.hh"
+#include "internal/internal_util.hh"
+#include "internal/Tile_lapack.hh"
+#include "internal/Tile_henorm.hh"
+#include "internal/Tile_synorm.hh"
+#include "slate/internal/mpi.hh"
+
+#include <type_traits>
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// @internal
+/// Norms of a diagonal tile of a Hermitian, symmetric, or trapezoid matrix,
+/// using the same tile kernels as norm. Overloaded on the matrix type.
+/// @ingroup norm_impl
+///
+template <typename scalar_t>
+void diag_tile_norm(
+    Norm norm, HermitianMatrix<scalar_t>& A, int64_t j,
+    blas::real_type<scalar_t>* values)
+{
+    henorm( norm, A( j, j ), values );
+}
+
+template <typename scalar_t>
+void diag_tile_norm(
+    Norm norm, SymmetricMatrix<scalar_t>& A, int64_t j,
+    blas::real_type<scalar_t>* values)
+{
+    synorm( norm, A( j, j ), values );
+}
+
+template <typename scalar_t>
+void diag_tile_norm(
+    Norm norm, TrapezoidMatrix<scalar_t>& A, int64_t j,
+    blas::real_type<scalar_t>* values)
+{
+    trnorm( norm, A.diag(), A( j, j ), values );
+}
+
+template <typename scalar_t>
+void diag_tile_norm(
+    Norm norm, Matrix<scalar_t>& A, int64_t j,
+    blas::real_type<scalar_t>* values)
+{
+    // General matrices have no diagonal tiles.
+    slate_error( "invalid matrix type" );
+}
+
+//------------------------------------------------------------------------------
+/// @internal
+/// Local max, column sums, row sums, and scaled sum-of-squares of a
+/// general, Hermitian, symmetric, or trapezoid matrix, in one pass over the
+/// local tiles: each tile is read once, and all requested norms are
+/// computed while it is in cache.
+/// For Hermitian and symmetric matrices, row sums equal column sums,
+/// so row_sums must be null.
+/// Any output may be null to skip it.
+/// Must be called inside an OpenMP parallel master region.
+/// @ingroup norm_impl
+///
+template <typename matrix_type>
+void norms_local(
+    matrix_type& A,
+    blas::real_type<typename matrix_type::value_type>* max,
+    blas::real_type<typename matrix_type::value_type>* col_sums,
+    blas::real_type<typename matrix_type::value_type>* row_sums,
+    blas::real_type<typename matrix_type::value_type>* scale_sumsq)
+{
+    using scalar_t = typename matrix_type::value_type;
+    using real_t = blas::real_type<scalar_t>;
+
+    // Off-diagonal tiles of Hermitian and symmetric matrices also stand
+    // for their transposes: the tile's row sums add to column sums of the
+    // transpose, and its sum-of-squares counts twice.
+    constexpr bool symmetric
+        = std::is_same< matrix_type, HermitianMatrix<scalar_t> >::value
+          || std::is_same< matrix_type, SymmetricMatrix<scalar_t> >::value;
+    assert( ! (symmetric && row_sums != nullptr) );
+
+    // norms assume column major
+    const Layout layout = Layout::ColMajor;
+
+    int64_t m = A.m();
+    int64_t n = A.n();
+    int64_t mt = A.mt();
+    int64_t nt = A.nt();
+    Uplo uplo = A.uplo();
+
+    // Per tile sums, summed below; tiles not local or not stored stay zero.
+    // For symmetric, tile (i, j)'s row sums go to columns of tile (j, i),
+    // a slot that no stored tile's column sums use.
+    std::vector<real_t> tiles_col_sums( col_sums != nullptr ? n*mt : 0, 0.0 );
+    std::vector<real_t> tiles_row_sums( row_sums != nullptr ? m*nt : 0, 0.0 );
+    real_t* tiles_transpose_sums
+        = symmetric ? tiles_col_sums.data() : tiles_row_sums.data();
+    int64_t ld_transpose_sums = symmetric ? n : m;
+
+    #pragma omp taskgroup
+    {
+        int64_t ii = 0;
+        for (int64_t i = 0; i < mt; ++i) {
+            int64_t jj = 0;
+            for (int64_t j = 0; j < nt; ++j) {
+                bool stored = uplo == Uplo::General
+                              || (uplo == Uplo::Lower && i >= j)
+                              || (uplo == Uplo::Upper && i <= j);
+                if (stored && A.tileIsLocal( i, j )) {
+                    #pragma omp task slate_omp_default_none \
+                        shared( A, tiles_col_sums, tiles_row_sums ) \
+                        firstprivate( i, j, ii, jj, m, n, uplo, layout, \
+                                      max, col_sums, row_sums, scale_sumsq, \
+                                      tiles_transpose_sums, ld_transpose_sums )
+                    {
+                        A.tileGetForReading( i, j, LayoutConvert( layout ) );
+                        real_t tile_max;
+                        real_t tile_values[ 2 ];
+                        real_t* tile_col_sums = col_sums != nullptr
+                                              ? &tiles_col_sums[ n*i + jj ]
+                                              : nullptr;
+                        if (i == j && uplo != Uplo::General) {
+                            // Diagonal tile: its kernels have no fused form,
+                            // but the tile stays in cache between them.
+                            if (max != nullptr)
+                                diag_tile_norm( Norm::Max, A, j, &tile_max );
+                            if (col_sums != nullptr)
+                                diag_tile_norm( Norm::One, A, j, tile_col_sums );
+                            if (row_sums != nullptr)
+                                diag_tile_norm( Norm::Inf, A, j,
+                                                &tiles_row_sums[ m*j + ii ] );
+                            if (scale_sumsq != nullptr)
+                                diag_tile_norm( Norm::Fro, A, j, tile_values );
+                        }
+                        else {
+                            real_t* tile_row_sums
+                                = (col_sums != nullptr && symmetric)
+                                  || row_sums != nullptr
+                                ? &tiles_transpose_sums[ ld_transpose_sums*j + ii ]
+                                : nullptr;
+                            genorms( A( i, j ),
+                                     max != nullptr ? &tile_max : nullptr,
+                                     tile_col_sums, tile_row_sums,
+                                     scale_sumsq != nullptr ? tile_values : nullptr );
+                            if (symmetric && scale_sumsq != nullptr)
+                                tile_values[ 1 ] *= 2;
+                        }
+                        if (max != nullptr || scale_sumsq != nullptr) {
+                            #pragma omp critical
+                            {
+                                if (max != nullptr)
+                                    *max = max_nan( tile_max, *max );
+                                if (scale_sumsq != nullptr)
+                                    combine_sumsq( scale_sumsq[ 0 ], scale_sumsq[ 1 ],
+                                                   tile_values[ 0 ], tile_values[ 1 ] );
+                            }
+                        }
+                    }
+                }
+                jj += A.tileNb( j );
+            }
+            ii += A.tileMb( i );
+        }
+    }
+
+    // Sum tile results into local results.
+    if (col_sums != nullptr) {
+        trace::Block trace_block("slate::Tiles_sum");
+        for (int64_t i = 0; i < mt; ++i) {
+            blas::axpy( n, 1.0, &tiles_col_sums[ n*i ], 1, col_sums, 1 );
+        }
+    }
+    if (row_sums != nullptr) {
+        trace::Block trace_block("slate::Tiles_sum");
+        for (int64_t j = 0; j < nt; ++j) {
+            blas::axpy( m, 1.0, &tiles_row_sums[ m*j ], 1, row_sums, 1 );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @internal
+/// Distributed parallel computation of several norms of a matrix at once.
+/// Generic implementation for any target.
+/// @ingroup norm_impl
+///
+template <Target target, typename matrix_type>
+void norms(
+    std::vector<Norm> const& in_norms, matrix_type A,
+    blas::real_type<typename matrix_type::value_type>* values,
+    Options const& opts )
+{
+    using scalar_t = typename matrix_type::value_type;
+    using real_t = blas::real_type<scalar_t>;
+
+    // For Hermitian and symmetric matrices, the inf norm is the one norm.
+    constexpr bool symmetric
+        = std::is_same< matrix_type, HermitianMatrix<scalar_t> >::value
+          || std::is_same< matrix_type, SymmetricMatrix<scalar_t> >::value;
+    // Matrix types with a fused local pass on the host.
+    constexpr bool fused
+        = target != Target::Devices
+          && (symmetric
+              || std::is_same< matrix_type, Matrix<scalar_t> >::value
+              || std::is_same< matrix_type, TrapezoidMatrix<scalar_t> >::value);
+
+    // Undo any transpose, which switches one <=> inf norms.
+    bool swap_one_inf = (A.op() != Op::NoTrans);
+    if (A.op() == Op::ConjTrans)
+        A = conj_transpose( A );
+    else if (A.op() == Op::Trans)
+        A = transpose(A);
+
+    std::vector<Norm> op_norms( in_norms );
+    bool want_max = false, want_one = false, want_inf = false, want_fro = false;
+    for (auto& in_norm : op_norms) {
+        if (swap_one_inf) {
+            if (in_norm == Norm::One)
+                in_norm = Norm::Inf;
+            else if (in_norm == Norm::Inf)
+                in_norm = Norm::One;
+        }
+        switch (in_norm) {
+            case Norm::Max: want_max = true; break;
+            case Norm::One: want_one = true; break;
+            case Norm::Inf: want_inf = true; break;
+            case Norm::Fro: want_fro = true; break;
+            default: slate_error("invalid norm.");
+        }
+    }
+    if (symmetric && want_inf) {
+        want_one = true;
+        want_inf = false;
+    }
+
+    int64_t m = A.m();
+    int64_t n = A.n();
+    int64_t n_one = want_one ? n : 0;
+    int64_t m_inf = want_inf ? m : 0;
+
+    // Local results, packed as
+    // [ max, scale, sumsq, col_sums[ 0 : n_one ], row_sums[ 0 : m_inf ] ].
+    std::vector<real_t> local_values( 3 + n_one + m_inf, 0.0 );
+    local_values[ 2 ] = 1;  // sumsq
+    real_t* local_max      = want_max ? &local_values[ 0 ] : nullptr;
+    real_t* local_fro      = want_fro ? &local_values[ 1 ] : nullptr;
+    real_t* local_col_sums = want_one ? &local_values[ 3 ] : nullptr;
+    real_t* local_row_sums = want_inf ? &local_values[ 3 + n_one ] : nullptr;
+
+    // TODO: Allocate batch arrays here, not in internal.
+    if (target == Target::Devices)
+        A.reserveDeviceWorkspace();
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        if constexpr (fused) {
+            // One fused pass over local tiles.
+            norms_local( A, local_max, local_col_sums, local_row_sums,
+                         local_fro );
+        }
+        else {
+            // Band matrices or devices: separate local passes,
+            // still followed by one reduction.
+            if (want_max) {
+                internal::norm<target>( Norm::Max, NormScope::Matrix,
+                                        std::move(A), local_max );
+            }
+            if (want_one) {
+                internal::norm<target>( Norm::One, NormScope::Matrix,
+                                        std::move(A), local_col_sums );
+            }
+            if (want_inf) {
+                internal::norm<target>( Norm::Inf, NormScope::Matrix,
+                                        std::move(A), local_row_sums );
+            }
+            if (want_fro) {
+                internal::norm<target>( Norm::Fro, NormScope::Matrix,
+                                        std::move(A), local_fro );
+            }
+        }
+    }
+
+    std::vector<real_t> global_values( local_values );
+
+    // One reduction of the whole packed buffer, as a single element of a
+    // contiguous datatype, so MPI cannot split it between the kinds.
+    MPI_Op op_reduce_norms;
+    MPI_Datatype type_norms;
+    #pragma omp critical(slate_mpi)
+    {
+        slate_mpi_call(
+            MPI_Op_create(internal::mpi_reduce_norms<real_t>, true,
+                          &op_reduce_norms));
+        slate_mpi_call(
+            MPI_Type_contiguous(local_values.size(), mpi_type<real_t>::value,
+                                &type_norms));
+        slate_mpi_call(
+            MPI_Type_commit(&type_norms));
+    }
+
+    #pragma omp critical(slate_mpi)
+    {
+        trace::Block trace_block("MPI_Allreduce");
+        slate_mpi_call(
+            MPI_Allreduce(local_values.data(), global_values.data(),
+                          1, type_norms,
+                          op_reduce_norms, A.mpiComm()));
+    }
+
+    #pragma omp critical(slate_mpi)
+    {
+        slate_mpi_call(
+            MPI_Op_free(&op_reduce_norms));
+        slate_mpi_call(
+            MPI_Type_free(&type_norms));
+    }
+
+    A.releaseWorkspace();
+
+    for (size_t k = 0; k < op_norms.size(); ++k) {
+        switch (op_norms[ k ]) {
+            case Norm::Max:
+                values[ k ] = global_values[ 0 ];
+                break;
+            case Norm::One:
+                values[ k ] = lapack::lange( Norm::Max, 1, n,
+                                             &global_values[ 3 ], 1 );
+                break;
+            case Norm::Inf:
+                if (symmetric) {
+                    values[ k ] = lapack::lange( Norm::Max, 1, n,
+                                                 &global_values[ 3 ], 1 );
+                }
+                else {
+                    values[ k ] = lapack::lange( Norm::Max, 1, m,
+                                                 &global_values[ 3 + n_one ], 1 );
+                }
+                break;
+            case Norm::Fro:
+                values[ k ] = global_values[ 1 ] * sqrt( global_values[ 2 ] );
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel computation of several norms of a matrix at once.
+///
+/// Computes any subset of the max, one, inf, and Frobenius norms with the
+/// same result as calling norm for each, but with one MPI reduction in
+/// total, however many norms are requested.
+/// For general, Hermitian, symmetric, and trapezoid matrices on the host,
+/// the local tiles are also read only once. Band matrices, and all matrices
+/// on devices, still use one local pass per norm.
+/// The Frobenius norm is carried through the reduction in scaled
+/// sum-of-squares form, as in LAPACK lassq, so it does not overflow.
+///
+//------------------------------------------------------------------------------
+/// @tparam matrix_type
+///     Any SLATE matrix type: Matrix, SymmetricMatrix, HermitianMatrix,
+///     TriangularMatrix, etc.
+//------------------------------------------------------------------------------
+/// @param[in] in_norms
+///     Norms to compute, in any order, each one of
+///     Norm::Max, Norm::One, Norm::Inf, Norm::Fro. See norm.
+///
+/// @param[in] A
+///     The matrix A.
+///
+/// @param[out] values
+///     Array of length in_norms.size(). On exit, values[k] is the norm
+///     in_norms[k] of A.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @ingroup norm
+///
+template <typename matrix_type>
+void norms(
+    std::vector<Norm> const& in_norms, matrix_type& A,
+    blas::real_type<typename matrix_type::value_type>* values,
+    Options const& opts )
+{
+    Target target = get_option( opts, Option::Target, Target::HostTask );
+
+    switch (target) {
+        case Target::Host:
+        case Target::HostTask:
+            impl::norms<Target::HostTask>( in_norms, A, values, opts );
+            break;
+
+        case Target::HostBatch:
+        case Target::HostNest:
+            impl::norms<Target::HostNest>( in_norms, A, values, opts );
+            break;
+
+        case Target::Devices:
+            impl::norms<Target::Devices>( in_norms, A, values, opts );
+            break;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void norms(
+    std::vector<Norm> const& in_norms, Matrix<float>& A,
+    float* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms, Matrix<double>& A,
+    double* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms, Matrix< std::complex<float> >& A,
+    float* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms, Matrix< std::complex<double> >& A,
+    double* values,
+    Options const& opts);
+
+//--------------------
+template
+void norms(
+    std::vector<Norm> const& in_norms, HermitianMatrix<float>& A,
+    float* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms, HermitianMatrix<double>& A,
+    double* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms, HermitianMatrix< std::complex<float> >& A,
+    float* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms, HermitianMatrix< std::complex<double> >& A,
+    double* values,
+    Options const& opts);
+
+//--------------------
+template
+void norms(
+    std::vector<Norm> const& in_norms, SymmetricMatrix<float>& A,
+    float* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms, SymmetricMatrix<double>& A,
+    double* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms, SymmetricMatrix< std::complex<float> >& A,
+    float* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms, SymmetricMatrix< std::complex<double> >& A,
+    double* values,
+    Options const& opts);
+
+//--------------------
+template
+void norms(
+    std::vector<Norm> const& in_norms, TrapezoidMatrix<float>& A,
+    float* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms, TrapezoidMatrix<double>& A,
+    double* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms, TrapezoidMatrix< std::complex<float> >& A,
+    float* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms, TrapezoidMatrix< std::complex<double> >& A,
+    double* values,
+    Options const& opts);
+
+//--------------------
+template
+void norms(
+    std::vector<Norm> const& in_norms, BandMatrix<float>& A,
+    float* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms, BandMatrix<double>& A,
+    double* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms, BandMatrix< std::complex<float> >& A,
+    float* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms, BandMatrix< std::complex<double> >& A,
+    double* values,
+    Options const& opts);
+
+//--------------------
+template
+void norms(
+    std::vector<Norm> const& in_norms, HermitianBandMatrix<float>& A,
+    float* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms, HermitianBandMatrix<double>& A,
+    double* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms, HermitianBandMatrix< std::complex<float> >& A,
+    float* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms, HermitianBandMatrix< std::complex<double> >& A,
+    double* values,
+    Options const& opts);
+
+} // namespace slate
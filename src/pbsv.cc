@@ -33,6 +33,14 @@ namespace slate {
 /// The factored form of $A$ is then used to solve the system of equations
 /// $A X = B$.
 ///
+/// With Option::MethodBand = MethodBand::Spike, a partitioned (SPIKE) solver
+/// is used instead, which scales with the number of cores and ranks for
+/// narrow bands. Rows are distributed 1D in contiguous partitions, each
+/// partition is factored independently, and a small reduced system couples
+/// the partitions. In this case, $A$ is not modified. If a partition fails
+/// to factor, the solve falls back to pbtrf and pbtrs, as with
+/// MethodBand::Tiled.
+///
 //------------------------------------------------------------------------------
 /// @tparam scalar_t
 ///     One of float, double, std::complex<float>, std::complex<double>.
@@ -49,6 +57,10 @@ namespace slate {
 ///
 /// @param[in] opts
 ///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::MethodBand:
+///       Band solver algorithm. Possible values:
+///       - MethodBand::Tiled: tiled factorization, pbtrf and pbtrs [default].
+///       - MethodBand::Spike: partitioned SPIKE solver, on the host.
 ///     - Option::Lookahead:
 ///       Number of panels to overlap with matrix updates.
 ///       lookahead >= 0. Default 1.
@@ -72,6 +84,17 @@ void pbsv(HermitianBandMatrix<scalar_t>& A,
           Matrix<scalar_t>& B,
           Options const& opts)
 {
+    Method method = get_option( opts, Option::MethodBand, MethodBand::Tiled );
+
+    if (method == MethodBand::Spike) {
+        // On failure, A and B are unchanged; fall back to pbtrf.
+        if (internal::pbsv_spike( A, B, opts ) == 0)
+            return;
+    }
+    else if (method != MethodBand::Tiled) {
+        throw Exception( "unknown value for MethodBand" );
+    }
+
     // factorization
     pbtrf(A, opts);
 
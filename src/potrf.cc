@@ -248,6 +248,10 @@ void potrf(
 ///       - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///       - HostBatch: batched BLAS on CPU host.
 ///       - Devices:   batched BLAS on GPU device.
+///     - Option::OzakiSlices:
+///       For HostTask and double, number of slices to emulate the
+///       off-diagonal trailing updates with single-precision gemm;
+///       see slate::gemm. Default 0: native double-precision gemm.
 ///
 /// TODO: return value
 /// @retval 0 successful exit
@@ -0,0 +1,366 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "slate/HermitianMatrix.hh"
+#include "internal/internal.hh"
+#include "internal/Tile_lapack.hh"
+#include "internal/Tile_lowrank.hh"
+
+#include <map>
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel tile low-rank (TLR) Cholesky factorization.
+/// Off-diagonal tiles are compressed to U V^H and their dense storage is
+/// released; diagonal tiles stay dense. Each step factors the diagonal tile,
+/// solves the compressed panel, writes L(:, k) back densely, exchanges the
+/// compressed panel, then updates each trailing column with low-rank gemm
+/// (with recompression) and herk, as tasks ordered by column dependencies.
+/// @ingroup posv_impl
+///
+template <Target target, typename scalar_t>
+void potrf_tlr(
+    slate::internal::TargetType<target>,
+    HermitianMatrix<scalar_t> A,
+    Options const& opts )
+{
+    using real_t = blas::real_type<scalar_t>;
+    using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
+
+    // Constants
+    const scalar_t one = 1.0;
+    const real_t r_one = 1.0;
+    // Assumes column major
+    const Layout layout = Layout::ColMajor;
+
+    // Options
+    real_t tol = get_option<double>( opts, Option::LowRankTolerance,
+                                     std::numeric_limits<real_t>::epsilon() );
+
+    // if upper, change to lower
+    if (A.uplo() == Uplo::Upper) {
+        A = conj_transpose( A );
+    }
+    int64_t A_nt = A.nt();
+    int mpi_rank = A.mpiRank();
+    MPI_Comm mpi_comm = A.mpiComm();
+
+    // Truncation threshold is relative to ||A||_F.
+    real_t Anorm = slate::norm( Norm::Fro, A, opts );
+    real_t tol_abs = tol * Anorm;
+
+    // Compressed tiles: local tiles of the strictly lower part, plus the
+    // remote panel tiles this rank receives. All entries are created here,
+    // so tasks below only look up entries and never modify the map.
+    std::map< ij_tuple, LowRankTile<scalar_t> > LR;
+    for (int64_t j = 0; j < A_nt; ++j) {
+        for (int64_t i = j+1; i < A_nt; ++i) {
+            if (A.tileIsLocal( i, j )) {
+                A.tileGetForWriting( i, j, LayoutConvert( layout ) );
+                LR[ { i, j } ];
+            }
+            else {
+                // L(i, j) is needed to update row i, A(i, j+1:i),
+                // and column i, A(i:nt-1, i).
+                std::set<int> dst_set;
+                A.sub( i, i, j+1, i ).getRanks( &dst_set );
+                A.sub( i, A_nt-1, i, i ).getRanks( &dst_set );
+                if (dst_set.count( mpi_rank ) > 0)
+                    LR[ { i, j } ];
+            }
+        }
+    }
+
+    // Row offset of each block column, to report info as a global row.
+    std::vector<int64_t> row_offset( A_nt, 0 );
+    for (int64_t k = 1; k < A_nt; ++k) {
+        row_offset[ k ] = row_offset[ k-1 ] + A.tileNb( k-1 );
+    }
+    // First failing row of local diagonal tiles; panel tasks are serialized
+    // by the column dependencies, so only one task updates it at a time.
+    const int64_t no_info = std::numeric_limits<int64_t>::max();
+    int64_t info = no_info;
+
+    // OpenMP needs pointer types, but vectors are exception safe
+    std::vector< uint8_t > column_vector( A_nt );
+    uint8_t* column = column_vector.data();
+    SLATE_UNUSED( column ); // Used only by OpenMP
+
+    // set min number for omp nested active parallel regions
+    slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        // Compress each column, then release its dense off-diagonal tiles;
+        // L(:, k) is written back densely when panel k is finished.
+        for (int64_t j = 0; j < A_nt-1; ++j) {
+            #pragma omp task depend(inout:column[j]) \
+                shared( A, LR ) firstprivate( j, A_nt, tol_abs )
+            {
+                for (int64_t i = j+1; i < A_nt; ++i) {
+                    if (A.tileIsLocal( i, j )) {
+                        LowRankTile<scalar_t>* Aij_lr = &LR.at( { i, j } );
+                        #pragma omp task slate_omp_default_none \
+                            shared( A ) firstprivate( i, j, Aij_lr, tol_abs )
+                        {
+                            tile::compress( A( i, j ), tol_abs, *Aij_lr );
+                            // User-owned tiles cannot be released.
+                            if (A( i, j ).allocated())
+                                A.tileErase( i, j );
+                        }
+                    }
+                }
+                #pragma omp taskwait
+            }
+        }
+
+        for (int64_t k = 0; k < A_nt; ++k) {
+            // Panel: factor A(k, k), solve and exchange compressed L(:, k).
+            #pragma omp task depend(inout:column[k]) \
+                shared( A, LR, info, row_offset ) \
+                firstprivate( k, A_nt, mpi_rank, mpi_comm, one )
+            {
+                // Factor diagonal tile; it is dense throughout.
+                if (A.tileIsLocal( k, k )) {
+                    A.tileGetForWriting( k, k, LayoutConvert( layout ) );
+                    int64_t iinfo = potrf( A( k, k ) );
+                    if (iinfo > 0 && info == no_info)
+                        info = row_offset[ k ] + iinfo;
+                }
+
+                if (k < A_nt-1) {
+                    auto Apanel = A.sub( k+1, A_nt-1, k, k );
+                    A.tileBcast( k, k, Apanel, layout );
+
+                    // A(i, k) = A(i, k) A(k, k)^{-H} on compressed tiles;
+                    // rank is unchanged, only V is updated.
+                    for (int64_t i = k+1; i < A_nt; ++i) {
+                        if (A.tileIsLocal( i, k )) {
+                            LowRankTile<scalar_t>* Aik_lr = &LR.at( { i, k } );
+                            #pragma omp task slate_omp_default_none \
+                                shared( A ) firstprivate( i, k, Aik_lr, one )
+                            {
+                                auto Akk = A( k, k );
+                                tile::trsm( Side::Right, Diag::NonUnit,
+                                            one, conj_transpose( Akk ),
+                                            *Aik_lr );
+                                // Write final L(i, k) back into A.
+                                if (! A.tileExists( i, k ))
+                                    A.tileInsert( i, k );
+                                tile::decompress( *Aik_lr, A( i, k ) );
+                            }
+                        }
+                    }
+                    #pragma omp taskwait
+
+                    // Exchange compressed panel tiles; the sends complete
+                    // before the panel is released below.
+                    std::vector<MPI_Request> send_requests;
+                    for (int64_t i = k+1; i < A_nt; ++i) {
+                        std::set<int> dst_set;
+                        A.sub( i, i, k+1, i ).getRanks( &dst_set );
+                        A.sub( i, A_nt-1, i, i ).getRanks( &dst_set );
+
+                        int src = A.tileRank( i, k );
+                        int tag = int( i % 32768 );
+                        auto& Aik_lr = LR.at( { i, k } );
+                        if (src == mpi_rank) {
+                            for (int dst : dst_set) {
+                                if (dst != mpi_rank) {
+                                    send_requests.push_back( MPI_REQUEST_NULL );
+                                    Aik_lr.isend( dst, mpi_comm, tag,
+                                                  &send_requests.back() );
+                                }
+                            }
+                        }
+                        else if (dst_set.count( mpi_rank ) > 0) {
+                            Aik_lr.resize( A.tileMb( i ), A.tileNb( k ), 0 );
+                            Aik_lr.recv( src, mpi_comm, tag );
+                        }
+                    }
+                    slate_mpi_call(
+                        MPI_Waitall( send_requests.size(), send_requests.data(),
+                                     MPI_STATUSES_IGNORE ) );
+                }
+            }
+
+            // Trailing update of each column j,
+            // A(i, j) -= L(i, k) L(j, k)^H, with recompression off-diagonal,
+            // A(j, j) -= L(j, k) L(j, k)^H, dense on the diagonal.
+            for (int64_t j = k+1; j < A_nt; ++j) {
+                #pragma omp task depend(in:column[k]) \
+                                 depend(inout:column[j]) \
+                    shared( A, LR ) firstprivate( j, k, A_nt, one, r_one, tol_abs )
+                {
+                    for (int64_t i = j; i < A_nt; ++i) {
+                        if (! A.tileIsLocal( i, j ))
+                            continue;
+
+                        LowRankTile<scalar_t>* Ajk_lr = &LR.at( { j, k } );
+                        if (i == j) {
+                            A.tileGetForWriting( j, j, LayoutConvert( layout ) );
+                            #pragma omp task slate_omp_default_none \
+                                shared( A ) firstprivate( j, Ajk_lr, r_one )
+                            {
+                                tile::herk( -r_one, *Ajk_lr, r_one, A( j, j ) );
+                            }
+                        }
+                        else {
+                            LowRankTile<scalar_t>* Aik_lr = &LR.at( { i, k } );
+                            LowRankTile<scalar_t>* Aij_lr = &LR.at( { i, j } );
+                            #pragma omp task slate_omp_default_none \
+                                firstprivate( Aik_lr, Ajk_lr, Aij_lr, \
+                                              one, tol_abs )
+                            {
+                                tile::gemm( -one, *Aik_lr,
+                                            tile::conj_transpose( *Ajk_lr ),
+                                            *Aij_lr, tol_abs );
+                            }
+                        }
+                    }
+                    #pragma omp taskwait
+                }
+            }
+
+            // Panel k is finished once all updates reading it are done;
+            // free its compressed tiles and the remote A(k, k).
+            #pragma omp task depend(inout:column[k]) \
+                shared( A, LR ) firstprivate( k, A_nt )
+            {
+                for (int64_t i = k+1; i < A_nt; ++i) {
+                    auto iter = LR.find( { i, k } );
+                    if (iter != LR.end())
+                        iter->second = LowRankTile<scalar_t>();
+                }
+                A.sub( k, A_nt-1, k, k ).releaseRemoteWorkspace();
+            }
+        }
+    }
+
+    A.tileUpdateAllOrigin();
+    A.releaseWorkspace();
+
+    // Reduce to the first failing row over all ranks, so all ranks throw.
+    int64_t info_min;
+    slate_mpi_call(
+        MPI_Allreduce( &info, &info_min, 1, MPI_INT64_T, MPI_MIN, mpi_comm ) );
+    if (info_min != no_info) {
+        slate_error( "potrf_tlr: the leading minor of order "
+                     + std::to_string( info_min )
+                     + " is not positive definite" );
+    }
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel tile low-rank (TLR) Cholesky factorization.
+///
+/// Performs the Cholesky factorization of a Hermitian positive definite
+/// matrix $A$ whose off-diagonal tiles are numerically low rank,
+/// as arises, e.g., from covariance kernels in geostatistics.
+/// Each off-diagonal tile is compressed to $U V^H$, with its rank chosen
+/// so the truncated singular values are below
+/// Option::LowRankTolerance * $\|A\|_F$, and the factorization operates on
+/// the compressed tiles, recompressing after each update.
+/// Diagonal tiles are kept dense. The dense storage of each compressed
+/// off-diagonal tile is released until its column of the factor is
+/// finished, except for tiles owned by the user (e.g., from ScaLAPACK).
+///
+/// The factorization has the form
+/// \[
+///     A \approx L L^H,
+/// \]
+/// if $A$ is stored lower, or
+/// \[
+///     A \approx U^H U,
+/// \]
+/// if $A$ is stored upper.
+/// On exit, the factor is stored dense in $A$, so potrs can be used to solve.
+///
+/// Complexity (in real): $O( n^2 r )$ flops for tile ranks $r \ll$ nb,
+/// versus $\approx \frac{1}{3} n^{3}$ flops for potrf.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the n-by-n Hermitian positive definite matrix $A$.
+///     On exit, if return value = 0, the approximate factor $U$ or $L$ from
+///     the Cholesky factorization $A \approx U^H U$ or $A \approx L L^H$.
+///     If scalar_t is real, $A$ can be a SymmetricMatrix object.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::LowRankTolerance:
+///       Relative accuracy threshold for compressing off-diagonal tiles.
+///       Default epsilon.
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  same as HostTask.
+///       - HostBatch: same as HostTask.
+///       - Devices:   not yet implemented.
+///
+/// If the leading minor of order $i$ of $A$ is not positive definite,
+/// an Exception giving $i$ is thrown on all ranks. The factorization runs
+/// to completion first, so $A$ is overwritten but the factor is not usable.
+///
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+void potrf_tlr(
+    HermitianMatrix<scalar_t>& A,
+    Options const& opts)
+{
+    using internal::TargetType;
+
+    Target target = get_option( opts, Option::Target, Target::HostTask );
+
+    switch (target) {
+        case Target::Host:
+        case Target::HostNest:
+        case Target::HostBatch:
+        case Target::HostTask:
+            impl::potrf_tlr( TargetType<Target::HostTask>(), A, opts );
+            break;
+
+        case Target::Devices:
+            slate_not_implemented( "potrf_tlr on Devices" );
+            break;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void potrf_tlr<float>(
+    HermitianMatrix<float>& A,
+    Options const& opts);
+
+template
+void potrf_tlr<double>(
+    HermitianMatrix<double>& A,
+    Options const& opts);
+
+template
+void potrf_tlr< std::complex<float> >(
+    HermitianMatrix< std::complex<float> >& A,
+    Options const& opts);
+
+template
+void potrf_tlr< std::complex<double> >(
+    HermitianMatrix< std::complex<double> >& A,
+    Options const& opts);
+
+} // namespace slate
@@ -3,17 +3,126 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "slate/HermitianBandMatrix.hh"
 #include "slate/types.hh"
-#include "slate/Tile_blas.hh"
 #include "slate/Matrix.hh"
 #include "internal/internal.hh"
 
+#include <climits>
+
 namespace slate {
 
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Piece of a row (or column) index range that lies in one block row
+/// (or column) of A and one of B.
+struct Overlap {
+    int64_t a_tile;     ///< block row (col) of A
+    int64_t a_offset;   ///< offset of the piece within that block of A
+    int64_t b_tile;     ///< block row (col) of B
+    int64_t b_offset;   ///< offset of the piece within that block of B
+    int64_t size;
+};
+
+//------------------------------------------------------------------------------
+/// Piece of the matrix, in the intersection of one tile of A and one tile
+/// of B, sent to or received from rank, at offset in that rank's message.
+struct Block {
+    int64_t r;          ///< index in row overlaps
+    int64_t c;          ///< index in col overlaps
+    int rank;
+    int64_t offset;
+};
+
+//------------------------------------------------------------------------------
+/// Intersects two tilings of the same index range, given their tile sizes.
+///
+/// @return the non-empty pieces, in increasing order.
+///
+inline std::vector<Overlap> overlaps(
+    std::vector<int64_t> const& a_sizes,
+    std::vector<int64_t> const& b_sizes)
+{
+    std::vector<Overlap> list;
+    int64_t a_tiles = a_sizes.size();
+    int64_t b_tiles = b_sizes.size();
+    int64_t ia = 0, ib = 0, a_offset = 0, b_offset = 0;
+    while (ia < a_tiles && ib < b_tiles) {
+        int64_t size = std::min( a_sizes[ ia ] - a_offset,
+                                 b_sizes[ ib ] - b_offset );
+        if (size > 0)
+            list.push_back( { ia, a_offset, ib, b_offset, size } );
+        a_offset += size;
+        b_offset += size;
+        if (a_offset == a_sizes[ ia ]) {
+            ++ia;
+            a_offset = 0;
+        }
+        if (b_offset == b_sizes[ ib ]) {
+            ++ib;
+            b_offset = 0;
+        }
+    }
+    return list;
+}
+
+//------------------------------------------------------------------------------
+/// Gets the distance in memory between consecutive rows and consecutive
+/// columns of op(T), taking layout into account.
+///
+template <typename scalar_t>
+void op_strides(Tile<scalar_t> const& T, int64_t& row_inc, int64_t& col_inc)
+{
+    if ((T.op() == Op::NoTrans) == (T.layout() == Layout::ColMajor)) {
+        row_inc = 1;
+        col_inc = T.stride();
+    }
+    else {
+        row_inc = T.stride();
+        col_inc = 1;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Copies the mb-by-nb block a to b, conjugating if requested.
+/// Elements (i, j) are at a[ i*a_row + j*a_col ] and b[ i*b_row + j*b_col ].
+///
+template <typename scalar_t>
+void copy_block(
+    int64_t mb, int64_t nb, bool conjugate,
+    scalar_t const* a, int64_t a_row, int64_t a_col,
+    scalar_t*       b, int64_t b_row, int64_t b_col)
+{
+    using blas::conj;
+    if (conjugate) {
+        for (int64_t j = 0; j < nb; ++j)
+            for (int64_t i = 0; i < mb; ++i)
+                b[ i*b_row + j*b_col ] = conj( a[ i*a_row + j*a_col ] );
+    }
+    else {
+        for (int64_t j = 0; j < nb; ++j)
+            for (int64_t i = 0; i < mb; ++i)
+                b[ i*b_row + j*b_col ] = a[ i*a_row + j*a_col ];
+    }
+}
+
+} // namespace impl
+
 //------------------------------------------------------------------------------
 /// Redistribute a matrix A from one distribution into matrix B with another
-/// distribution.
+/// distribution, so that op(B) = op(A) element-wise.
+/// A and B may have different tile sizes, process grids, layouts, and
+/// transposition (Trans, ConjTrans), like ScaLAPACK's pxgemr2d.
+///
+/// The intersections of A's and B's tilings are computed once. Each rank
+/// packs the pieces it sends to each other rank into one message, and all
+/// messages are exchanged with non-blocking sends and receives, overlapped
+/// with copying the pieces that stay on this rank. Messages are split into
+/// chunks of at most INT_MAX elements, so any matrix size is supported.
+///
+/// Collective over the MPI communicator, which must be the same for A and B.
+/// All local tiles of B must already be inserted.
+/// Data are moved through host memory.
 /// @ingroup copy_internal
 ///
 template <typename scalar_t>
@@ -22,106 +131,197 @@ void redistribute(
     Matrix<scalar_t>& B,
     Options const& opts )
 {
+    using impl::Block;
+    using impl::Overlap;
+    using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
+
     trace::Block trace_block("slate::redistribute");
 
-    int64_t mt = B.mt();
-    int64_t nt = B.nt();
-
-    bool is_conj = false;
-    if (A.op() != B.op()) {
-        if (A.op() == Op::ConjTrans || B.op() == Op::ConjTrans)
-            is_conj = true;
-
-        auto BT = A.emptyLike();
-        for (int64_t j = 0; j < nt; ++j) {
-            for (int64_t i = 0; i < mt; ++i) {
-                if (B.tileIsLocal(i, j)) {
-                    B.tileGetForWriting( i, j, LayoutConvert::None );
-                    if (! A.tileIsLocal(i, j)) {
-                        auto Bij = B(i, j);
-                        if (Bij.mb() == Bij.nb()) {
-                            Bij.recv(A.tileRank(i, j), A.mpiComm(),  A.layout());
-                            B.tileGetForWriting( i, j, LayoutConvert::None );
-                            if (is_conj)
-                                tile::deepConjTranspose( std::move(Bij) );
-                            else
-                                tile::deepTranspose( std::move(Bij) );
-                        }
-                        else {
-                            BT.tileInsert(i, j);
-                            auto BTij = BT(i, j);
-                            BT.tileGetForWriting( i, j, LayoutConvert::None );
-                            BTij.recv(A.tileRank(i, j), A.mpiComm(),  A.layout());
-                            if (is_conj) {
-                                auto AijT = conj_transpose(BTij);
-                                tile::deepConjTranspose( std::move(AijT), std::move(Bij) );
-                            }
-                            else {
-                                auto AijT = transpose(BTij);
-                                tile::deepTranspose( std::move(AijT), std::move(Bij) );
-                            }
-                        }
-                    }
-                    else {
-                        A.tileGetForReading(i, j, LayoutConvert::None);
-                        // copy local tiles if needed.
-                        auto Aij = A(i, j);
-                        auto Bij = B(i, j);
-                        if (Bij.mb() == Bij.nb()) {
-                            if (is_conj)
-                                tile::deepConjTranspose( std::move(Aij), std::move(Bij) );
-                            else
-                                tile::deepTranspose( std::move(Aij), std::move(Bij) );
-                        }
-                        else {
-                            if (is_conj) {
-                                auto AijT = conj_transpose(Aij);
-                                tile::deepConjTranspose( std::move(AijT), std::move(Bij) );
-                            }
-                            else {
-                                auto AijT = transpose(Aij);
-                                tile::deepTranspose( std::move(AijT), std::move(Bij) );
-                            }
-                        }
-                    }
-                }
-                else if (A.tileIsLocal(i, j)) {
-                    A.tileGetForReading(i, j, LayoutConvert::None);
-                    auto Aij = A(i, j);
-                    Aij.send(B.tileRank(i, j), B.mpiComm());
-                }
+    slate_assert( A.m() == B.m() );
+    slate_assert( A.n() == B.n() );
+
+    const int tag_0 = 0;
+
+    MPI_Comm comm = B.mpiComm();
+    int comm_compare;
+    slate_mpi_call(
+        MPI_Comm_compare(A.mpiComm(), comm, &comm_compare));
+    slate_assert( comm_compare == MPI_IDENT || comm_compare == MPI_CONGRUENT );
+    int mpi_rank = B.mpiRank();
+    int mpi_size;
+    slate_mpi_call(
+        MPI_Comm_size(comm, &mpi_size));
+
+    // Intersect the block rows and block cols of op(A) and op(B).
+    std::vector<int64_t> a_sizes( A.mt() ), b_sizes( B.mt() );
+    for (int64_t i = 0; i < A.mt(); ++i)
+        a_sizes[ i ] = A.tileMb( i );
+    for (int64_t i = 0; i < B.mt(); ++i)
+        b_sizes[ i ] = B.tileMb( i );
+    std::vector<Overlap> rows = impl::overlaps( a_sizes, b_sizes );
+
+    a_sizes.resize( A.nt() );
+    b_sizes.resize( B.nt() );
+    for (int64_t j = 0; j < A.nt(); ++j)
+        a_sizes[ j ] = A.tileNb( j );
+    for (int64_t j = 0; j < B.nt(); ++j)
+        b_sizes[ j ] = B.tileNb( j );
+    std::vector<Overlap> cols = impl::overlaps( a_sizes, b_sizes );
+
+    // Pieces are packed column-major, in column-major order of pieces,
+    // which sender and receiver both follow.
+    std::vector<Block> send_blocks, recv_blocks, local_blocks;
+    std::vector<int64_t> send_sizes( mpi_size, 0 ), recv_sizes( mpi_size, 0 );
+    std::set<ij_tuple> A_tiles, B_tiles;
+    int64_t rows_size = rows.size();
+    int64_t cols_size = cols.size();
+    for (int64_t c = 0; c < cols_size; ++c) {
+        for (int64_t r = 0; r < rows_size; ++r) {
+            int64_t ia = rows[ r ].a_tile, ja = cols[ c ].a_tile;
+            int64_t ib = rows[ r ].b_tile, jb = cols[ c ].b_tile;
+            int src = A.tileRank( ia, ja );
+            int dst = B.tileRank( ib, jb );
+            if (src != mpi_rank && dst != mpi_rank)
+                continue;
+
+            int64_t size = rows[ r ].size * cols[ c ].size;
+            if (src == dst) {
+                local_blocks.push_back( { r, c, dst, 0 } );
             }
+            else if (src == mpi_rank) {
+                send_blocks.push_back( { r, c, dst, send_sizes[ dst ] } );
+                send_sizes[ dst ] += size;
+            }
+            else {
+                recv_blocks.push_back( { r, c, src, recv_sizes[ src ] } );
+                recv_sizes[ src ] += size;
+            }
+            if (src == mpi_rank)
+                A_tiles.insert( { ia, ja } );
+            if (dst == mpi_rank)
+                B_tiles.insert( { ib, jb } );
         }
     }
-    else {
-        for (int64_t j = 0; j < nt; ++j) {
-            for (int64_t i = 0; i < mt; ++i) {
-                if (B.tileIsLocal(i, j)) {
-                    B.tileGetForWriting( i, j, LayoutConvert::None );
-                    if (! A.tileIsLocal(i, j)) {
-                        auto Bij = B(i, j);
-                        Bij.recv(A.tileRank(i, j), A.mpiComm(),  A.layout());
-                    }
-                    else {
-                        A.tileGetForReading(i, j, LayoutConvert::None);
-                        // copy local tiles if needed.
-                        auto Aij = A(i, j);
-                        auto Bij = B(i, j);
-                        if (Aij.data() != Bij.data() ) {
-                            tile::gecopy( Aij, Bij );
-                            // deep conj tile after recieve if its square
-                            // if rectangular, recv in a tmp tile then transpose it
-                        }
-                    }
-                }
-                else if (A.tileIsLocal(i, j)) {
-                    A.tileGetForReading(i, j, LayoutConvert::None);
-                    auto Aij = A(i, j);
-                    Aij.send(B.tileRank(i, j), B.mpiComm());
-                }
+
+    std::vector<int64_t> send_displs( mpi_size ), recv_displs( mpi_size );
+    int64_t send_total = 0, recv_total = 0;
+    for (int rank = 0; rank < mpi_size; ++rank) {
+        send_displs[ rank ] = send_total;
+        recv_displs[ rank ] = recv_total;
+        send_total += send_sizes[ rank ];
+        recv_total += recv_sizes[ rank ];
+    }
+
+    A.tileGetForReading( A_tiles, HostNum, LayoutConvert::None );
+    B.tileGetForWriting( B_tiles, HostNum, LayoutConvert::None );
+
+    bool conjugate = (A.op() == Op::ConjTrans) != (B.op() == Op::ConjTrans);
+
+    // Pack pieces for other ranks.
+    std::vector<scalar_t> send_buffer( send_total ), recv_buffer( recv_total );
+    {
+        trace::Block trace_block("redistribute::pack");
+
+        int64_t send_blocks_size = send_blocks.size();
+        #pragma omp parallel for schedule(dynamic, 1)
+        for (int64_t k = 0; k < send_blocks_size; ++k) {
+            Block const& block = send_blocks[ k ];
+            Overlap const& row = rows[ block.r ];
+            Overlap const& col = cols[ block.c ];
+            auto T = A( row.a_tile, col.a_tile );
+            int64_t row_inc, col_inc;
+            impl::op_strides( T, row_inc, col_inc );
+            impl::copy_block(
+                row.size, col.size, conjugate,
+                &T.data()[ row.a_offset*row_inc + col.a_offset*col_inc ],
+                row_inc, col_inc,
+                &send_buffer[ send_displs[ block.rank ] + block.offset ],
+                1, row.size );
+        }
+    }
+
+    // MPI counts are int, so send each message in chunks of at most
+    // INT_MAX elements; MPI keeps chunks between two ranks in order.
+    const int64_t max_count = INT_MAX;
+    std::vector<MPI_Request> requests;
+    for (int rank = 0; rank < mpi_size; ++rank) {
+        for (int64_t k = 0; k < recv_sizes[ rank ]; k += max_count) {
+            int count = std::min( recv_sizes[ rank ] - k, max_count );
+            requests.push_back( MPI_REQUEST_NULL );
+            slate_mpi_call(
+                MPI_Irecv(
+                    recv_buffer.data() + recv_displs[ rank ] + k, count,
+                    mpi_type<scalar_t>::value, rank, tag_0, comm,
+                    &requests.back()));
+        }
+    }
+    for (int rank = 0; rank < mpi_size; ++rank) {
+        for (int64_t k = 0; k < send_sizes[ rank ]; k += max_count) {
+            int count = std::min( send_sizes[ rank ] - k, max_count );
+            requests.push_back( MPI_REQUEST_NULL );
+            slate_mpi_call(
+                MPI_Isend(
+                    send_buffer.data() + send_displs[ rank ] + k, count,
+                    mpi_type<scalar_t>::value, rank, tag_0, comm,
+                    &requests.back()));
+        }
+    }
+
+    // Copy pieces that stay on this rank while messages are in flight.
+    {
+        trace::Block trace_block("redistribute::local");
+
+        int64_t local_blocks_size = local_blocks.size();
+        #pragma omp parallel for schedule(dynamic, 1)
+        for (int64_t k = 0; k < local_blocks_size; ++k) {
+            Block const& block = local_blocks[ k ];
+            Overlap const& row = rows[ block.r ];
+            Overlap const& col = cols[ block.c ];
+            auto TA = A( row.a_tile, col.a_tile );
+            auto TB = B( row.b_tile, col.b_tile );
+            int64_t a_row, a_col, b_row, b_col;
+            impl::op_strides( TA, a_row, a_col );
+            impl::op_strides( TB, b_row, b_col );
+            scalar_t const* a
+                = &TA.data()[ row.a_offset*a_row + col.a_offset*a_col ];
+            scalar_t* b
+                = &TB.data()[ row.b_offset*b_row + col.b_offset*b_col ];
+            // Skip if A and B share this data.
+            if (a != b || a_row != b_row || a_col != b_col || conjugate) {
+                impl::copy_block(
+                    row.size, col.size, conjugate,
+                    a, a_row, a_col, b, b_row, b_col );
             }
         }
     }
+
+    if (! requests.empty()) {
+        trace::Block trace_block("MPI_Waitall");
+        slate_mpi_call(
+            MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE));
+    }
+
+    // Unpack pieces from other ranks.
+    {
+        trace::Block trace_block("redistribute::unpack");
+
+        int64_t recv_blocks_size = recv_blocks.size();
+        #pragma omp parallel for schedule(dynamic, 1)
+        for (int64_t k = 0; k < recv_blocks_size; ++k) {
+            Block const& block = recv_blocks[ k ];
+            Overlap const& row = rows[ block.r ];
+            Overlap const& col = cols[ block.c ];
+            auto T = B( row.b_tile, col.b_tile );
+            int64_t row_inc, col_inc;
+            impl::op_strides( T, row_inc, col_inc );
+            impl::copy_block(
+                row.size, col.size, false,
+                &recv_buffer[ recv_displs[ block.rank ] + block.offset ],
+                1, row.size,
+                &T.data()[ row.b_offset*row_inc + col.b_offset*col_inc ],
+                row_inc, col_inc );
+        }
+    }
 }
 
 //------------------------------------------------------------------------------
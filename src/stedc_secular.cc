@@ -85,7 +85,7 @@ void stedc_secular(
     slate_mpi_call(
         MPI_Comm_size( U.mpiComm(), &mpi_size ) );
 
-    int64_t info = 0, iinfo;
+    int64_t info = 0;
 
     // Assumes matrix is 2D block cyclic.
     GridOrder grid_order;
@@ -106,24 +106,57 @@ void stedc_secular(
     int64_t end     = begin + mycnt;
 
     // ztilde_partial = 1.
+    // For each root j, also save the accurate differences
+    // delta_jj = D[ j ] - Lambda[ j ] and delta_jj1 = D[ j+1 ] - Lambda[ j ]
+    // from laed4, so Phase 2 can form D[ i ] - Lambda[ j ] without
+    // calling laed4 again. Since D[ j ] < Lambda[ j ] < D[ j+1 ],
+    //     D[ i ] - Lambda[ j ] = (D[ i ] - D[ j   ]) + delta_jj   for i <= j,
+    //     D[ i ] - Lambda[ j ] = (D[ i ] - D[ j+1 ]) + delta_jj1  for i >  j,
+    // add terms of the same sign, so there is no cancellation.
+    // Lambda, delta_jj, delta_jj1 are interleaved in Lambda_local
+    // to gather them in one Allgatherv.
     std::vector<real_t> ztilde( nsecular, 1.0 ),
-                        deltaJ( nsecular ),
-                        Lambda_local( nsecular );
-    for (int64_t j = begin; j < end; ++j) {
-        iinfo = lapack::laed4( nsecular, j, &D[ 0 ], &z[ 0 ], &deltaJ[ 0 ],
-                               rho, &Lambda_local[ j ] );
-        if (iinfo != 0)
-            info = j;
+                        Lambda_local( 3*nsecular );
 
-        // Update local partial product ztilde_partial
-        // ztilde_partial *= deltaJ / (d_i - d_j)
-        for (int64_t i = 0; i < j; ++i) {
-            ztilde[ i ] *= deltaJ[ i ] / (D[ i ] - D[ j ]);
+    // Roots are independent; each thread accumulates its own partial
+    // product of ztilde, then they are multiplied together.
+    #pragma omp parallel slate_omp_default_none \
+        shared( D, z, ztilde, Lambda_local, info ) \
+        firstprivate( nsecular, begin, end, rho )
+    {
+        std::vector<real_t> ztilde_thread( nsecular, 1.0 ),
+                            deltaJ( nsecular );
+        int64_t info_thread = 0;
+
+        #pragma omp for schedule( dynamic, 16 )
+        for (int64_t j = begin; j < end; ++j) {
+            int64_t iinfo_j = lapack::laed4(
+                nsecular, j, &D[ 0 ], &z[ 0 ], &deltaJ[ 0 ],
+                rho, &Lambda_local[ 3*j ] );
+            if (iinfo_j != 0)
+                info_thread = j;
+            Lambda_local[ 3*j + 1 ] = deltaJ[ j ];
+            Lambda_local[ 3*j + 2 ] = (j+1 < nsecular ? deltaJ[ j+1 ] : 0);
+
+            // Update local partial product ztilde_partial
+            // ztilde_partial *= deltaJ / (d_i - d_j)
+            real_t Dj = D[ j ];
+            for (int64_t i = 0; i < j; ++i) {
+                ztilde_thread[ i ] *= deltaJ[ i ] / (D[ i ] - Dj);
+            }
+            // for i = j, exclude (d_i - d_j) term in denominator.
+            ztilde_thread[ j ] *= deltaJ[ j ];
+            for (int64_t i = j+1; i < nsecular; ++i) {
+                ztilde_thread[ i ] *= deltaJ[ i ] / (D[ i ] - Dj);
+            }
         }
-        // for i = j, exclude (d_i - d_j) term in denominator.
-        ztilde[ j ] *= deltaJ[ j ];
-        for (int64_t i = j+1; i < nsecular; ++i) {
-            ztilde[ i ] *= deltaJ[ i ] / (D[ i ] - D[ j ]);
+
+        #pragma omp critical( slate_stedc_secular )
+        {
+            for (int64_t i = 0; i < nsecular; ++i) {
+                ztilde[ i ] *= ztilde_thread[ i ];
+            }
+            info = std::max( info, info_thread );
         }
     }
 
@@ -136,16 +169,16 @@ void stedc_secular(
         ztilde[ i ] = copysign( sqrt( -ztilde[ i ] ), z[ i ] );
     }
 
-    // recv_cnts = [ min_cnt+1, .., min_cnt+1, min_cnt, .., min_cnt ]
+    // recv_cnts = 3*[ min_cnt+1, .., min_cnt+1, min_cnt, .., min_cnt ]
     // recv_offsets[ j ] = sum_{i=0, .., j-1} recv_cnts[ i ]
     std::vector<int> recv_cnts( mpi_size ),
                      recv_offsets( mpi_size+1 );
-    std::fill( &recv_cnts[ 0 ], &recv_cnts[ rem ], min_cnt + 1 );
-    std::fill( &recv_cnts[ rem ], &recv_cnts[ mpi_size ], min_cnt );
+    std::fill( &recv_cnts[ 0 ], &recv_cnts[ rem ], 3*(min_cnt + 1) );
+    std::fill( &recv_cnts[ rem ], &recv_cnts[ mpi_size ], 3*min_cnt );
     std::partial_sum( &recv_cnts[ 0 ], &recv_cnts[ mpi_size ],
                       &recv_offsets[ 1 ] );
     slate_mpi_call(
-        MPI_Allgatherv( MPI_IN_PLACE, mycnt, mpi_real_t,
+        MPI_Allgatherv( MPI_IN_PLACE, 3*mycnt, mpi_real_t,
                         &Lambda_local[ 0 ], &recv_cnts[ 0 ], &recv_offsets[ 0 ],
                         mpi_real_t, U.mpiComm() ) );
 
@@ -186,7 +219,7 @@ void stedc_secular(
     for (int64_t j = 0; j < nsecular; ++j) {
         int64_t jq = itype[ j ];
         assert( 0 <= jq && jq < n );
-        Lambda[ jq ] = Lambda_local[ j ];
+        Lambda[ jq ] = Lambda_local[ 3*j ];
         if (pcols[ jq ] == mycol) {
             icol.push_back( j );
         }
@@ -199,46 +232,63 @@ void stedc_secular(
 
     // Compute u vectors.
     // Each rank in processor column computes redundantly in order to get norm.
-    // todo: cache delta_jj terms and compute other deltas from D[i] - Lambda[j],
-    // rather than redundantly calling laed4.
-    for (int64_t jj = 0; jj < col_cnt; ++jj) {
-        int64_t j  = icol[ jj ];
-        int64_t jq = itype[ j ];
-        int64_t jq_tile   = jq / nb;
-        int64_t jq_offset = jq % nb;
+    // Columns are independent, so are computed in parallel by threads.
+    #pragma omp parallel slate_omp_default_none \
+        shared( D, z, ztilde, Lambda_local, U, icol, irow, itype ) \
+        firstprivate( nsecular, n, nb, rho, col_cnt, row_cnt )
+    {
+        std::vector<real_t> deltaJ( nsecular );
 
-        assert( 0 <= j  && j  < n );
-        assert( 0 <= jq && jq < n );
-        assert( 0 <= jq_tile   && jq_tile < U.nt() );
-        assert( 0 <= jq_offset && jq_offset < nb );
+        #pragma omp for schedule( dynamic, 16 )
+        for (int64_t jj = 0; jj < col_cnt; ++jj) {
+            int64_t j  = icol[ jj ];
+            int64_t jq = itype[ j ];
+            int64_t jq_tile   = jq / nb;
+            int64_t jq_offset = jq % nb;
 
-        real_t dummy;
-        iinfo = lapack::laed4( nsecular, j, &D[ 0 ], &z[ 0 ], &deltaJ[ 0 ],
-                               rho, &dummy );
+            assert( 0 <= j  && j  < n );
+            assert( 0 <= jq && jq < n );
+            assert( 0 <= jq_tile   && jq_tile < U.nt() );
+            assert( 0 <= jq_offset && jq_offset < nb );
 
-        real_t nrm;
-        if (nsecular <= 2) {
-            nrm = 1.0;
-        }
-        else {
-            for (int64_t i = 0; i < nsecular; ++i) {
-                deltaJ[ i ] = ztilde[ i ] / deltaJ[ i ];
+            real_t nrm;
+            if (nsecular <= 2) {
+                // laed4 returns eigenvector entries in deltaJ for n <= 2.
+                real_t dummy;
+                lapack::laed4( nsecular, j, &D[ 0 ], &z[ 0 ], &deltaJ[ 0 ],
+                               rho, &dummy );
+                nrm = 1.0;
             }
-            nrm = blas::nrm2( nsecular, &deltaJ[ 0 ], 1 );
-        }
-        for (int64_t ii = 0; ii < row_cnt; ++ii) {
-            int64_t i  = irow[ ii ];
-            int64_t iq = itype[ i ];
-            int64_t iq_tile   = iq / nb;
-            int64_t iq_offset = iq % nb;
+            else {
+                // u_i = ztilde_i / (D_i - Lambda_j), from cached deltas.
+                real_t Dj  = D[ j ];
+                real_t djj = Lambda_local[ 3*j + 1 ];
+                for (int64_t i = 0; i <= j; ++i) {
+                    deltaJ[ i ] = ztilde[ i ] / ((D[ i ] - Dj) + djj);
+                }
+                if (j+1 < nsecular) {
+                    real_t Dj1  = D[ j+1 ];
+                    real_t djj1 = Lambda_local[ 3*j + 2 ];
+                    for (int64_t i = j+1; i < nsecular; ++i) {
+                        deltaJ[ i ] = ztilde[ i ] / ((D[ i ] - Dj1) + djj1);
+                    }
+                }
+                nrm = blas::nrm2( nsecular, &deltaJ[ 0 ], 1 );
+            }
+            for (int64_t ii = 0; ii < row_cnt; ++ii) {
+                int64_t i  = irow[ ii ];
+                int64_t iq = itype[ i ];
+                int64_t iq_tile   = iq / nb;
+                int64_t iq_offset = iq % nb;
 
-            assert( 0 <= i  && i  < n );
-            assert( 0 <= iq && iq < n );
-            assert( 0 <= iq_tile   && iq_tile < U.mt() );
-            assert( 0 <= iq_offset && iq_offset < nb );
+                assert( 0 <= i  && i  < n );
+                assert( 0 <= iq && iq < n );
+                assert( 0 <= iq_tile   && iq_tile < U.mt() );
+                assert( 0 <= iq_offset && iq_offset < nb );
 
-            auto Uij = U( iq_tile, jq_tile );
-            Uij.at( iq_offset, jq_offset ) = deltaJ[ i ] / nrm;
+                auto Uij = U( iq_tile, jq_tile );
+                Uij.at( iq_offset, jq_offset ) = deltaJ[ i ] / nrm;
+            }
         }
     }
 }
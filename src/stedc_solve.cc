@@ -5,6 +5,9 @@
 
 #include "slate/slate.hh"
 
+#include <algorithm>
+#include <tuple>
+
 namespace slate {
 
 namespace internal {
@@ -34,6 +37,115 @@ T next_power2( T x )
     return x;
 }
 
+//------------------------------------------------------------------------------
+/// Merges the eigensystems of two adjacent subproblems, stored in the
+/// diagonal block rows and cols j : j2 of Q, W, and U, using only the ranks
+/// that own tiles of that block.
+///
+/// If that is all ranks, this is stedc_merge on Q.sub( j, j2, j, j2 ).
+/// Otherwise, in the 2D block-cyclic distribution those ranks form a
+/// p_sub-by-q_sub subgrid, with p_sub = min( nblock, p ),
+/// q_sub = min( nblock, q ). A communicator is created for the subgrid and
+/// the merge runs on matrices wrapping the same tiles, so merges on
+/// disjoint subgrids proceed concurrently. Ranks outside the subgrid
+/// return immediately; D is updated only on ranks in the subgrid.
+///
+/// @return global rank of the subgrid's first rank, which has the merged D,
+///         or -1 if the merge used all ranks.
+///
+/// @ingroup heev_computational
+///
+template <typename real_t>
+int stedc_merge_subgrid(
+    int64_t nmerge, int64_t nmerge1,
+    real_t rho,
+    real_t* D,
+    Matrix<real_t>& Q,
+    Matrix<real_t>& W,
+    Matrix<real_t>& U,
+    int64_t j, int64_t j2, int tag,
+    Options const& opts )
+{
+    auto Qsub = Q.sub( j, j2, j, j2 );
+    auto Wsub = W.sub( j, j2, j, j2 );
+    auto Usub = U.sub( j, j2, j, j2 );
+    assert( Qsub.n() == nmerge );
+
+    // Assumes matrix is 2D block cyclic.
+    GridOrder grid_order;
+    int p, q, myrow, mycol;
+    Q.gridinfo( &grid_order, &p, &q, &myrow, &mycol );
+    slate_assert( p > 0 );  // require 2D block-cyclic
+    slate_assert( grid_order == GridOrder::Col );
+
+    int64_t nblock = j2 - j + 1;
+    int p_sub = int( std::min( nblock, int64_t( p ) ) );
+    int q_sub = int( std::min( nblock, int64_t( q ) ) );
+    if (p_sub == p && q_sub == q) {
+        stedc_merge( nmerge, nmerge1, rho, D, Qsub, Wsub, Usub, opts );
+        return -1;
+    }
+
+    // Global ranks of the subgrid, in column-major order.
+    int r0 = Q.tileRank( j, j );
+    int prow0 = r0 % p;  // todo: assumes col-major grid
+    int pcol0 = r0 / p;
+    std::vector<int> ranks( p_sub * q_sub );
+    for (int b = 0; b < q_sub; ++b) {
+        for (int a = 0; a < p_sub; ++a) {
+            ranks[ a + b*p_sub ] = (prow0 + a) % p + ((pcol0 + b) % q) * p;
+        }
+    }
+    int mpi_rank = Q.mpiRank();
+    if (std::find( ranks.begin(), ranks.end(), mpi_rank ) == ranks.end())
+        return ranks[ 0 ];
+
+    MPI_Group group, sub_group;
+    MPI_Comm sub_comm;
+    slate_mpi_call(
+        MPI_Comm_group( Q.mpiComm(), &group ) );
+    slate_mpi_call(
+        MPI_Group_incl( group, ranks.size(), ranks.data(), &sub_group ) );
+    slate_mpi_call(
+        MPI_Comm_create_group( Q.mpiComm(), sub_group, tag, &sub_comm ) );
+
+    {
+        // Matrices on the subgrid, wrapping the local tiles of Q, W, U.
+        int64_t nb = Q.tileNb( 0 );
+        Matrix<real_t> Qg( nmerge, nmerge, nb, nb, GridOrder::Col,
+                           p_sub, q_sub, sub_comm );
+        auto Wg = Qg.emptyLike();
+        auto Ug = Qg.emptyLike();
+        for (int64_t jj = 0; jj < nblock; ++jj) {
+            for (int64_t ii = 0; ii < nblock; ++ii) {
+                if (Qsub.tileIsLocal( ii, jj )) {
+                    assert( Qg.tileIsLocal( ii, jj ) );
+                    Qsub.tileGetForWriting( ii, jj, HostNum, LayoutConvert::ColMajor );
+                    Wsub.tileGetForWriting( ii, jj, HostNum, LayoutConvert::ColMajor );
+                    Usub.tileGetForWriting( ii, jj, HostNum, LayoutConvert::ColMajor );
+                    auto Qij = Qsub( ii, jj );
+                    auto Wij = Wsub( ii, jj );
+                    auto Uij = Usub( ii, jj );
+                    Qg.tileInsert( ii, jj, HostNum, Qij.data(), Qij.stride() );
+                    Wg.tileInsert( ii, jj, HostNum, Wij.data(), Wij.stride() );
+                    Ug.tileInsert( ii, jj, HostNum, Uij.data(), Uij.stride() );
+                }
+            }
+        }
+
+        stedc_merge( nmerge, nmerge1, rho, D, Qg, Wg, Ug, opts );
+    }
+
+    slate_mpi_call(
+        MPI_Comm_free( &sub_comm ) );
+    slate_mpi_call(
+        MPI_Group_free( &sub_group ) );
+    slate_mpi_call(
+        MPI_Group_free( &group ) );
+
+    return ranks[ 0 ];
+}
+
 }  // namespace internal
 
 //------------------------------------------------------------------------------
@@ -210,8 +322,16 @@ void stedc_solve(
     // end =  4; subs = [ (        3           6) (        9              13) ]
     // end =  2; subs = [ (                    6                          13) ]
     // end =  1; done
+    // Merges at the same level whose blocks are smaller than the process
+    // grid run on subgrids (see stedc_merge_subgrid), so disjoint ones
+    // proceed concurrently; the top levels use the full grid.
+    // Afterwards, each subgrid's D segment is shared with all ranks.
     int64_t nblock, nblock1, nmerge1, nmerge, j, j2, jj;
+    std::vector<real_t> D_level( n );
     while (end > 1) {
+        // D segments [ jj, jj + nmerge ) merged on subgrids, with leaders.
+        std::vector< std::tuple<int64_t, int64_t, int> > subgrid_merges;
+
         for (int64_t i = 0; i <= end-2; i += 2) {
             if (i == 0) {
                 nblock  = subs.at( 1 );
@@ -230,18 +350,35 @@ void stedc_solve(
             if (nblock1 > 0) {
                 real_t rho = E[ jj + nmerge1 - 1 ];
                 j2 = j + nblock - 1;
-                auto Qsub = Q.sub( j, j2, j, j2 );
-                auto Wsub = W.sub( j, j2, j, j2 );
-                auto Usub = U.sub( j, j2, j, j2 );
-                assert( Qsub.n() == nmerge );
-
-                stedc_merge( nmerge, nmerge1, rho, &D[ jj ], Qsub, Wsub, Usub,
-                             opts );
+                int leader = internal::stedc_merge_subgrid(
+                    nmerge, nmerge1, rho, &D[ jj ], Q, W, U, j, j2, int( i ),
+                    opts );
+                if (leader >= 0)
+                    subgrid_merges.push_back( { jj, nmerge, leader } );
             }
 
             // Shift: subs[ 0, 1, 2, .., (end-2)/2 ] = subs[ 1, 3, 5, .., end-1 ]
             subs.at( i/2 ) = subs.at( i + 1 );
         }
+
+        if (! subgrid_merges.empty()) {
+            // Each segment is nonzero only on its leader, so the sum is exact.
+            std::fill( D_level.begin(), D_level.end(), 0 );
+            for (auto const& merge : subgrid_merges) {
+                if (std::get<2>( merge ) == mpi_rank) {
+                    std::copy_n( &D[ std::get<0>( merge ) ], std::get<1>( merge ),
+                                 &D_level[ std::get<0>( merge ) ] );
+                }
+            }
+            slate_mpi_call(
+                MPI_Allreduce( MPI_IN_PLACE, &D_level[ 0 ], n,
+                               mpi_type<real_t>::value, MPI_SUM, Q.mpiComm() ) );
+            for (auto const& merge : subgrid_merges) {
+                std::copy_n( &D_level[ std::get<0>( merge ) ], std::get<1>( merge ),
+                             &D[ std::get<0>( merge ) ] );
+            }
+        }
+
         end /= 2;
         subs.resize( end );
     }
@@ -10,6 +10,7 @@
 
 #include <cassert>
 #include <complex>
+#include <cstring>
 
 int* MPI_STATUS_IGNORE;
 
@@ -22,6 +23,33 @@ int MPI_Type_contiguous(int count, MPI_Datatype oldtype, MPI_Datatype* newtype)
     assert(0);
 }
 
+int MPI_Allgather(const void* sendbuf, int sendcount, MPI_Datatype sendtype,
+                  void* recvbuf, int recvcount, MPI_Datatype recvtype,
+                  MPI_Comm comm)
+{
+    assert(sendcount == recvcount);
+    assert(sendtype == recvtype);
+
+    switch (sendtype) {
+        case MPI_BYTE:
+            std::memcpy(recvbuf, sendbuf, sendcount);
+            break;
+        case MPI_INT:
+            std::memcpy(recvbuf, sendbuf, sendcount*sizeof(int));
+            break;
+        default:
+            assert(0);
+    }
+    return MPI_SUCCESS;
+}
+
+int MPI_Allgatherv(const void* sendbuf, int sendcount, MPI_Datatype sendtype,
+                   void* recvbuf, const int recvcounts[], const int displs[],
+                   MPI_Datatype recvtype, MPI_Comm comm)
+{
+    assert(0);
+}
+
 int MPI_Allreduce(const void* sendbuf, void* recvbuf, int count,
                   MPI_Datatype datatype, MPI_Op op, MPI_Comm comm)
 {
@@ -64,6 +92,13 @@ int MPI_Comm_create_group(MPI_Comm comm, MPI_Group group, int tag,
     return MPI_SUCCESS;
 }
 
+int MPI_Comm_compare(MPI_Comm comm1, MPI_Comm comm2, int* result)
+{
+    // Every communicator has the one process.
+    *result = MPI_IDENT;
+    return MPI_SUCCESS;
+}
+
 int MPI_Comm_free(MPI_Comm* comm)
 {
     return MPI_SUCCESS;
@@ -86,6 +121,13 @@ int MPI_Comm_size(MPI_Comm comm, int* size)
     return MPI_SUCCESS;
 }
 
+int MPI_Comm_split_type(MPI_Comm comm, int split_type, int key,
+                        MPI_Info info, MPI_Comm* newcomm)
+{
+    *newcomm = comm;
+    return MPI_SUCCESS;
+}
+
 MPI_Fint MPI_Comm_f2c(MPI_Comm comm)
 {
     assert(0);
@@ -109,6 +151,19 @@ int MPI_Group_translate_ranks(MPI_Group group1, int n, const int ranks1[],
     assert(0);
 }
 
+int MPI_Get(void* origin_addr, int origin_count, MPI_Datatype origin_datatype,
+            int target_rank, MPI_Aint target_disp, int target_count,
+            MPI_Datatype target_datatype, MPI_Win win)
+{
+    assert(0);
+}
+
+int MPI_Get_address(const void* location, MPI_Aint* address)
+{
+    *address = (MPI_Aint) location;
+    return MPI_SUCCESS;
+}
+
 int MPI_Init(int* argc, char*** argv)
 {
     return MPI_SUCCESS;
@@ -126,6 +181,12 @@ int MPI_Init_thread(int* argc, char*** argv, int required, int* provided)
     return MPI_SUCCESS;
 }
 
+int MPI_Query_thread(int* provided)
+{
+    *provided = MPI_THREAD_MULTIPLE;
+    return MPI_SUCCESS;
+}
+
 int MPI_Irecv(void* buf, int count, MPI_Datatype datatype, int source,
               int tag, MPI_Comm comm, MPI_Request* request)
 {
@@ -208,6 +269,11 @@ int MPI_Type_free(MPI_Datatype* datatype)
     assert(0);
 }
 
+int MPI_Type_size(MPI_Datatype datatype, int* size)
+{
+    assert(0);
+}
+
 int MPI_Type_vector(int count, int blocklength, int stride,
                     MPI_Datatype oldtype, MPI_Datatype* newtype)
 {
@@ -224,6 +290,58 @@ int MPI_Waitall(int count, MPI_Request requests[], MPI_Status statuses[])
     assert(0);
 }
 
+int MPI_Win_allocate_shared(MPI_Aint size, int disp_unit, MPI_Info info,
+                            MPI_Comm comm, void* baseptr, MPI_Win* win)
+{
+    assert(0);
+}
+
+int MPI_Win_shared_query(MPI_Win win, int rank, MPI_Aint* size,
+                         int* disp_unit, void* baseptr)
+{
+    assert(0);
+}
+
+int MPI_Win_create_dynamic(MPI_Info info, MPI_Comm comm, MPI_Win* win)
+{
+    return MPI_SUCCESS;
+}
+
+int MPI_Win_attach(MPI_Win win, void* base, MPI_Aint size)
+{
+    return MPI_SUCCESS;
+}
+
+int MPI_Win_detach(MPI_Win win, const void* base)
+{
+    return MPI_SUCCESS;
+}
+
+int MPI_Win_flush(int rank, MPI_Win win)
+{
+    assert(0);
+}
+
+int MPI_Win_free(MPI_Win* win)
+{
+    return MPI_SUCCESS;
+}
+
+int MPI_Win_lock_all(int mode, MPI_Win win)
+{
+    return MPI_SUCCESS;
+}
+
+int MPI_Win_unlock_all(MPI_Win win)
+{
+    return MPI_SUCCESS;
+}
+
+int MPI_Win_sync(MPI_Win win)
+{
+    assert(0);
+}
+
 int MPI_Error_string(int errorcode, char* string, int* resultlen)
 {
     assert(0);
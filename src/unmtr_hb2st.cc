@@ -91,7 +91,11 @@ void unmtr_hb2st(
 /// @param[in,out] C
 ///     On entry, the m-by-n matrix $C$.
 ///     On exit, $C$ is overwritten by $Q C$, $Q^H C$, $C Q$, or $C Q^H$.
-///     C must be distributed 1D block column (cyclic or non-cyclic).
+///     C may have any distribution. If each block column of C is on one
+///     rank (1D block column, cyclic or non-cyclic), reflector blocks are
+///     applied in parallel, on devices for Target::Devices. Otherwise,
+///     e.g., 2D block cyclic, ranks owning adjacent block rows exchange
+///     partial products V^H C, and computation is on the host.
 ///
 /// @param[in] opts
 ///     Additional options, as map of name = value pairs. Possible options:
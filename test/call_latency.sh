@@ -0,0 +1,39 @@
+#!/bin/sh
+#
+# Measures the latency of small and medium calls, repeated many times,
+# e.g., a loop of thousands of mid-size solves, where per-call setup
+# (parallel regions, panel thread teams) is a visible share of the time.
+#
+# Usage (from the test directory):
+#     ./call_latency.sh
+#     mpirun="srun" np=4 grid=2x2 dims="64 256" ./call_latency.sh
+#
+# Environment:
+#     mpirun    MPI launcher; default "mpirun -n".
+#     np        number of ranks; grid p x q must have p*q = np.
+#     dims      space-separated square dimensions.
+#     repeat    calls of each routine and size; the first includes warm-up.
+#     routines  tester routines.
+#     nb, type, target, grid: tester parameters.
+#
+# Compare the time column of the later repetitions between builds,
+# e.g., before and after a change to the runtime.
+
+mpirun=${mpirun:-"mpirun -n"}
+np=${np:-1}
+grid=${grid:-1x1}
+dims=${dims:-"32 64 128 256 512 1024"}
+repeat=${repeat:-20}
+routines=${routines:-"getrf geqrf potrf gesv posv"}
+nb=${nb:-64}
+type=${type:-d}
+target=${target:-t}
+dim=$(echo ${dims} | tr ' ' ',')
+
+for routine in ${routines}; do
+    set -x
+    ${mpirun} ${np} ./tester --grid ${grid} --dim ${dim} --nb ${nb} \
+        --type ${type} --target ${target} --check n --ref n \
+        --repeat ${repeat} ${routine}
+    set +x
+done
@@ -0,0 +1,49 @@
+#!/bin/sh
+#
+# Compares tile reduction plans in gemmA on tall-skinny shapes,
+# C (m-by-n) = A (m-by-k) B (k-by-n) with small m, n and large k,
+# where the cost of gemmA is dominated by reducing C across each row of ranks.
+#
+# Usage (from the test directory):
+#     ./gemmA_reduce.sh
+#     mpirun="srun" grids="1x16 2x32" dims="512x512x1000000" ./gemmA_reduce.sh
+#
+# Environment:
+#     mpirun    MPI launcher; default "mpirun -n".
+#     grids     space-separated p x q grids; the launcher gets p*q ranks.
+#     dims      space-separated m x n x k dimensions.
+#     radix     comma-separated reduction tree radices.
+#     segment   comma-separated segment sizes in elements; 0 = whole tiles.
+#     nb, type, target: tester parameters.
+#
+# Each grid and dim runs the plans with scatter and node-aware off and on.
+# Compare the gflop/s column against the default plan (radix 2, segment 0).
+
+mpirun=${mpirun:-"mpirun -n"}
+grids=${grids:-"1x4 1x8 2x8"}
+dims=${dims:-"256x256x200000 1024x1024x200000"}
+radix=${radix:-"2,4,8"}
+segment=${segment:-"0,16384,65536"}
+nb=${nb:-256}
+type=${type:-d}
+target=${target:-t}
+
+for grid in ${grids}; do
+    p=${grid%x*}
+    q=${grid#*x}
+    np=$(( p * q ))
+
+    for dim in ${dims}; do
+        for scatter in n y; do
+            for node_aware in n y; do
+                set -x
+                ${mpirun} ${np} ./tester --grid ${grid} --dim ${dim} \
+                    --nb ${nb} --type ${type} --target ${target} \
+                    --check n --ref n \
+                    --radix ${radix} --segment ${segment} \
+                    --scatter ${scatter} --node-aware ${node_aware} gemmA
+                set +x
+            done
+        done
+    done
+done
@@ -0,0 +1,39 @@
+#!/bin/sh
+#
+# Strong-scaling comparison of LU pivoting methods, PartialPiv vs. CALU
+# (tournament pivoting with each tree shape), over p-by-q grids.
+#
+# Usage (from the test directory):
+#     ./lu_scaling.sh
+#     mpirun="srun" dim=40000 grids="1x1 2x2 4x4 8x8" ./lu_scaling.sh
+#
+# Environment:
+#     mpirun    MPI launcher; default "mpirun -n".
+#     grids     space-separated p x q grids; the launcher gets p*q ranks.
+#     dim, nb, type, target, trees: tester parameters.
+#
+# Compare the gflop/s column across grids; CALU's advantage grows with p,
+# the number of ranks in each panel.
+
+mpirun=${mpirun:-"mpirun -n"}
+grids=${grids:-"1x1 1x2 2x2 2x4 4x4"}
+dim=${dim:-10000}
+nb=${nb:-256}
+type=${type:-d}
+target=${target:-t}
+trees=${trees:-"binary,flat,hybrid"}
+
+for grid in ${grids}; do
+    p=${grid%x*}
+    q=${grid#*x}
+    np=$(( p * q ))
+
+    set -x
+    ${mpirun} ${np} ./tester --grid ${grid} --dim ${dim} --nb ${nb} \
+        --type ${type} --target ${target} --check n --ref n \
+        --lu PartialPiv getrf
+    ${mpirun} ${np} ./tester --grid ${grid} --dim ${dim} --nb ${nb} \
+        --type ${type} --target ${target} --check n --ref n \
+        --lu CALU --tree ${trees} getrf
+    set +x
+done
@@ -0,0 +1,52 @@
+#!/bin/sh
+#
+# Measures redistribute throughput between block sizes and grids,
+# e.g., nb = 512 on a 2D grid for factorizations and nb = 64 for an
+# application, or the 2D <-> 1D round trips in heev and svd.
+#
+# Usage (from the test directory):
+#     ./redistribute.sh
+#     mpirun="srun" grids="4x4:1x16 8x8:1x64" dims="40000" ./redistribute.sh
+#
+# Environment:
+#     mpirun    MPI launcher; default "mpirun -n".
+#     grids     space-separated source:target p x q grid pairs;
+#               the launcher gets the larger number of ranks.
+#     dims      space-separated m x n dimensions.
+#     nb        source block size.
+#     nb2       comma-separated target block sizes.
+#     trans     comma-separated transpositions of the source (n, t, c).
+#     type, origin: tester parameters.
+#
+# The first time and gbyte/s columns are A -> B, the second B -> A;
+# gbyte/s counts the matrix size once.
+
+mpirun=${mpirun:-"mpirun -n"}
+grids=${grids:-"2x2:1x4 2x4:1x8 2x4:4x2"}
+dims=${dims:-"10000 20000 40000x4000"}
+nb=${nb:-512}
+nb2=${nb2:-"64,512,1000"}
+trans=${trans:-"n,t"}
+type=${type:-d}
+origin=${origin:-h}
+dim=$(echo ${dims} | tr ' ' ',')
+
+for pair in ${grids}; do
+    grid=${pair%:*}
+    grid2=${pair#*:}
+    p=${grid%x*}
+    q=${grid#*x}
+    p2=${grid2%x*}
+    q2=${grid2#*x}
+    np=$(( p * q ))
+    np2=$(( p2 * q2 ))
+    if [ ${np2} -gt ${np} ]; then
+        np=${np2}
+    fi
+
+    set -x
+    ${mpirun} ${np} ./tester --grid ${grid} --grid2 ${grid2} \
+        --dim ${dim} --nb ${nb} --nb2 ${nb2} --trans ${trans} \
+        --type ${type} --origin ${origin} --check y redistribute
+    set +x
+done
@@ -330,6 +330,7 @@ def filter_csv( values, csv ):
 dtype_real    = ' --type ' + filter_csv( ('s', 'd'), opts.type )
 dtype_complex = ' --type ' + filter_csv( ('c', 'z'), opts.type )
 dtype_double  = ' --type ' + filter_csv( ('d', 'z'), opts.type )
+dtype_d       = ' --type ' + filter_csv( ('d',), opts.type )
 
 trans_nt = ' --trans ' + filter_csv( ('n', 't'), opts.trans )
 trans_nc = ' --trans ' + filter_csv( ('n', 'c'), opts.trans )
@@ -348,7 +349,14 @@ if (opts.blas3):
 
     [ 'gemm',  gen + dtype + la + transA + transB + mnk + ab + matrixBC ],
     [ 'gemmA', gen + dtype + la + transA + transB + mnk + ab + matrixBC ],
+    [ 'gemmA', gen + dtype + la + mnk + ' --radix 2,3,4 --segment 0,100' ],
+    [ 'gemmA', gen + dtype + la + mnk + ' --radix 2,4 --segment 0,100 --scatter y --node-aware y' ],
     [ 'gemmC', gen + dtype + la + transA + transB + mnk + ab + matrixBC ],
+    [ 'gemmC', gen + dtype + la + mnk + ' --node-ws 0,4,100' ],
+    [ 'gemmC', gen + dtype_real + la + transA + transB + mnk + ' --packed n,y' ],
+    [ 'gemm',  gen + dtype + la + transA + transB + mnk + ab + ' --method-gemm S --depth 0,1,2' ],
+    [ 'gemm',  gen + dtype_complex + la + transA + transB + mnk + ab + ' --cgemm n,4,3' ],
+    [ 'gemm',  gen + dtype_d + la + transA + transB + mnk + ab + ' --ozaki 0,4,8,9' ],
 
     [ 'hemm',  gen + dtype         + la + side + uplo     + mn + ab + matrixBC ],
     # todo: hemmA GPU support
@@ -359,9 +367,11 @@ if (opts.blas3):
 
     [ 'herk',  gen + dtype_real    + la + uplo + trans    + mn + ab + matrixC ],
     [ 'herk',  gen + dtype_complex + la + uplo + trans_nc + mn + ab + matrixC ],
+    [ 'herk',  gen + dtype_complex + la + uplo + trans_nc + mn + ab + ' --cgemm 4,3' ],
 
     [ 'her2k', gen + dtype_real    + la + uplo + trans    + mn + ab + matrixBC ],
     [ 'her2k', gen + dtype_complex + la + uplo + trans_nc + mn + ab + matrixBC ],
+    [ 'her2k', gen + dtype_complex + la + uplo + trans_nc + mn + ab + ' --cgemm 4,3' ],
 
     [ 'symm',  gen + dtype         + la + side + uplo     + mn + ab + matrixBC ],
 
@@ -385,13 +395,14 @@ if (opts.blas3):
 if (opts.lu):
     cmds += [
     [ 'gesv',         gen + dtype + la + n + thresh ],
-    [ 'gesv_tntpiv',  gen + dtype + la + n ],
+    [ 'gesv_tntpiv',  gen + dtype + la + n + ' --tree b,f,h' ],
     [ 'gesv_nopiv',   gen + dtype + la + n
                       + ' --matrix rand_dominant --nonuniform_nb n' ],
 
     # todo: mn
     [ 'getrf',        gen + dtype + la + n + thresh ],
-    [ 'getrf_tntpiv', gen + dtype + la + n ],
+    [ 'getrf',        gen + dtype_d + la + n + ' --ozaki 8' ],
+    [ 'getrf_tntpiv', gen + dtype + la + n + ' --tree b,f,h' ],
     [ 'getrf_nopiv',  gen + dtype + la + n
                       + ' --matrix rand_dominant --nonuniform_nb n' ],
 
@@ -412,6 +423,7 @@ if (opts.lu):
 if (opts.lu_band):
     cmds += [
     [ 'gbsv',  gen + dtype + la + n  + kl + ku ],
+    [ 'gbsv',  gen + dtype + la + n  + kl + ku + ' --method-band spike' ],
     [ 'gbtrf', gen + dtype + la + n  + kl + ku ],  # todo: mn
     [ 'gbtrs', gen + dtype + la + n  + kl + ku + trans ],
     #[ 'gbrfs', gen + dtype + la + n  + kl + ku + trans ],
@@ -423,6 +435,8 @@ if (opts.chol):
     cmds += [
     [ 'posv',  gen + dtype + la + n + uplo ],
     [ 'potrf', gen + dtype + la + n + uplo + ddist ],
+    [ 'potrf', gen + dtype_d + la + n + uplo + ' --ozaki 8' ],
+    [ 'potrf_tlr', gen + dtype + la + n + uplo ],
     [ 'potrs', gen + dtype + la + n + uplo ],
     [ 'potri', gen + dtype + la + n + uplo ],
     #[ 'porfs', gen + dtype + la + n + uplo ],
@@ -436,6 +450,7 @@ if (opts.chol):
 if (opts.chol):
     cmds += [
     [ 'pbsv',  gen + dtype + la + n + kd + uplo ],
+    [ 'pbsv',  gen + dtype + la + n + kd + uplo + ' --method-band spike' ],
     [ 'pbtrf', gen + dtype + la + n + kd + uplo ],
     [ 'pbtrs', gen + dtype + la + n + kd + uplo ],
     #[ 'pbrfs', gen + dtype + la + n + kd + uplo ],
@@ -610,9 +625,11 @@ if (opts.norms):
 if (opts.cond):
     cmds += [
     [ 'gecondest', gen + dtype + n ],
+    [ 'gecondest', gen + dtype + n + ' --est-cols 1,2,4' ],
 
     # Triangle
     [ 'trcondest', gen + dtype + n ],
+    [ 'trcondest', gen + dtype + n + ' --est-cols 1,2,4' ],
 
     #[ 'gbcon', gen + dtype + la + n  + kl + ku ],
     #[ 'pocon', gen + dtype + la + n + uplo ],
@@ -634,6 +651,8 @@ if (opts.aux):
     [ 'sycopy', gen + dtype + n       + uplo ],
     [ 'hecopy', gen + dtype + n       + uplo ],
 
+    [ 'redistribute', gen + dtype + mn + trans + ' --nb 32 --nb2 32,17,100' ],
+
     [ 'scale',   gen + dtype + mn + ab        ],
     [ 'tzscale', gen + dtype + mn + ab + uplo ],
     [ 'trscale', gen + dtype + n  + ab + uplo ],
@@ -23,6 +23,8 @@ using testsweeper::ansi_bold;
 using testsweeper::ansi_red;
 using testsweeper::ansi_normal;
 
+using slate::MethodBand::methodBand2str;
+using slate::MethodBand::str2methodBand;
 using slate::MethodCholQR::methodCholQR2str;
 using slate::MethodCholQR::str2methodCholQR;
 using slate::MethodGels::methodGels2str;
@@ -147,6 +149,7 @@ std::vector< testsweeper::routines_t > routines = {
     { "",                   nullptr,           Section::newline },
 
     { "potrf",              test_posv,         Section::posv },
+    { "potrf_tlr",          test_posv,         Section::posv },
     { "pbtrf",              test_pbsv,         Section::posv },
     { "",                   nullptr,           Section::newline },
 
@@ -269,6 +272,12 @@ std::vector< testsweeper::routines_t > routines = {
     { "headd",              test_add,          Section::aux },
     { "",                   nullptr,           Section::newline },
 
+    { "gemm_batch",         test_batch,        Section::aux },
+    { "posv_batch",         test_batch,        Section::aux },
+    { "gesv_batch",         test_batch,        Section::aux },
+    { "geqrf_batch",        test_batch,        Section::aux },
+    { "",                   nullptr,           Section::newline },
+
     { "copy",               test_copy,         Section::aux },
     { "tzcopy",             test_copy,         Section::aux },
     { "trcopy",             test_copy,         Section::aux },
@@ -276,6 +285,9 @@ std::vector< testsweeper::routines_t > routines = {
     { "hecopy",             test_copy,         Section::aux },
     { "",                   nullptr,           Section::newline },
 
+    { "redistribute",       test_redistribute, Section::aux },
+    { "",                   nullptr,           Section::newline },
+
     { "scale",              test_scale,        Section::aux },
     { "tzscale",            test_scale,        Section::aux },
     { "trscale",            test_scale,        Section::aux },
@@ -311,6 +323,7 @@ Params::Params():
     hold_local_workspace("hold-local-workspace", 0, ParamType::Value, 'n', "ny",  "do not erase tiles in local workspace"),
     trace     ("trace",   0,    ParamType::Value, 'n', "ny",  "enable/disable traces"),
     trace_scale("trace-scale", 0, 0, ParamType::Value, 1000, 1e-3, 1e6, "horizontal scale for traces, in pixels per sec"),
+    dry_run   ("dry-run", 0,    ParamType::Value, 'n', "ny",  "count flops, messages, and host tiles without computing or communicating; implies check=n, ref=n"),
 
     //         name,      w, p, type,         default, min,  max, help
     tol       ("tol",     0, 0, ParamType::Value,  50,   1, 1000, "tolerance (e.g., error < tol*epsilon to pass)"),
@@ -346,10 +359,11 @@ Params::Params():
     origin    ("origin",  6,    ParamType::List, slate::Origin::Host,     str2origin,   origin2str,   "origin: h=Host, s=ScaLAPACK, d=Devices"),
     target    ("target",  6,    ParamType::List, slate::Target::HostTask, str2target,   target2str,   "target: t=HostTask, n=HostNest, b=HostBatch, d=Devices"),
 
+    method_band   ("band",   5, ParamType::List, slate::MethodBand::Tiled, str2methodBand, methodBand2str, "tiled, spike"),
     method_cholQR ("cholQR", 6, ParamType::List, 0, str2methodCholQR, methodCholQR2str, "auto=auto, herkC, gemmA, gemmC"),
     method_eig    ("eig",    3, ParamType::List, slate::MethodEig::DC, str2methodEig, methodEig2str, "qr=QR iteration, dc=Divide and Conquer"),
     method_gels   ("gels",   6, ParamType::List, 0, str2methodGels,   methodGels2str,   "auto=auto, qr, cholqr"),
-    method_gemm   ("gemm",   4, ParamType::List, 0, str2methodGemm,   methodGemm2str,   "auto=auto, A=gemmA, C=gemmC"),
+    method_gemm   ("gemm",   4, ParamType::List, 0, str2methodGemm,   methodGemm2str,   "auto=auto, A=gemmA, C=gemmC, S=Strassen"),
     method_hemm   ("hemm",   4, ParamType::List, 0, str2methodHemm,   methodHemm2str,   "auto=auto, A=hemmA, C=hemmC"),
     method_lu     ("lu",     5, ParamType::List, slate::MethodLU::PartialPiv, str2methodLU, methodLU2str, "PartialPiv, CALU, NoPiv"),
     method_trsm   ("trsm",   4, ParamType::List, 0, str2methodTrsm,   methodTrsm2str,   "auto=auto, A=trsmA, B=trsmB"),
@@ -357,6 +371,8 @@ Params::Params():
     grid_order("go",      3, ParamType::List, slate::GridOrder::Col,   str2grid_order, grid_order2str, "(go) MPI grid order: c=Col, r=Row"),
     tile_release_strategy ("trs", 3, ParamType::List, slate::TileReleaseStrategy::All, str2tile_release_strategy,   tile_release_strategy2str,   "tile release strategy: n=none, i=only internal routines, s=only top-level routines in slate namespace, a=all routines"),
     dev_dist  ("dev-dist",9,    ParamType::List, slate::Dist::Col,        str2dist,     dist2str,     "matrix tiles distribution across local devices (one-dimensional block-cyclic): col=column, row=row"),
+    pivot_tree("tree",    6,    ParamType::List, slate::PivotTree::Hybrid, str2pivot_tree, pivot_tree2str, "tournament tree in CALU: b=binary, f=flat, h=hybrid (flat in node, binary across nodes)"),
+    complex_gemm("cgemm", 6,    ParamType::List, slate::ComplexGemm::Native, str2complex_gemm, complex_gemm2str, "complex tile multiply in HostTask gemm, herk, her2k: n=native, 4=4M, 3=3M (real gemms on split parts)"),
 
     //         name,      w,    type,            default,                 char2enum,         enum2char,         enum2str,         help
     layout    ("layout",  6,    ParamType::List, slate::Layout::ColMajor, blas::char2layout, blas::layout2char, blas::layout2str, "layout: r=row major, c=column major"),
@@ -393,17 +409,29 @@ Params::Params():
     incx      ("incx",    4,    ParamType::List,   1, -1000,    1000, "stride of x vector"),
     incy      ("incy",    4,    ParamType::List,   1, -1000,    1000, "stride of y vector"),
     itype     ("itype",   5,    ParamType::List,   1,     1,       3, "generalized eigenvalue problem type (1:Ax=lBx, 2:ABx=lx 3:BAx=lx)"),
+    batch     ("batch",   6,    ParamType::List, 1000,     0, 1000000000, "number of problems in batch"),
 
     // SLATE options
     nb        ("nb",      4,    ParamType::List, 384,     0, 1000000, "block size"),
     ib        ("ib",      2,    ParamType::List, 32,      0, 1000000, "inner blocking"),
     grid      ("grid",    3,    ParamType::List, "1x1",   0, 1000000, "MPI grid p x q dimensions"),
+    nb2       ("nb2",     4,    ParamType::List, 0,       0, 1000000, "block size of redistribute target; 0 = nb"),
+    grid2     ("grid2",   3,    ParamType::List, "0x0",   0, 1000000, "MPI grid p x q of redistribute target; 0x0 = grid"),
     lookahead ("la",      2,    ParamType::List, 1,       0, 1000000, "(la) number of lookahead panels"),
     panel_threads("pt",   2,    ParamType::List, std::max( omp_get_max_threads() / 2, 1 ),
                                                           0, 1000000, "(pt) max number of threads used in panel; default omp_num_threads / 2"),
     align     ("align",   5,    ParamType::List,  32,     1,    1024, "column alignment (sets lda, ldb, etc. to multiple of align)"),
     nonuniform_nb("nonuniform_nb",
                           0,    ParamType::Value, 'n', "ny", "generate matrix with nonuniform tile sizes"),
+    reduce_radix("radix", 5,    ParamType::List, 2,       2,    1024, "radix of tile reduction trees in gemmA, hemmA"),
+    reduce_segment("segment", 7, ParamType::List, 0,      0, 1000000000, "pipeline tile reductions in segments of this many elements; 0 = whole tiles"),
+    reduce_scatter("scatter", 0, ParamType::Value, 'n', "ny", "rotate tile reduction roots (reduce-scatter) in gemmA, hemmA"),
+    reduce_node_aware("node-aware", 0, ParamType::Value, 'n', "ny", "two-level (in node, across nodes) tile reduction trees in gemmA, hemmA"),
+    packed_gemm("packed", 6, ParamType::List, 'n', "ny", "pack shared A and B tiles once per update in HostTask gemm (Intel MKL, real precisions)"),
+    strassen_depth("depth", 5, ParamType::List, 1,     0,      16, "levels of recursion in Strassen gemm (--method-gemm S)"),
+    ozaki_slices("ozaki", 5, ParamType::List, 0,       0,      64, "slices to emulate double-precision gemm with single-precision gemm (HostTask, double); 0 = native"),
+    cond_est_columns("est-cols", 8, ParamType::List, 2, 1, 1000000, "columns t in block 1-norm estimator of gecondest, trcondest; 1 = single vector (LAPACK lacn2)"),
+    node_workspace("node-ws", 7, ParamType::List, 0,   0, 1000000, "tiles per rank of node-shared memory for broadcasts; 0 = none"),
     debug     ("debug",   0,    ParamType::Value, -1,     0, 1000000,
                "given rank waits for debugger (gdb/lldb) to attach"),
     pivot_threshold(
@@ -434,6 +462,8 @@ Params::Params():
     gflops    ("gflop/s",      12, 3, ParamType::Output, no_data_flag,   0,   0, "Gflop/s rate"),
     time2     ("time (s)",      9, 3, ParamType::Output, no_data_flag,   0,   0, "extra timer"),
     gflops2   ("gflop/s",      12, 3, ParamType::Output, no_data_flag,   0,   0, "Gflop/s rate"),
+    gbytes    ("gbyte/s",      12, 3, ParamType::Output, no_data_flag,   0,   0, "Gbyte/s rate"),
+    gbytes2   ("gbyte/s",      12, 3, ParamType::Output, no_data_flag,   0,   0, "Gbyte/s rate"),
     time3     ("time (s)",      9, 3, ParamType::Output, no_data_flag,   0,   0, "extra timer"),
     time4     ("time (s)",      9, 3, ParamType::Output, no_data_flag,   0,   0, "extra timer"),
     time5     ("time (s)",      9, 3, ParamType::Output, no_data_flag,   0,   0, "extra timer"),
@@ -459,6 +489,7 @@ Params::Params():
     grid_order.name("go", "grid-order");
 
     // Change name for the methods to use less space in the stdout
+    method_band.name("band", "method-band");
     method_cholQR.name("cholQR", "method-cholQR");
     method_eig.name("eig", "method-eig");
     method_gels.name("gels", "method-gels");
@@ -492,6 +523,7 @@ Params::Params():
     ref();
     trace();
     trace_scale();
+    dry_run();
     tol();
     repeat();
     verbose();
@@ -692,7 +724,11 @@ int run(int argc, char** argv)
         // to mark any new fields as used (e.g., timers).
         test_routine( params, false );
 
-        slate_assert(params.grid.m() * params.grid.n() == mpi_size);
+        // A dry run can size a grid with more ranks than are launched.
+        if (params.dry_run() == 'y')
+            slate_assert(params.grid.m() * params.grid.n() >= mpi_size);
+        else
+            slate_assert(params.grid.m() * params.grid.n() == mpi_size);
 
         slate::trace::Trace::pixels_per_second(params.trace_scale());
 
@@ -717,6 +753,13 @@ int run(int argc, char** argv)
         }
         slate_mpi_call( MPI_Barrier( MPI_COMM_WORLD ) );
 
+        // A dry run produces no results to check.
+        bool dry_run = params.dry_run() == 'y';
+        if (dry_run) {
+            params.check() = 'n';
+            params.ref() = 'n';
+        }
+
         // run tests
         int repeat = params.repeat();
         testsweeper::DataType last_datatype = params.datatype();
@@ -732,11 +775,14 @@ int run(int argc, char** argv)
 
             for (int iter = 0; iter < repeat; ++iter) {
                 try {
+                    if (dry_run)
+                        slate::DryRun::on();
                     test_routine(params, true);
                 }
                 catch (const std::exception& ex) {
                     msg = ex.what();
                 }
+                slate::DryRun::off();
                 int err = print_reduce_error(msg, mpi_rank, MPI_COMM_WORLD);
                 if (err)
                     params.okay() = false;
@@ -744,6 +790,8 @@ int run(int argc, char** argv)
                     params.print();
                     fflush(stdout);
                 }
+                if (dry_run)
+                    slate::DryRun::print(MPI_COMM_WORLD);
                 status += ! params.okay();
                 params.reset_output();
                 msg.clear();
@@ -56,6 +56,7 @@ public:
     testsweeper::ParamChar   hold_local_workspace;
     testsweeper::ParamChar   trace;
     testsweeper::ParamDouble trace_scale;
+    testsweeper::ParamChar   dry_run;
     testsweeper::ParamDouble tol;
     testsweeper::ParamInt    repeat;
     testsweeper::ParamInt    verbose;
@@ -79,6 +80,7 @@ public:
     testsweeper::ParamEnum< slate::Origin >         origin;
     testsweeper::ParamEnum< slate::Target >         target;
 
+    testsweeper::ParamEnum< slate::Method >         method_band;
     testsweeper::ParamEnum< slate::Method >         method_cholQR;
     testsweeper::ParamEnum< slate::MethodEig >      method_eig;
     testsweeper::ParamEnum< slate::Method >         method_gels;
@@ -90,6 +92,8 @@ public:
     testsweeper::ParamEnum< slate::GridOrder >      grid_order;
     testsweeper::ParamEnum< slate::TileReleaseStrategy > tile_release_strategy;
     testsweeper::ParamEnum< slate::Dist >           dev_dist;
+    testsweeper::ParamEnum< slate::PivotTree >      pivot_tree;
+    testsweeper::ParamEnum< slate::ComplexGemm >    complex_gemm;
 
     // ----- test matrix parameters
     MatrixParams matrix;
@@ -129,15 +133,27 @@ public:
     testsweeper::ParamInt    incx;
     testsweeper::ParamInt    incy;
     testsweeper::ParamInt    itype;
+    testsweeper::ParamInt    batch;
 
     // SLATE options
     testsweeper::ParamInt    nb;
     testsweeper::ParamInt    ib;
     testsweeper::ParamInt3   grid;  // p x q
+    testsweeper::ParamInt    nb2;   // redistribute target
+    testsweeper::ParamInt3   grid2; // redistribute target p x q
     testsweeper::ParamInt    lookahead;
     testsweeper::ParamInt    panel_threads;
     testsweeper::ParamInt    align;
     testsweeper::ParamChar   nonuniform_nb;
+    testsweeper::ParamInt    reduce_radix;
+    testsweeper::ParamInt    reduce_segment;
+    testsweeper::ParamChar   reduce_scatter;
+    testsweeper::ParamChar   reduce_node_aware;
+    testsweeper::ParamChar   packed_gemm;
+    testsweeper::ParamInt    strassen_depth;
+    testsweeper::ParamInt    ozaki_slices;
+    testsweeper::ParamInt    cond_est_columns;
+    testsweeper::ParamInt    node_workspace;
     testsweeper::ParamInt    debug;
     testsweeper::ParamDouble pivot_threshold;
     testsweeper::ParamString deflate;
@@ -160,6 +176,8 @@ public:
     testsweeper::ParamDouble     gflops;
     testsweeper::ParamDouble     time2;
     testsweeper::ParamDouble     gflops2;
+    testsweeper::ParamDouble     gbytes;
+    testsweeper::ParamDouble     gbytes2;
     testsweeper::ParamDouble     time3;
     testsweeper::ParamDouble     time4;
     testsweeper::ParamDouble     time5;
@@ -274,7 +292,9 @@ void test_trnorm (Params& params, bool run);
 
 // auxiliary matrix routines
 void test_add    (Params& params, bool run);
+void test_batch  (Params& params, bool run);
 void test_copy   (Params& params, bool run);
+void test_redistribute(Params& params, bool run);
 void test_scale  (Params& params, bool run);
 void test_scale_row_col(Params& params, bool run);
 void test_set    (Params& params, bool run);
@@ -452,6 +472,56 @@ inline const char* tile_release_strategy2str(slate::TileReleaseStrategy tile_rel
     return "?";
 }
 
+// -----------------------------------------------------------------------------
+inline slate::PivotTree str2pivot_tree(const char* tree)
+{
+    std::string tree_ = tree;
+    std::transform(tree_.begin(), tree_.end(), tree_.begin(), ::tolower);
+    if (tree_ == "b" || tree_ == "binary")
+        return slate::PivotTree::Binary;
+    else if (tree_ == "f" || tree_ == "flat")
+        return slate::PivotTree::Flat;
+    else if (tree_ == "h" || tree_ == "hybrid")
+        return slate::PivotTree::Hybrid;
+    else
+        throw slate::Exception("unknown pivot tree");
+}
+
+inline const char* pivot_tree2str(slate::PivotTree tree)
+{
+    switch (tree) {
+        case slate::PivotTree::Binary: return "binary";
+        case slate::PivotTree::Flat:   return "flat";
+        case slate::PivotTree::Hybrid: return "hybrid";
+    }
+    return "?";
+}
+
+// -----------------------------------------------------------------------------
+inline slate::ComplexGemm str2complex_gemm(const char* method)
+{
+    std::string method_ = method;
+    std::transform(method_.begin(), method_.end(), method_.begin(), ::tolower);
+    if (method_ == "n" || method_ == "native")
+        return slate::ComplexGemm::Native;
+    else if (method_ == "4" || method_ == "4m")
+        return slate::ComplexGemm::Real4M;
+    else if (method_ == "3" || method_ == "3m")
+        return slate::ComplexGemm::Real3M;
+    else
+        throw slate::Exception("unknown complex gemm method");
+}
+
+inline const char* complex_gemm2str(slate::ComplexGemm method)
+{
+    switch (method) {
+        case slate::ComplexGemm::Native: return "native";
+        case slate::ComplexGemm::Real4M: return "4m";
+        case slate::ComplexGemm::Real3M: return "3m";
+    }
+    return "?";
+}
+
 // -----------------------------------------------------------------------------
 inline slate::NormScope str2scope(const char* scope)
 {
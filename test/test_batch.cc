@@ -0,0 +1,338 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+#include "blas/flops.hh"
+#include "lapack/flops.hh"
+#include "grid_utils.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+//------------------------------------------------------------------------------
+// Tests the batched routines in slate::batch on many small problems.
+// Each MPI rank processes its own batch; the reference loops over the
+// regular SLATE drivers, one problem at a time, on MPI_COMM_SELF.
+//
+template <typename scalar_t>
+void test_batch_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+    using llong = long long;
+
+    // Constants
+    const scalar_t one = 1.0;
+
+    // get & mark input values
+    int64_t batch = params.batch();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t k = params.dim.k();
+    int64_t nrhs = params.nrhs();
+    bool ref_only = params.ref() == 'o';
+    bool ref = params.ref() == 'y' || ref_only;
+    bool check = params.check() == 'y' && ! ref_only;
+    int verbose = params.verbose();
+    slate::Uplo uplo = params.uplo();
+
+    bool is_gemm  = params.routine == "gemm_batch";
+    bool is_posv  = params.routine == "posv_batch";
+    bool is_gesv  = params.routine == "gesv_batch";
+    // otherwise geqrf_batch
+
+    // Square systems use n.
+    if (is_posv || is_gesv)
+        m = n;
+    if (! is_gemm)
+        params.dim.k() = 0;
+    if (! (is_posv || is_gesv))
+        params.nrhs.width( 0 );
+    if (! is_posv)
+        params.uplo.width( 0 );
+
+    // mark non-standard output values
+    params.time();
+    params.gflops();
+    params.ref_time();
+    params.ref_gflops();
+
+    if (! run)
+        return;
+
+    slate::Options const opts = {};
+
+    int mpi_rank;
+    MPI_Comm_rank( MPI_COMM_WORLD, &mpi_rank );
+
+    int64_t idist = 3;  // normal
+    int64_t iseed[4] = { 0, mpi_rank, 0, 3 };
+
+    // Sizes of A, B, C for each problem.
+    int64_t Am = m, An = n, Bm = 0, Bn = 0, Cm = 0, Cn = 0;
+    if (is_gemm) {
+        An = k;
+        Bm = k;
+        Bn = n;
+        Cm = m;
+        Cn = n;
+    }
+    else if (is_posv || is_gesv) {
+        Bm = n;
+        Bn = nrhs;
+    }
+    int64_t lda = std::max( Am, int64_t( 1 ) );
+    int64_t ldb = std::max( Bm, int64_t( 1 ) );
+    int64_t ldc = std::max( Cm, int64_t( 1 ) );
+
+    // Contiguous storage for all problems.
+    std::vector<scalar_t> A_data( lda*An*batch );
+    std::vector<scalar_t> B_data( ldb*Bn*batch );
+    std::vector<scalar_t> C_data( ldc*Cn*batch );
+    lapack::larnv( idist, iseed, A_data.size(), A_data.data() );
+    lapack::larnv( idist, iseed, B_data.size(), B_data.data() );
+    lapack::larnv( idist, iseed, C_data.size(), C_data.data() );
+
+    if (is_posv) {
+        // Make each A Hermitian positive definite by boosting the diagonal.
+        for (int64_t b = 0; b < batch; ++b) {
+            scalar_t* Ab = &A_data[ b*lda*An ];
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < j; ++i)
+                    Ab[ j + i*lda ] = blas::conj( Ab[ i + j*lda ] );
+                Ab[ j + j*lda ] = std::abs( Ab[ j + j*lda ] ) + n;
+            }
+        }
+    }
+
+    // Originals for checks and reference runs.
+    std::vector<scalar_t> Aref_data = A_data;
+    std::vector<scalar_t> Bref_data = B_data;
+    std::vector<scalar_t> Cref_data = C_data;
+
+    // Wrap each problem in a host tile.
+    auto make_tiles = [batch](
+        int64_t mb, int64_t nb, std::vector<scalar_t>& data, int64_t ld)
+    {
+        std::vector< slate::Tile<scalar_t> > tiles;
+        tiles.reserve( batch );
+        for (int64_t b = 0; b < batch; ++b) {
+            tiles.push_back( slate::Tile<scalar_t>(
+                mb, nb, data.data() + b*ld*nb, ld, slate::HostNum,
+                slate::TileKind::UserOwned ) );
+        }
+        return tiles;
+    };
+    auto A = make_tiles( Am, An, A_data, lda );
+    auto B = make_tiles( Bm, Bn, B_data, ldb );
+    auto C = make_tiles( Cm, Cn, C_data, ldc );
+
+    if (is_posv) {
+        for (auto& Ab : A)
+            Ab.uplo( uplo );
+    }
+
+    scalar_t alpha = params.alpha.get<scalar_t>();
+    scalar_t beta  = params.beta.get<scalar_t>();
+
+    double gflop;
+    if (is_gemm)
+        gflop = batch * blas::Gflop<scalar_t>::gemm( m, n, k );
+    else if (is_posv)
+        gflop = batch * lapack::Gflop<scalar_t>::posv( n, nrhs );
+    else if (is_gesv)
+        gflop = batch * lapack::Gflop<scalar_t>::gesv( n, nrhs );
+    else
+        gflop = batch * lapack::Gflop<scalar_t>::geqrf( m, n );
+
+    std::vector<int64_t> info;
+    std::vector< std::vector<int64_t> > pivots;
+    std::vector< std::vector<scalar_t> > tau;
+
+    if (! ref_only) {
+        //==================================================
+        // Run SLATE batched routine.
+        //==================================================
+        double time = barrier_get_wtime( MPI_COMM_WORLD );
+
+        if (is_gemm) {
+            slate::batch::gemm( alpha, A, B, beta, C, opts );
+        }
+        else if (is_posv) {
+            slate::batch::potrf( A, info, opts );
+            slate::batch::potrs( A, B, info, opts );
+        }
+        else if (is_gesv) {
+            slate::batch::getrf( A, pivots, info, opts );
+            slate::batch::getrs( A, pivots, B, info, opts );
+        }
+        else {
+            slate::batch::geqrf( A, tau, opts );
+        }
+
+        time = barrier_get_wtime( MPI_COMM_WORLD ) - time;
+
+        // compute and save timing/performance
+        params.time() = time;
+        params.gflops() = gflop / time;
+
+        for (size_t b = 0; b < info.size(); ++b) {
+            if (info[ b ] != 0 && verbose > 0) {
+                printf( "rank %d, problem %llu: info %lld\n",
+                        mpi_rank, llong( b ), llong( info[ b ] ) );
+            }
+        }
+    }
+
+    if (check && ! ref_only) {
+        //==================================================
+        // Test results on each problem; report the worst one.
+        //==================================================
+        real_t eps = std::numeric_limits<real_t>::epsilon();
+        real_t error = 0;
+        for (int64_t b = 0; b < batch; ++b) {
+            scalar_t* A0 = &Aref_data[ b*lda*An ];
+            scalar_t* B0 = &Bref_data[ b*ldb*Bn ];
+            scalar_t* C0 = &Cref_data[ b*ldc*Cn ];
+            real_t err_b;
+            if (is_gemm) {
+                // || C_batch - C_ref ||_1 / (|alpha| ||A|| ||B|| + |beta| ||C||)
+                real_t A_norm = lapack::lange(
+                    lapack::Norm::One, m, k, A0, lda );
+                real_t B_norm = lapack::lange(
+                    lapack::Norm::One, k, n, B0, ldb );
+                real_t C0_norm = lapack::lange(
+                    lapack::Norm::One, m, n, C0, ldc );
+                blas::gemm( blas::Layout::ColMajor,
+                            blas::Op::NoTrans, blas::Op::NoTrans, m, n, k,
+                            alpha, A0, lda, B0, ldb, beta, C0, ldc );
+                blas::axpy( ldc*n, -one, C[ b ].data(), 1, C0, 1 );
+                err_b = lapack::lange( lapack::Norm::One, m, n, C0, ldc )
+                      / (std::abs( alpha ) * A_norm * B_norm
+                         + std::abs( beta ) * C0_norm)
+                      / (sqrt( real_t( k ) + 2 ) * eps);
+            }
+            else if (is_posv || is_gesv) {
+                // || B - A X ||_1 / (||A||_1 ||X||_1 n)
+                // For posv, A0 holds the full Hermitian matrix.
+                real_t A_norm = lapack::lange(
+                    lapack::Norm::One, n, n, A0, lda );
+                real_t X_norm = lapack::lange(
+                    lapack::Norm::One, n, nrhs, B[ b ].data(), ldb );
+                blas::gemm( blas::Layout::ColMajor,
+                            blas::Op::NoTrans, blas::Op::NoTrans, n, nrhs, n,
+                            -one, A0, lda, B[ b ].data(), ldb, one, B0, ldb );
+                err_b = lapack::lange( lapack::Norm::One, n, nrhs, B0, ldb )
+                      / (A_norm * X_norm * n);
+            }
+            else {
+                // Compare |R| with LAPACK, since R is unique up to signs.
+                int64_t mn = std::min( m, n );
+                std::vector<scalar_t> tau0( mn );
+                lapack::geqrf( m, n, A0, lda, tau0.data() );
+                scalar_t* R = A[ b ].data();
+                real_t R_norm = lapack::lantr(
+                    lapack::Norm::One, lapack::Uplo::Upper, lapack::Diag::NonUnit,
+                    mn, n, A0, lda );
+                for (int64_t j = 0; j < n; ++j) {
+                    for (int64_t i = 0; i <= j && i < mn; ++i) {
+                        A0[ i + j*lda ] = std::abs( A0[ i + j*lda ] )
+                                        - std::abs( R[ i + j*lda ] );
+                    }
+                }
+                err_b = lapack::lantr(
+                    lapack::Norm::One, lapack::Uplo::Upper, lapack::Diag::NonUnit,
+                    mn, n, A0, lda ) / (R_norm * m);
+            }
+            error = std::max( error, err_b );
+        }
+        MPI_Allreduce( MPI_IN_PLACE, &error, 1, slate::mpi_type<real_t>::value,
+                       MPI_MAX, MPI_COMM_WORLD );
+        params.error() = error;
+
+        real_t tol = params.tol() * 0.5 * eps;
+        if (is_gemm)
+            tol = params.tol();
+        params.okay() = (params.error() <= tol);
+    }
+
+    if (ref) {
+        //==================================================
+        // Run the regular SLATE drivers one problem at a time.
+        //==================================================
+        slate::Options const ref_opts = {
+            {slate::Option::Target, slate::Target::HostTask},
+        };
+        int64_t nb = std::max( { Am, An, Bm, Bn, Cm, Cn, int64_t( 1 ) } );
+
+        // Start again from the original data.
+        A_data = Aref_data;
+        B_data = Bref_data;
+        C_data = Cref_data;
+
+        double time = barrier_get_wtime( MPI_COMM_WORLD );
+
+        for (int64_t b = 0; b < batch; ++b) {
+            auto Ab = slate::Matrix<scalar_t>::fromLAPACK(
+                Am, An, &A_data[ b*lda*An ], lda, nb, 1, 1, MPI_COMM_SELF );
+            if (is_gemm) {
+                auto Bb = slate::Matrix<scalar_t>::fromLAPACK(
+                    Bm, Bn, &B_data[ b*ldb*Bn ], ldb, nb, 1, 1, MPI_COMM_SELF );
+                auto Cb = slate::Matrix<scalar_t>::fromLAPACK(
+                    Cm, Cn, &C_data[ b*ldc*Cn ], ldc, nb, 1, 1, MPI_COMM_SELF );
+                slate::multiply( alpha, Ab, Bb, beta, Cb, ref_opts );
+            }
+            else if (is_posv) {
+                auto Bb = slate::Matrix<scalar_t>::fromLAPACK(
+                    Bm, Bn, &B_data[ b*ldb*Bn ], ldb, nb, 1, 1, MPI_COMM_SELF );
+                slate::HermitianMatrix<scalar_t> Hb( uplo, Ab );
+                slate::chol_solve( Hb, Bb, ref_opts );
+            }
+            else if (is_gesv) {
+                auto Bb = slate::Matrix<scalar_t>::fromLAPACK(
+                    Bm, Bn, &B_data[ b*ldb*Bn ], ldb, nb, 1, 1, MPI_COMM_SELF );
+                slate::lu_solve( Ab, Bb, ref_opts );
+            }
+            else {
+                slate::TriangularFactors<scalar_t> T;
+                slate::geqrf( Ab, T, ref_opts );
+            }
+        }
+
+        time = barrier_get_wtime( MPI_COMM_WORLD ) - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_batch(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_batch_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_batch_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_batch_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_batch_work<std::complex<double>> (params, run);
+            break;
+    }
+}
@@ -55,6 +55,11 @@ void test_gbsv_work(Params& params, bool run)
     int verbose = params.verbose();
     slate::Origin origin = params.origin();
     slate::Target target = params.target();
+    // Band method applies only to the combined solve; compare
+    // --method-band tiled,spike to benchmark SPIKE against gbtrf + gbtrs.
+    slate::Method method_band = slate::MethodBand::Tiled;
+    if (params.routine == "gbsv")
+        method_band = params.method_band();
     params.matrix.mark();
 
     // mark non-standard output values
@@ -75,7 +80,8 @@ void test_gbsv_work(Params& params, bool run)
         {slate::Option::Lookahead, lookahead},
         {slate::Option::Target, target},
         {slate::Option::MaxPanelThreads, panel_threads},
-        {slate::Option::InnerBlocking, ib}
+        {slate::Option::InnerBlocking, ib},
+        {slate::Option::MethodBand, method_band}
     };
 
     // MPI variables
@@ -117,6 +123,12 @@ void test_gbsv_work(Params& params, bool run)
                             // set outside band to zero
                             T.at(ti - ii, tj - jj) = 0;
                         }
+                        else if (ti == tj
+                                 && method_band == slate::MethodBand::Spike) {
+                            // SPIKE pivots only within partitions, so make
+                            // A diagonally dominant.
+                            T.at(ti - ii, tj - jj) += scalar_t( kl + ku + 1 );
+                        }
                     }
                 }
                 auto T2 = Aorig(i, j);
@@ -17,6 +17,7 @@
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
+#include <limits>
 #include <utility>
 
 //------------------------------------------------------------------------------
@@ -42,6 +43,7 @@ void test_gecondest_work(Params& params, bool run)
     int64_t ib = params.ib();
     int64_t lookahead = params.lookahead();
     int64_t panel_threads = params.panel_threads();
+    int64_t cond_est_columns = params.cond_est_columns();
     bool ref_only = params.ref() == 'o';
     bool ref = params.ref() == 'y' || ref_only;
     bool check = params.check() == 'y' && ! ref_only;
@@ -99,6 +101,7 @@ void test_gecondest_work(Params& params, bool run)
         {slate::Option::Target, target},
         {slate::Option::MaxPanelThreads, panel_threads},
         {slate::Option::InnerBlocking, ib},
+        {slate::Option::CondEstColumns, cond_est_columns},
         {slate::Option::PivotThreshold, pivot_threshold},
         {slate::Option::MethodLU, method},
     };
@@ -288,6 +291,14 @@ void test_gecondest_work(Params& params, bool run)
     real_t tol = params.tol();
     params.okay() = (params.error() <= tol);
 
+    if (check && ! ref_only) {
+        // The estimate of || A^{-1} || is a lower bound, so the estimated
+        // rcond must not be below the exact rcond, up to rounding.
+        real_t eps = std::numeric_limits<real_t>::epsilon();
+        params.okay() = params.okay()
+                        && slate_rcond >= exact_rcond * (1 - std::sqrt( eps ));
+    }
+
 }
 
 // -----------------------------------------------------------------------------
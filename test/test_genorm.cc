@@ -235,6 +235,67 @@ void test_genorm_work(Params& params, bool run)
             // Allow for difference
             params.okay() = (params.error() <= tol);
 
+            // Fused norms must agree with the separate norm calls.
+            if (check && scope == slate::NormScope::Matrix) {
+                std::vector<slate::Norm> all_norms = {
+                    slate::Norm::Max, slate::Norm::One,
+                    slate::Norm::Inf, slate::Norm::Fro };
+                std::vector<real_t> all_values( all_norms.size() );
+                slate::norms( all_norms, A, all_values.data(), opts );
+                for (size_t k = 0; k < all_norms.size(); ++k) {
+                    real_t norm_k = slate::norm( all_norms[ k ], A, opts );
+                    real_t error_k = std::abs( all_values[ k ] - norm_k );
+                    if (norm_k != 0)
+                        error_k /= norm_k;
+                    bool okay = error_k <= 10*eps;
+                    params.okay() = params.okay() && okay;
+                    if (verbose && mpi_rank == 0) {
+                        printf( "norms %s %15.8e, norm %15.8e, error %9.2e, %s\n",
+                                norm2str( all_norms[ k ] ), all_values[ k ],
+                                norm_k, error_k, (okay ? "pass" : "failed") );
+                    }
+                }
+            }
+
+            // Fused norms of a wide matrix of ones, with more column sums
+            // than MPI reduces in one segment, must be exact:
+            // max = 1, one = m_wide, inf = n_wide, fro = sqrt( m_wide n_wide ).
+            // It is large, so it runs only with extended tests.
+            if (check && extended && scope == slate::NormScope::Matrix) {
+                int64_t m_wide = 2*p;
+                int64_t n_wide = 1 << 20;
+                slate::Matrix<scalar_t> W( m_wide, n_wide, 1, nb, p, q,
+                                           MPI_COMM_WORLD );
+                W.insertLocalTiles( origin2target( origin ) );
+                slate::set( scalar_t( 1.0 ), scalar_t( 1.0 ), W, opts );
+
+                std::vector<slate::Norm> all_norms = {
+                    slate::Norm::Max, slate::Norm::One,
+                    slate::Norm::Inf, slate::Norm::Fro };
+                std::vector<real_t> exact = {
+                    1, real_t( m_wide ), real_t( n_wide ),
+                    std::sqrt( real_t( m_wide * n_wide ) ) };
+                std::vector<real_t> all_values( all_norms.size() );
+                for (auto W_op : { W, transpose( W ) }) {
+                    if (W_op.op() != slate::Op::NoTrans)
+                        std::swap( exact[ 1 ], exact[ 2 ] );
+                    slate::norms( all_norms, W_op, all_values.data(), opts );
+                    for (size_t k = 0; k < all_norms.size(); ++k) {
+                        real_t error_k = std::abs( all_values[ k ] - exact[ k ] )
+                                       / exact[ k ];
+                        bool okay = error_k <= 10*eps;
+                        params.okay() = params.okay() && okay;
+                        if (verbose && mpi_rank == 0) {
+                            printf( "wide norms %s %15.8e, exact %15.8e, "
+                                    "error %9.2e, %s\n",
+                                    norm2str( all_norms[ k ] ), all_values[ k ],
+                                    exact[ k ], error_k,
+                                    (okay ? "pass" : "failed") );
+                        }
+                    }
+                }
+            }
+
             //---------- extended tests
             if (extended && scope == slate::NormScope::Matrix) {
                 // seed all MPI processes the same
@@ -42,6 +42,7 @@ void test_gesv_work(Params& params, bool run)
         params.method_lu() = slate::MethodLU::NoPiv;
     }
     auto method_lu   = params.method_lu();
+    slate::PivotTree pivot_tree = params.pivot_tree();
     auto methodTrsm = params.method_trsm();
     auto methodGemm = params.method_gemm();
 
@@ -73,6 +74,8 @@ void test_gesv_work(Params& params, bool run)
     SLATE_UNUSED(verbose);
     slate::Origin origin = params.origin();
     slate::Target target = params.target();
+    int64_t ozaki_slices = params.ozaki_slices();
+    slate::Layout host_layout = params.layout();
     slate::GridOrder grid_order = params.grid_order();
     params.matrix.mark();
     params.matrixB.mark();
@@ -130,8 +133,11 @@ void test_gesv_work(Params& params, bool run)
         {slate::Option::InnerBlocking, ib},
         {slate::Option::PivotThreshold, pivot_threshold},
         {slate::Option::MethodLU, method_lu},
+        {slate::Option::HostLayout, host_layout},
+        {slate::Option::PivotTree, pivot_tree},
         {slate::Option::MethodGemm, methodGemm},
         {slate::Option::MethodTrsm, methodTrsm},
+        {slate::Option::OzakiSlices, ozaki_slices},
     };
 
     // Matrix A: figure out local size.
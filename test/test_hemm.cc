@@ -54,6 +54,10 @@ void test_hemm_work(Params& params, bool run)
     slate::Origin origin = params.origin();
     slate::Target target = params.target();
     slate::Method method_hemm = params.method_hemm();
+    int64_t reduce_radix = params.reduce_radix();
+    int64_t reduce_segment = params.reduce_segment();
+    bool reduce_scatter = params.reduce_scatter() == 'y';
+    bool reduce_node_aware = params.reduce_node_aware() == 'y';
     params.matrix.mark();
     params.matrixB.mark();
     params.matrixC.mark();
@@ -75,6 +79,10 @@ void test_hemm_work(Params& params, bool run)
         {slate::Option::Lookahead, lookahead},
         {slate::Option::Target, target},
         {slate::Option::MethodHemm, method_hemm},
+        {slate::Option::ReduceRadix, reduce_radix},
+        {slate::Option::ReduceSegment, reduce_segment},
+        {slate::Option::ReduceScatter, reduce_scatter},
+        {slate::Option::ReduceNodeAware, reduce_node_aware},
         // TODO fix gemmA on device
         //{slate::Option::MethodGemm, slate::MethodGemm::GemmC}
     };
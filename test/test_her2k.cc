@@ -48,6 +48,7 @@ void test_her2k_work(Params& params, bool run)
     bool trace = params.trace() == 'y';
     slate::Origin origin = params.origin();
     slate::Target target = params.target();
+    slate::ComplexGemm complex_gemm = params.complex_gemm();
     params.matrix.mark();
     params.matrixB.mark();
     params.matrixC.mark();
@@ -69,12 +70,20 @@ void test_her2k_work(Params& params, bool run)
         {slate::Option::Lookahead, lookahead},
         {slate::Option::Target, target},
         // TODO fix gemmA on device
-        {slate::Option::MethodGemm, slate::MethodGemm::GemmC}
+        {slate::Option::MethodGemm, slate::MethodGemm::GemmC},
+        {slate::Option::ComplexGemm, complex_gemm},
     };
 
     // Error analysis applies in these norms.
     slate_assert(norm == Norm::One || norm == Norm::Inf || norm == Norm::Fro);
 
+    // The 3M method's error bound is up to 2x larger than gemm's;
+    // see Higham, 2002, sec. 23.2.4.
+    real_t growth = 1;
+    if (slate::is_complex<scalar_t>::value
+        && complex_gemm == slate::ComplexGemm::Real3M)
+        growth = 2;
+
     // setup so op(A) and op(B) are n-by-k
     int64_t Am = (trans == slate::Op::NoTrans ? n : k);
     int64_t An = (trans == slate::Op::NoTrans ? k : n);
@@ -231,7 +240,7 @@ void test_her2k_work(Params& params, bool run)
 
         // Allow 3*eps; complex needs 2*sqrt(2) factor; see Higham, 2002, sec. 3.6.
         real_t eps = std::numeric_limits<real_t>::epsilon();
-        params.okay() = (params.error() <= 3*eps);
+        params.okay() = (params.error() <= growth * 3*eps);
     }
 
     if (ref) {
@@ -315,7 +324,7 @@ void test_her2k_work(Params& params, bool run)
 
             // Allow 3*eps; complex needs 2*sqrt(2) factor; see Higham, 2002, sec. 3.6.
             real_t eps = std::numeric_limits<real_t>::epsilon();
-            params.okay() = (params.error() <= 3*eps);
+            params.okay() = (params.error() <= growth * 3*eps);
 
             Cblacs_gridexit(ictxt);
             //Cblacs_exit(1) does not handle re-entering
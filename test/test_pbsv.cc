@@ -41,6 +41,11 @@ void test_pbsv_work(Params& params, bool run)
     int verbose = params.verbose();
     slate::Origin origin = params.origin();
     slate::Target target = params.target();
+    // Band method applies only to the combined solve; compare
+    // --method-band tiled,spike to benchmark SPIKE against pbtrf + pbtrs.
+    slate::Method method_band = slate::MethodBand::Tiled;
+    if (params.routine == "pbsv")
+        method_band = params.method_band();
     params.matrix.mark();
 
     // mark non-standard output values
@@ -59,7 +64,8 @@ void test_pbsv_work(Params& params, bool run)
 
     slate::Options const opts =  {
         {slate::Option::Lookahead, lookahead},
-        {slate::Option::Target, target}
+        {slate::Option::Target, target},
+        {slate::Option::MethodBand, method_band}
     };
 
     // MPI variables
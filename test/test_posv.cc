@@ -45,6 +45,7 @@ void test_posv_work(Params& params, bool run)
     int verbose = params.verbose();
     slate::Origin origin = params.origin();
     slate::Target target = params.target();
+    int64_t ozaki_slices = params.ozaki_slices();
     slate::Dist dev_dist = params.dev_dist();
     slate::TileReleaseStrategy tile_release_strategy = params.tile_release_strategy();
     params.matrix.mark();
@@ -64,7 +65,8 @@ void test_posv_work(Params& params, bool run)
     params.gflops2.name( "trs gflop/s" );
 
     bool do_potrs = (
-        (check && params.routine == "potrf") || params.routine == "potrs");
+        (check && (params.routine == "potrf" || params.routine == "potrf_tlr"))
+        || params.routine == "potrs");
 
     if (params.routine == "posv_mixed" || params.routine == "posv_mixed_gmres") {
         params.iters();
@@ -82,6 +84,7 @@ void test_posv_work(Params& params, bool run)
         {slate::Option::HoldLocalWorkspace, hold_local_workspace},
         {slate::Option::MethodTrsm, methodTrsm},
         {slate::Option::MethodHemm, methodHemm},
+        {slate::Option::OzakiSlices, ozaki_slices},
     };
 
     // MPI variables
@@ -106,6 +109,11 @@ void test_posv_work(Params& params, bool run)
         return;
     }
 
+    if (params.routine == "potrf_tlr" && target == slate::Target::Devices) {
+        params.msg() = "skipping: unsupported devices support";
+        return;
+    }
+
     // Matrix A: figure out local size.
     int64_t mlocA = num_local_rows_cols(n, nb, myrow, p);
     int64_t nlocA = num_local_rows_cols(n, nb, mycol, q);
@@ -242,6 +250,10 @@ void test_posv_work(Params& params, bool run)
             // Using traditional BLAS/LAPACK name
             // slate::potrf(A, opts);
         }
+        else if (params.routine == "potrf_tlr") {
+            // Factor matrix A, compressing off-diagonal tiles.
+            slate::potrf_tlr(A, opts);
+        }
         else if (params.routine == "posv") {
             slate::chol_solve(A, B, opts);
             // Using traditional BLAS/LAPACK name
@@ -273,7 +285,8 @@ void test_posv_work(Params& params, bool run)
         if (do_potrs) {
             double time2 = barrier_get_wtime(MPI_COMM_WORLD);
 
-            if ((check && params.routine == "potrf")
+            if ((check && (params.routine == "potrf"
+                           || params.routine == "potrf_tlr"))
                 || params.routine == "potrs")
             {
                 slate::chol_solve_using_factor(A, B, opts);
@@ -385,7 +398,7 @@ void test_posv_work(Params& params, bool run)
             // Run ScaLAPACK reference routine.
             //==================================================
             double time = barrier_get_wtime(MPI_COMM_WORLD);
-            if (params.routine == "potrf") {
+            if (params.routine == "potrf" || params.routine == "potrf_tlr") {
                 scalapack_ppotrf(uplo2str(uplo), n, &Aref_data[0], 1, 1, Aref_desc, &info);
             }
             else if (params.routine == "potrs") {
@@ -403,7 +416,8 @@ void test_posv_work(Params& params, bool run)
             if (verbose > 2) {
                 if (origin == slate::Origin::ScaLAPACK) {
                     slate::Debug::diffLapackMatrices<scalar_t>(n, n, &A_data[0], lldA, &Aref_data[0], lldA, nb, nb);
-                    if (params.routine != "potrf") {
+                    if (params.routine != "potrf"
+                        && params.routine != "potrf_tlr") {
                         slate::Debug::diffLapackMatrices<scalar_t>(n, nrhs, &B_data[0], lldB, &Bref_data[0], lldB, nb, nb);
                     }
                 }
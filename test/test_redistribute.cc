@@ -0,0 +1,158 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+
+#include "print_matrix.hh"
+#include "grid_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_redistribute_work(Params& params, bool run)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t one = 1.0;
+
+    // get & mark input values
+    slate::Op trans = params.trans();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nb = params.nb();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    int64_t nb2 = params.nb2();
+    int64_t p2 = params.grid2.m();
+    int64_t q2 = params.grid2.n();
+    bool check = params.check() == 'y';
+    bool trace = params.trace() == 'y';
+    slate::Origin origin = params.origin();
+    params.matrix.mark();
+
+    if (nb2 == 0)
+        nb2 = nb;
+    if (p2 == 0 || q2 == 0) {
+        p2 = p;
+        q2 = q;
+    }
+
+    // mark non-standard output values
+    params.time();
+    params.gbytes();
+    params.time2();
+    params.gbytes2();
+
+    if (! run)
+        return;
+
+    slate::Options const opts =  {
+        {slate::Option::Target, params.target()}
+    };
+
+    int mpi_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    if (p2*q2 > mpi_size) {
+        params.msg() = "skipping: grid2 larger than number of MPI ranks";
+        return;
+    }
+
+    // A is m-by-n with nb and p-by-q; B is op(A) with nb2 and p2-by-q2.
+    slate::Target origin_target = origin2target( origin );
+    slate::Matrix<scalar_t> Afull( m, n, nb, p, q, MPI_COMM_WORLD );
+    Afull.insertLocalTiles( origin_target );
+    slate::generate_matrix( params.matrix, Afull );
+
+    slate::Matrix<scalar_t> Cfull( m, n, nb, p, q, MPI_COMM_WORLD );
+    Cfull.insertLocalTiles( origin_target );
+
+    auto A = Afull;
+    auto C = Cfull;
+    if (trans == slate::Op::Trans) {
+        A = transpose( Afull );
+        C = transpose( Cfull );
+    }
+    else if (trans == slate::Op::ConjTrans) {
+        A = conj_transpose( Afull );
+        C = conj_transpose( Cfull );
+    }
+
+    slate::Matrix<scalar_t> B( A.m(), A.n(), nb2, p2, q2, MPI_COMM_WORLD );
+    B.insertLocalTiles( origin_target );
+
+    print_matrix( "A", A, params );
+
+    if (trace) slate::trace::Trace::on();
+    else slate::trace::Trace::off();
+
+    double gbytes = 1e-9 * m * n * sizeof(scalar_t);
+
+    //==================================================
+    // Run SLATE test.
+    // Redistribute A to B, then B back to C.
+    //==================================================
+    double time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    slate::redistribute( A, B, opts );
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+    params.time() = time;
+    params.gbytes() = gbytes / time;
+
+    time = barrier_get_wtime(MPI_COMM_WORLD);
+
+    slate::redistribute( B, C, opts );
+
+    time = barrier_get_wtime(MPI_COMM_WORLD) - time;
+    params.time2() = time;
+    params.gbytes2() = gbytes / time;
+
+    if (trace) slate::trace::Trace::finish();
+
+    print_matrix( "B", B, params );
+    print_matrix( "C", C, params );
+
+    if (check) {
+        // Round trip should be exact.
+        real_t A_norm = slate::norm( slate::Norm::Max, Afull );
+        slate::add( -one, Afull, one, Cfull );
+        real_t diff_norm = slate::norm( slate::Norm::Max, Cfull );
+
+        params.error() = diff_norm / A_norm;
+        params.okay() = (params.error() == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_redistribute(Params& params, bool run)
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_redistribute_work<float> (params, run);
+            break;
+
+        case testsweeper::DataType::Double:
+            test_redistribute_work<double> (params, run);
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_redistribute_work<std::complex<float>> (params, run);
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_redistribute_work<std::complex<double>> (params, run);
+            break;
+    }
+}
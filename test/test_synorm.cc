@@ -181,6 +181,26 @@ void test_synorm_work(Params& params, bool run)
 
             // Allow for difference
             params.okay() = (params.error() <= tol);
+
+            // Fused norms must agree with the separate norm calls.
+            std::vector<slate::Norm> all_norms = {
+                slate::Norm::Max, slate::Norm::One,
+                slate::Norm::Inf, slate::Norm::Fro };
+            std::vector<real_t> all_values( all_norms.size() );
+            slate::norms( all_norms, A, all_values.data(), opts );
+            for (size_t k = 0; k < all_norms.size(); ++k) {
+                real_t norm_k = slate::norm( all_norms[ k ], A, opts );
+                real_t error_k = std::abs( all_values[ k ] - norm_k );
+                if (norm_k != 0)
+                    error_k /= norm_k;
+                bool okay = error_k <= 10*eps;
+                params.okay() = params.okay() && okay;
+                if (verbose && mpi_rank == 0) {
+                    printf( "norms %s %15.8e, norm %15.8e, error %9.2e, %s\n",
+                            norm2str( all_norms[ k ] ), all_values[ k ],
+                            norm_k, error_k, (okay ? "pass" : "failed") );
+                }
+            }
         }
 
         //---------- extended tests
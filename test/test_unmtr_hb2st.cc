@@ -124,8 +124,8 @@ void test_unmtr_hb2st_work(Params& params, bool run)
     }
     print_matrix( "V", V, params );
 
-    // Set Q = Identity. Use 1D column cyclic.
-    slate::Matrix<scalar_t> Q(n, n, nb, 1, p*q, MPI_COMM_WORLD);
+    // Set Q = Identity. Use 2D block cyclic; 1D column cyclic if p == 1.
+    slate::Matrix<scalar_t> Q(n, n, nb, p, q, MPI_COMM_WORLD);
     Q.insertLocalTiles(origin_target);
     set(zero, one, Q);
     print_matrix( "Q0", Q, params );
@@ -50,18 +50,21 @@ opts = parser.parse_args()
 # ------------------------------------------------------------------------------
 cmds = [
     'test_BandMatrix',
+    'test_DryRun',
     'test_HermitianMatrix',
     'test_LockGuard',
     'test_OmpSetMaxActiveLevels',
     'test_Matrix',
     'test_Memory',
     'test_SymmetricMatrix',
+    'test_ThreadTeam',
     'test_TrapezoidMatrix',
     'test_TriangularBandMatrix',
     'test_TriangularMatrix',
     'test_Tile',
     'test_Tile_kernels',
     #'test_c_api',  # only if c_api was compiled
+    'test_async',
     'test_geadd',
     'test_gecopy',
     'test_geset',
@@ -5,6 +5,7 @@
 
 #include "slate/BandMatrix.hh"
 #include "slate/TriangularBandMatrix.hh"
+#include "slate/HermitianBandMatrix.hh"
 #include "slate/internal/util.hh"
 
 #include "unit_test.hh"
@@ -285,6 +286,106 @@ void test_BandMatrix_tileInsert_data()
     }
 }
 
+//------------------------------------------------------------------------------
+/// Tests BandMatrix::fromLAPACKBand and copyToLAPACKBand round trip.
+void test_BandMatrix_fromLAPACKBand()
+{
+    int ldab = kl + ku + 1;
+    std::vector<double> ab( ldab*n );
+    for (int j = 0; j < n; ++j)
+        for (int i = std::max( 0, j - ku ); i <= std::min( m-1, j + kl ); ++i)
+            ab[ ku + i - j + j*ldab ] = i + j / 10000.;
+
+    auto A = slate::BandMatrix<double>::fromLAPACKBand(
+                 m, n, kl, ku, ab.data(), ldab, nb, p, q, mpi_comm );
+    test_assert( A.m() == m );
+    test_assert( A.n() == n );
+    test_assert( A.lowerBandwidth() == kl );
+    test_assert( A.upperBandwidth() == ku );
+
+    int jj = 0; // col index
+    for (int j = 0; j < A.nt(); ++j) {
+        int ii = 0; // row index
+        for (int i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal( i, j ) && A.tileExists( i, j )) {
+                auto T = A( i, j );
+                for (int tj = 0; tj < T.nb(); ++tj) {
+                    for (int ti = 0; ti < T.mb(); ++ti) {
+                        int row = ii + ti;
+                        int col = jj + tj;
+                        if (col - ku <= row && row <= col + kl)
+                            test_assert( T( ti, tj ) == row + col / 10000. );
+                        else
+                            test_assert( T( ti, tj ) == 0 );
+                    }
+                }
+            }
+            ii += A.tileMb(i);
+        }
+        jj += A.tileNb(j);
+    }
+
+    // Each rank writes its local entries; compare with the original there.
+    std::vector<double> ab2( ldab*n, -1 );
+    A.copyToLAPACKBand( ab2.data(), ldab );
+    for (int k = 0; k < ldab*n; ++k) {
+        test_assert( ab2[ k ] == -1 || ab2[ k ] == ab[ k ] );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Tests HermitianBandMatrix::fromLAPACKBand.
+void test_HermitianBandMatrix_fromLAPACKBand(slate::Uplo uplo)
+{
+    bool upper = (uplo == slate::Uplo::Upper);
+    int kd = upper ? ku : kl;
+    int ldab = kd + 1;
+    std::vector<double> ab( ldab*n );
+    for (int j = 0; j < n; ++j) {
+        int istart = upper ? std::max( 0, j - kd ) : j;
+        int iend   = upper ? j : std::min( n-1, j + kd );
+        for (int i = istart; i <= iend; ++i) {
+            int k = upper ? kd + i - j : i - j;
+            ab[ k + j*ldab ] = i + j / 10000.;
+        }
+    }
+
+    auto A = slate::HermitianBandMatrix<double>::fromLAPACKBand(
+                 uplo, n, kd, ab.data(), ldab, nb, p, q, mpi_comm );
+    test_assert( A.uplo() == uplo );
+    test_assert( A.bandwidth() == kd );
+
+    int jj = 0; // col index
+    for (int j = 0; j < A.nt(); ++j) {
+        int ii = 0; // row index
+        for (int i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal( i, j ) && A.tileExists( i, j )) {
+                auto T = A( i, j );
+                for (int tj = 0; tj < T.nb(); ++tj) {
+                    for (int ti = 0; ti < T.mb(); ++ti) {
+                        int row = ii + ti;
+                        int col = jj + tj;
+                        bool in_band = upper ? (col - kd <= row && row <= col)
+                                             : (col <= row && row <= col + kd);
+                        if (in_band)
+                            test_assert( T( ti, tj ) == row + col / 10000. );
+                        else
+                            test_assert( T( ti, tj ) == 0 );
+                    }
+                }
+            }
+            ii += A.tileMb(i);
+        }
+        jj += A.tileNb(j);
+    }
+}
+
+void test_HermitianBandMatrix_fromLAPACKBand()
+{
+    test_HermitianBandMatrix_fromLAPACKBand( slate::Uplo::Lower );
+    test_HermitianBandMatrix_fromLAPACKBand( slate::Uplo::Upper );
+}
+
 //------------------------------------------------------------------------------
 void test_BandMatrix_sub()
 {
@@ -451,6 +552,8 @@ void run_tests()
     run_test(test_BandMatrix_swap,            "swap",           mpi_comm);
     run_test(test_BandMatrix_tileInsert_new,  "BandMatrix::tileInsert(i, j, dev) ", mpi_comm);
     run_test(test_BandMatrix_tileInsert_data, "BandMatrix::tileInsert(i, j, dev, data, lda)",  mpi_comm);
+    run_test(test_BandMatrix_fromLAPACKBand,  "BandMatrix::fromLAPACKBand",  mpi_comm);
+    run_test(test_HermitianBandMatrix_fromLAPACKBand, "HermitianBandMatrix::fromLAPACKBand",  mpi_comm);
     run_test(test_BandMatrix_sub,             "BandMatrix::sub",       mpi_comm);
     run_test(test_BandMatrix_sub_trans,       "BandMatrix::sub(A^T)",  mpi_comm);
     run_test(test_TriangularBandMatrix_gatherAll, "TriangularBandMatrix::gatherAll()",  mpi_comm);
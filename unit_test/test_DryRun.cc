@@ -0,0 +1,156 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/internal/DryRun.hh"
+#include "lapack/flops.hh"
+
+#include "unit_test.hh"
+
+#include <cmath>
+
+using slate::DryRun;
+
+namespace test {
+
+//------------------------------------------------------------------------------
+// global variables
+int mpi_rank;
+int mpi_size;
+MPI_Comm mpi_comm;
+
+//------------------------------------------------------------------------------
+/// Host tiles inserted during a dry run are counted, and released when
+/// the matrix is destroyed.
+void test_host_tiles()
+{
+    int64_t m = 100, n = 70, nb = 16;
+
+    DryRun::on();
+    int64_t local_tiles = 0, local_bytes = 0;
+    {
+        slate::Matrix<double> A( m, n, nb, mpi_size, 1, mpi_comm );
+        A.insertLocalTiles();
+        for (int64_t j = 0; j < A.nt(); ++j) {
+            for (int64_t i = 0; i < A.mt(); ++i) {
+                if (A.tileIsLocal( i, j )) {
+                    ++local_tiles;
+                    local_bytes += A.tileMb( i ) * A.tileNb( j ) * sizeof( double );
+                }
+            }
+        }
+        test_assert( DryRun::counts().host_tiles == local_tiles );
+        test_assert( DryRun::counts().host_bytes == local_bytes );
+    }
+    DryRun::off();
+
+    test_assert( DryRun::counts().host_tiles == 0 );
+    test_assert( DryRun::counts().host_bytes == 0 );
+    test_assert( DryRun::counts().peak_tiles == local_tiles );
+    test_assert( DryRun::counts().peak_bytes == local_bytes );
+}
+
+//------------------------------------------------------------------------------
+/// Host tiles of a matrix that outlives the dry run are released when the
+/// matrix is destroyed, and a later dry run starts from zero.
+void test_outlive()
+{
+    int64_t m = 100, n = 70, nb = 16;
+
+    DryRun::on();
+    auto A = new slate::Matrix<double>( m, n, nb, mpi_size, 1, mpi_comm );
+    A->insertLocalTiles();
+    DryRun::off();
+
+    delete A;
+    test_assert( DryRun::counts().host_tiles == 0 );
+    test_assert( DryRun::counts().host_bytes == 0 );
+
+    DryRun::on();
+    {
+        slate::Matrix<double> B( m, n, nb, mpi_size, 1, mpi_comm );
+        B.insertLocalTiles();
+        test_assert( DryRun::counts().host_tiles == B.numLocalTiles() );
+    }
+    DryRun::off();
+    test_assert( DryRun::counts().host_tiles == 0 );
+}
+
+//------------------------------------------------------------------------------
+/// A dry-run getrf sizes a grid with more ranks than are launched:
+/// each launched rank counts the flops and messages of its part.
+void test_getrf_grid()
+{
+    int64_t nb = 32, n = 8*nb;
+    int p = 2*mpi_size;
+
+    DryRun::on();
+    {
+        slate::Matrix<double> A( n, n, nb, p, 1, mpi_comm );
+        A.insertLocalTiles();
+        slate::Pivots pivots;
+        slate::getrf( A, pivots, {
+            { slate::Option::Target, slate::Target::HostTask },
+        } );
+    }
+    DryRun::off();
+
+    test_assert( DryRun::counts().gflop > 0 );
+    test_assert( DryRun::counts().sends > 0 );
+    test_assert( DryRun::counts().recvs > 0 );
+}
+
+//------------------------------------------------------------------------------
+/// The flops counted by a dry-run potrf, summed over ranks,
+/// are those of a full potrf.
+void test_potrf_gflop()
+{
+    int64_t nb = 32, n = 5*nb;
+
+    DryRun::on();
+    {
+        slate::HermitianMatrix<double> A(
+            slate::Uplo::Lower, n, nb, mpi_size, 1, mpi_comm );
+        A.insertLocalTiles();
+        slate::potrf( A, {
+            { slate::Option::Target, slate::Target::HostTask },
+        } );
+    }
+    DryRun::off();
+
+    double gflop = DryRun::counts().gflop, gflop_sum = 0;
+    MPI_Allreduce( &gflop, &gflop_sum, 1, MPI_DOUBLE, MPI_SUM, mpi_comm );
+
+    double expect = lapack::Gflop<double>::potrf( n );
+    test_assert( std::abs( gflop_sum - expect ) <= 1e-10 * expect );
+}
+
+//------------------------------------------------------------------------------
+/// Runs all tests. Called by unit test main().
+void run_tests()
+{
+    run_test(test_host_tiles,  "DryRun host tiles",  mpi_comm);
+    run_test(test_outlive,     "DryRun matrix outliving the run", mpi_comm);
+    run_test(test_potrf_gflop, "DryRun potrf Gflop", mpi_comm);
+    run_test(test_getrf_grid,  "DryRun getrf on a larger grid", mpi_comm);
+}
+
+}  // namespace test
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    using namespace test;  // for globals mpi_rank, etc.
+
+    MPI_Init( &argc, &argv );
+    mpi_comm = MPI_COMM_WORLD;
+    MPI_Comm_rank( mpi_comm, &mpi_rank );
+    MPI_Comm_size( mpi_comm, &mpi_size );
+
+    int err = unit_test_main( mpi_comm );  // which calls run_tests()
+
+    MPI_Finalize();
+    return err;
+}
@@ -1701,6 +1701,107 @@ void test_tileSend_tileRecv()
     }
 }
 
+//------------------------------------------------------------------------------
+/// Tests listBcast with a node workspace: each tile in column 0 is sent to
+/// its block row; tiles received within a node are shared.
+void test_listBcast_node()
+{
+    int lda = roundup(m, nb);
+    std::vector<double> Ad( lda*n );
+
+    auto A = slate::Matrix<double>::fromLAPACK(
+        m, n, Ad.data(), lda, nb, p, q, mpi_comm );
+    A.reserveNodeWorkspace( A.mt() );
+
+    for (int i = 0; i < A.mt(); ++i) {
+        if (A.tileIsLocal(i, 0))
+            A(i, 0).set( i );
+    }
+
+    using BcastList = slate::Matrix<double>::BcastList;
+    BcastList bcast_list;
+    for (int i = 0; i < A.mt(); ++i)
+        bcast_list.push_back( { i, 0, { A.sub(i, i, 0, A.nt()-1) } } );
+    A.listBcast( bcast_list, A.layout() );
+
+    // Every rank in block row i has A(i, 0).
+    for (int i = 0; i < A.mt(); ++i) {
+        if (A.tileExists(i, 0)) {
+            A.tileGetForReading(i, 0, slate::LayoutConvert::None);
+            auto T = A(i, 0);
+            test_assert( T(0, 0) == i );
+            test_assert( T(T.mb()-1, T.nb()-1) == i );
+        }
+    }
+    MPI_Barrier( mpi_comm );
+
+    // Writing to a received tile on odd ranks must not change
+    // the copies on other ranks.
+    if (mpi_rank % 2 == 1) {
+        for (int i = 0; i < A.mt(); ++i) {
+            if (A.tileExists(i, 0) && ! A.tileIsLocal(i, 0)) {
+                A.tileGetForWriting(i, 0, slate::LayoutConvert::None);
+                A(i, 0).set( -1 );
+            }
+        }
+    }
+    MPI_Barrier( mpi_comm );
+    if (mpi_rank % 2 == 0) {
+        for (int i = 0; i < A.mt(); ++i) {
+            if (A.tileExists(i, 0)) {
+                auto T = A(i, 0);
+                test_assert( T(0, 0) == i );
+            }
+        }
+    }
+    MPI_Barrier( mpi_comm );
+
+    A.clearWorkspace();
+    A.clearNodeWorkspace();
+}
+
+//------------------------------------------------------------------------------
+/// Tests tileFetch: every rank gets every tile through the tile window.
+void test_tileFetch()
+{
+    int lda = roundup(m, nb);
+    std::vector<double> Ad( lda*n );
+
+    auto A = slate::Matrix<double>::fromLAPACK(
+        m, n, Ad.data(), lda, nb, p, q, mpi_comm );
+
+    for (int j = 0; j < A.nt(); ++j) {
+        for (int i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal(i, j))
+                A(i, j).set( i + j/1000. );
+        }
+    }
+
+    A.createTileWindow();
+    MPI_Barrier( mpi_comm );
+
+    std::set< std::tuple<int64_t, int64_t> > tile_set;
+    for (int j = 0; j < A.nt(); ++j)
+        for (int i = 0; i < A.mt(); ++i)
+            tile_set.insert( { i, j } );
+
+    // Second pass finds all tiles cached.
+    for (int pass = 0; pass < 2; ++pass) {
+        A.tileFetch( tile_set );
+        for (int j = 0; j < A.nt(); ++j) {
+            for (int i = 0; i < A.mt(); ++i) {
+                auto T = A(i, j);
+                test_assert( T(0, 0) == i + j/1000. );
+                test_assert( T(T.mb()-1, T.nb()-1) == i + j/1000. );
+            }
+        }
+    }
+
+    A.clearWorkspace();
+    MPI_Barrier( mpi_comm );
+    A.freeTileWindow();
+}
+
 //==============================================================================
 // tile MOSI & Layout conversion
 
@@ -2145,6 +2246,8 @@ void run_tests()
     if (mpi_rank == 0)
         printf("\nCommunication\n");
     run_test(test_tileSend_tileRecv, "tileSend, tileRecv", mpi_comm);
+    run_test(test_listBcast_node,    "listBcast with node workspace", mpi_comm);
+    run_test(test_tileFetch,         "tileFetch", mpi_comm);
 }
 
 }  // namespace test
@@ -0,0 +1,148 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/Exception.hh"
+#include "internal/internal_thread_team.hh"
+
+#include "unit_test.hh"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using slate::internal::ThreadTeam;
+
+namespace test {
+
+//------------------------------------------------------------------------------
+/// Waits until count reaches size, which happens only if all size threads
+/// run concurrently. Returns false after a timeout instead of hanging.
+bool rendezvous( std::atomic<int>& count, int size )
+{
+    ++count;
+    auto start = std::chrono::steady_clock::now();
+    while (count < size) {
+        if (std::chrono::steady_clock::now() - start > std::chrono::seconds( 10 ))
+            return false;
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+/// Each rank runs once, all ranks run concurrently, and rank 0 is the
+/// calling thread. Workers are reused by the next run.
+void test_run()
+{
+    ThreadTeam team;
+    int size = 4;
+    for (int iter = 0; iter < 3; ++iter) {
+        std::vector<int> calls( size, 0 );
+        std::vector<std::thread::id> ids( size );
+        std::atomic<int> count( 0 ), okay( 0 );
+        team.run( size, [&]( int thread_rank ) {
+            ++calls[ thread_rank ];
+            ids[ thread_rank ] = std::this_thread::get_id();
+            if (rendezvous( count, size ))
+                ++okay;
+        } );
+        test_assert( okay == size );
+        for (int r = 0; r < size; ++r)
+            test_assert( calls[ r ] == 1 );
+        test_assert( ids[ 0 ] == std::this_thread::get_id() );
+        test_assert( team.num_workers() == size - 1 );
+    }
+
+    // size 1 runs on the calling thread only.
+    int calls = 0;
+    team.run( 1, [&]( int thread_rank ) {
+        test_assert( thread_rank == 0 );
+        ++calls;
+    } );
+    test_assert( calls == 1 );
+}
+
+//------------------------------------------------------------------------------
+/// Concurrent runs from different threads get disjoint workers.
+void test_concurrent()
+{
+    ThreadTeam team;
+    int num_callers = 3;
+    int size = 3;
+    std::atomic<int> okay( 0 );
+    std::vector<std::thread> callers;
+    for (int c = 0; c < num_callers; ++c) {
+        callers.push_back( std::thread( [&] {
+            for (int iter = 0; iter < 10; ++iter) {
+                std::atomic<int> count( 0 );
+                team.run( size, [&]( int thread_rank ) {
+                    if (rendezvous( count, size ))
+                        ++okay;
+                } );
+            }
+        } ) );
+    }
+    for (auto& caller : callers)
+        caller.join();
+
+    test_assert( okay == num_callers * 10 * size );
+    test_assert( team.num_workers() <= num_callers * (size - 1) );
+}
+
+//------------------------------------------------------------------------------
+/// An exception on any rank is rethrown by run after all ranks finish,
+/// and the team is still usable.
+void test_exception()
+{
+    ThreadTeam team;
+    int size = 4;
+    for (int thrower = 0; thrower < size; ++thrower) {
+        std::atomic<int> finished( 0 );
+        test_assert_throw(
+            team.run( size, [&]( int thread_rank ) {
+                if (thread_rank == thrower)
+                    throw slate::Exception( "thread team error" );
+                ++finished;
+            } ),
+            slate::Exception );
+        test_assert( finished == size - 1 );
+    }
+
+    std::atomic<int> finished( 0 );
+    team.run( size, [&]( int thread_rank ) { ++finished; } );
+    test_assert( finished == size );
+}
+
+//------------------------------------------------------------------------------
+/// Destroying a team joins its idle workers.
+void test_shutdown()
+{
+    for (int iter = 0; iter < 5; ++iter) {
+        ThreadTeam team;
+        std::atomic<int> finished( 0 );
+        team.run( 4, [&]( int thread_rank ) { ++finished; } );
+        test_assert( finished == 4 );
+        test_assert( team.num_workers() == 3 );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Runs all tests. Called by unit test main().
+void run_tests()
+{
+    run_test(test_run,        "ThreadTeam::run");
+    run_test(test_concurrent, "ThreadTeam::run concurrent");
+    run_test(test_exception,  "ThreadTeam::run exception");
+    run_test(test_shutdown,   "ThreadTeam::~ThreadTeam");
+}
+
+}  // namespace test
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    return unit_test_main();  // which calls run_tests()
+}
@@ -6,6 +6,7 @@
 #include "slate/Tile.hh"
 #include "slate/Tile_blas.hh"
 #include "internal/Tile_lapack.hh"
+#include "internal/Tile_lowrank.hh"
 #include "slate/internal/device.hh"
 
 #include "unit_test.hh"
@@ -1313,6 +1314,300 @@ void test_deepConjTranspose()
     }
 }
 
+//------------------------------------------------------------------------------
+// generates an m-by-n matrix of exact rank r, A = X Y^H, in Adata.
+template <typename scalar_t>
+void generate_lowrank( int m, int n, int r, int64_t* iseed,
+                       scalar_t* Adata, int lda )
+{
+    std::vector< scalar_t > X( m*r ), Y( n*r );
+    lapack::larnv( 1, iseed, X.size(), X.data() );
+    lapack::larnv( 1, iseed, Y.size(), Y.data() );
+    blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::ConjTrans,
+                m, n, r,
+                1.0, X.data(), m, Y.data(), n,
+                0.0, Adata, lda );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_compress()
+{
+    using real_t = blas::real_type<scalar_t>;
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+
+    int m = 50;
+    int n = 40;
+    int r = 5;
+
+    // test all op(A)
+    for (int ia = 0; ia < 3; ++ia) {
+        // setup A such that op(A) is m-by-n
+        int Am = (ops[ia] == blas::Op::NoTrans ? m : n);
+        int An = (ops[ia] == blas::Op::NoTrans ? n : m);
+        int lda = Am + 1;
+        std::vector< scalar_t > Adata( lda*An );
+        generate_lowrank( Am, An, r, iseed, Adata.data(), lda );
+        slate::Tile< scalar_t > A( Am, An, Adata.data(), lda, HostNum,
+                                   slate::TileKind::UserOwned );
+        A.op( ops[ia] );
+
+        // opAref = op(A) is m-by-n
+        int ldref = m + 1;
+        std::vector< scalar_t > opAref( ldref*n );
+        copy( A, opAref.data(), ldref );
+
+        if (verbose) {
+            printf( "compress( op=%c )\n", char(A.op()) );
+        }
+
+        real_t Anorm = lapack::lange( lapack::Norm::Fro, Am, An,
+                                      Adata.data(), lda );
+        real_t tol = 10*eps*Anorm;
+
+        // run test
+        slate::LowRankTile< scalar_t > B;
+        slate::tile::compress( A, tol, B );
+        test_assert( B.mb() == m );
+        test_assert( B.nb() == n );
+        test_assert( B.rank() == r );
+
+        std::vector< scalar_t > Cdata( ldref*n );
+        slate::Tile< scalar_t > C( m, n, Cdata.data(), ldref, HostNum,
+                                   slate::TileKind::UserOwned );
+        slate::tile::decompress( B, C );
+
+        test_assert_equal( C, opAref.data(), ldref, 3*tol, 3*tol );
+    }
+}
+
+void test_compress()
+{
+    test_compress< float  >();
+    test_compress< double >();
+    test_compress< std::complex<float>  >();
+    test_compress< std::complex<double> >();
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_gemm_lowrank()
+{
+    using real_t = blas::real_type<scalar_t>;
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+
+    scalar_t alpha, beta;
+    lapack::larnv( 1, iseed, 1, &alpha );
+    beta = 1.0;
+
+    int m = 50;
+    int n = 40;
+    int k = 30;
+
+    // test ranks small enough to recompress, and large enough
+    // to take the dense path
+    for (int r : { 3, 20 }) {
+        int lda = m, ldb = k, ldc = m;
+        std::vector< scalar_t > Adata( lda*k ), Bdata( ldb*n ), Cdata( ldc*n );
+        generate_lowrank( m, k, r, iseed, Adata.data(), lda );
+        generate_lowrank( k, n, r, iseed, Bdata.data(), ldb );
+        generate_lowrank( m, n, r, iseed, Cdata.data(), ldc );
+        slate::Tile< scalar_t > A( m, k, Adata.data(), lda, HostNum,
+                                   slate::TileKind::UserOwned );
+        slate::Tile< scalar_t > B( k, n, Bdata.data(), ldb, HostNum,
+                                   slate::TileKind::UserOwned );
+        slate::Tile< scalar_t > C( m, n, Cdata.data(), ldc, HostNum,
+                                   slate::TileKind::UserOwned );
+
+        if (verbose) {
+            printf( "gemm_lowrank( rank=%d )\n", r );
+        }
+
+        real_t tol = 10*eps*lapack::lange( lapack::Norm::Fro, m, n,
+                                           Cdata.data(), ldc );
+        slate::LowRankTile< scalar_t > Alr, Blr, Clr;
+        slate::tile::compress( A, tol, Alr );
+        slate::tile::compress( B, tol, Blr );
+        slate::tile::compress( C, tol, Clr );
+
+        // reference solution: Cref = alpha A B + beta C, dense
+        std::vector< scalar_t > Cref( Cdata );
+        blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                    m, n, k,
+                    alpha, Adata.data(), lda, Bdata.data(), ldb,
+                    beta,  Cref.data(), ldc );
+        real_t Cnorm = lapack::lange( lapack::Norm::Fro, m, n,
+                                      Cref.data(), ldc );
+
+        // run test: low-rank C
+        slate::tile::gemm( alpha, Alr, Blr, Clr, tol );
+        test_assert( Clr.rank() <= std::min( 3*r, std::min( m, n ) ) );
+        slate::tile::decompress( Clr, C );
+        test_assert_equal( C, Cref.data(), ldc,
+                           100*eps*Cnorm, 100*eps*Cnorm );
+
+        // run test: dense C
+        generate_lowrank( m, n, r, iseed, Cdata.data(), ldc );
+        Cref = Cdata;
+        blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                    m, n, k,
+                    alpha, Adata.data(), lda, Bdata.data(), ldb,
+                    beta,  Cref.data(), ldc );
+        slate::tile::gemm( alpha, Alr, Blr, beta, C );
+        test_assert_equal( C, Cref.data(), ldc,
+                           100*eps*Cnorm, 100*eps*Cnorm );
+    }
+}
+
+void test_gemm_lowrank()
+{
+    test_gemm_lowrank< float  >();
+    test_gemm_lowrank< double >();
+    test_gemm_lowrank< std::complex<float>  >();
+    test_gemm_lowrank< std::complex<double> >();
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_trsm_lowrank()
+{
+    using real_t = blas::real_type<scalar_t>;
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+
+    scalar_t alpha;
+    lapack::larnv( 1, iseed, 1, &alpha );
+
+    int m = 50;
+    int n = 40;
+    int r = 5;
+
+    // test all combinations of side, uplo, op(A); conj-transposed real
+    // and complex op(A) are valid for both sides
+    for (int is = 0; is < 2; ++is) {
+    for (int iu = 0; iu < 2; ++iu) {
+    for (int ia = 0; ia < 3; ++ia) {
+        blas::Side side = sides[is];
+        blas::Uplo uplo = uplos[iu];
+        blas::Op opA = ops[ia];
+        if (slate::is_complex<scalar_t>::value && side == blas::Side::Right
+            && opA == blas::Op::Trans)
+            continue;
+
+        // setup A, well-conditioned triangular
+        int An = (side == blas::Side::Left ? m : n);
+        int lda = An;
+        std::vector< scalar_t > Adata( lda*An );
+        lapack::larnv( 1, iseed, Adata.size(), Adata.data() );
+        for (int j = 0; j < An; ++j)
+            Adata[ j + j*lda ] += An;
+        slate::Tile< scalar_t > A( An, An, Adata.data(), lda, HostNum,
+                                   slate::TileKind::UserOwned );
+        A.uplo( uplo );
+        A.op( opA );
+
+        // setup B = U V^H
+        int ldb = m;
+        std::vector< scalar_t > Bdata( ldb*n );
+        generate_lowrank( m, n, r, iseed, Bdata.data(), ldb );
+        slate::Tile< scalar_t > B( m, n, Bdata.data(), ldb, HostNum,
+                                   slate::TileKind::UserOwned );
+        real_t tol = 10*eps*lapack::lange( lapack::Norm::Fro, m, n,
+                                           Bdata.data(), ldb );
+        slate::LowRankTile< scalar_t > Blr;
+        slate::tile::compress( B, tol, Blr );
+
+        if (verbose) {
+            printf( "trsm_lowrank( side=%c, uplo=%c, op=%c )\n",
+                    char(side), char(uplo), char(opA) );
+        }
+
+        // reference solution, dense
+        std::vector< scalar_t > Bref( Bdata );
+        blas::trsm( blas::Layout::ColMajor, side, uplo, opA,
+                    blas::Diag::NonUnit, m, n,
+                    alpha, Adata.data(), lda, Bref.data(), ldb );
+        real_t Bnorm = lapack::lange( lapack::Norm::Fro, m, n,
+                                      Bref.data(), ldb );
+
+        // run test
+        slate::tile::trsm( side, blas::Diag::NonUnit, alpha, A, Blr );
+        test_assert( Blr.rank() == r );
+        slate::tile::decompress( Blr, B );
+        test_assert_equal( B, Bref.data(), ldb,
+                           100*eps*Bnorm, 100*eps*Bnorm );
+    }}}
+}
+
+void test_trsm_lowrank()
+{
+    test_trsm_lowrank< float  >();
+    test_trsm_lowrank< double >();
+    test_trsm_lowrank< std::complex<float>  >();
+    test_trsm_lowrank< std::complex<double> >();
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_herk_lowrank()
+{
+    using real_t = blas::real_type<scalar_t>;
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+
+    real_t alpha = -1.0;
+    real_t beta  =  1.0;
+
+    int n = 50;
+    int k = 40;
+    int r = 5;
+
+    for (int iu = 0; iu < 2; ++iu) {
+        blas::Uplo uplo = uplos[iu];
+
+        int lda = n, ldc = n;
+        std::vector< scalar_t > Adata( lda*k ), Cdata( ldc*n );
+        generate_lowrank( n, k, r, iseed, Adata.data(), lda );
+        lapack::larnv( 1, iseed, Cdata.size(), Cdata.data() );
+        slate::Tile< scalar_t > A( n, k, Adata.data(), lda, HostNum,
+                                   slate::TileKind::UserOwned );
+        slate::Tile< scalar_t > C( n, n, Cdata.data(), ldc, HostNum,
+                                   slate::TileKind::UserOwned );
+        C.uplo( uplo );
+
+        real_t tol = 10*eps*lapack::lange( lapack::Norm::Fro, n, k,
+                                           Adata.data(), lda );
+        slate::LowRankTile< scalar_t > Alr;
+        slate::tile::compress( A, tol, Alr );
+
+        if (verbose) {
+            printf( "herk_lowrank( uplo=%c )\n", char(uplo) );
+        }
+
+        // reference solution, dense
+        std::vector< scalar_t > Cref( Cdata );
+        blas::herk( blas::Layout::ColMajor, uplo, blas::Op::NoTrans, n, k,
+                    alpha, Adata.data(), lda, beta, Cref.data(), ldc );
+        real_t Cnorm = lapack::lange( lapack::Norm::Fro, n, n,
+                                      Cref.data(), ldc );
+
+        // run test
+        slate::tile::herk( alpha, Alr, beta, C );
+        test_assert_equal( C, Cref.data(), ldc,
+                           100*eps*Cnorm, 100*eps*Cnorm );
+    }
+}
+
+void test_herk_lowrank()
+{
+    test_herk_lowrank< float  >();
+    test_herk_lowrank< double >();
+    test_herk_lowrank< std::complex<float>  >();
+    test_herk_lowrank< std::complex<double> >();
+}
+
 //------------------------------------------------------------------------------
 enum class Section {
     newline = 0,  // zero flag forces newline
@@ -1321,6 +1616,7 @@ enum class Section {
     factor,
     convert,
     copy,
+    lowrank,
 };
 
 //------------------------------------------------------------------------------
@@ -1354,6 +1650,12 @@ std::vector< routines_t > routines = {
     { "deepTranspose",         test_deepTranspose,         Section::copy },
     { "deepConjTranspose",     test_deepConjTranspose,     Section::copy },
     { "",                      nullptr,                    Section::newline },
+
+    { "compress",              test_compress,              Section::lowrank },
+    { "gemm_lowrank",          test_gemm_lowrank,          Section::lowrank },
+    { "herk_lowrank",          test_herk_lowrank,          Section::lowrank },
+    { "trsm_lowrank",          test_trsm_lowrank,          Section::lowrank },
+    { "",                      nullptr,                    Section::newline },
 };
 
 //------------------------------------------------------------------------------
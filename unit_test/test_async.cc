@@ -0,0 +1,165 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/internal/openmp.hh"
+
+#include "unit_test.hh"
+
+#include <unistd.h>
+
+namespace test {
+
+//------------------------------------------------------------------------------
+// global variables
+int mpi_rank;
+int mpi_size;
+MPI_Comm mpi_comm;
+
+//------------------------------------------------------------------------------
+/// Routines run in the order they were enqueued, even if earlier ones are
+/// slower.
+void test_order()
+{
+    int n = 20;
+    std::vector<int> order;
+    for (int i = 0; i < n; ++i) {
+        slate::async::enqueue( [i, &order] {
+            usleep( (i % 3) * 100 );
+            order.push_back( i );
+        } );
+    }
+    slate::async::barrier().get();
+
+    test_assert( int( order.size() ) == n );
+    for (int i = 0; i < n; ++i)
+        test_assert( order[ i ] == i );
+}
+
+//------------------------------------------------------------------------------
+/// An exception is rethrown by Future::get of its own routine only;
+/// later routines still run.
+void test_exception()
+{
+    bool ran = false;
+    auto f1 = slate::async::enqueue( [] {
+        throw slate::Exception( "async error" );
+    } );
+    auto f2 = slate::async::enqueue( [&ran] { ran = true; } );
+
+    test_assert_throw( f1.get(), slate::Exception );
+    test_assert_no_throw( f2.get() );
+    test_assert( ran );
+}
+
+//------------------------------------------------------------------------------
+/// Matrices are shallow copies: A and B go out of scope in the caller
+/// before multiply runs, and C shares the result with its copy in the queue.
+void test_shallow_copy()
+{
+    int64_t m = 30, n = 20, k = 25, nb = 8;
+    slate::Matrix<double> C( m, n, nb, mpi_size, 1, mpi_comm );
+    C.insertLocalTiles();
+    slate::set( 0.0, 0.0, C );
+
+    slate::async::Future future;
+    {
+        slate::Matrix<double> A( m, k, nb, mpi_size, 1, mpi_comm );
+        slate::Matrix<double> B( k, n, nb, mpi_size, 1, mpi_comm );
+        A.insertLocalTiles();
+        B.insertLocalTiles();
+        slate::set( 1.0, 1.0, A );
+        slate::set( 2.0, 2.0, B );
+
+        // Delay the worker, so multiply runs after A and B leave scope.
+        slate::async::enqueue( [] { usleep( 10000 ); } );
+        future = slate::async::multiply( 1.0, A, B, 0.0, C );
+    }
+    future.get();
+
+    // C = A B = 2 k everywhere.
+    for (int64_t j = 0; j < C.nt(); ++j) {
+        for (int64_t i = 0; i < C.mt(); ++i) {
+            if (C.tileIsLocal( i, j )) {
+                auto T = C( i, j );
+                for (int64_t jj = 0; jj < T.nb(); ++jj)
+                    for (int64_t ii = 0; ii < T.mb(); ++ii)
+                        test_assert( T( ii, jj ) == 2.0 * k );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// wait_all finishes queued routines and stops the worker;
+/// a later enqueue starts a new one.
+void test_wait_all()
+{
+    int count = 0;
+    for (int i = 0; i < 5; ++i)
+        slate::async::enqueue( [&count] { usleep( 100 ); ++count; } );
+    slate::async::wait_all();
+    test_assert( count == 5 );
+
+    slate::async::enqueue( [&count] { ++count; } ).get();
+    test_assert( count == 6 );
+    slate::async::wait_all();
+}
+
+//------------------------------------------------------------------------------
+/// set_num_threads sets the OpenMP team size on the worker thread only.
+void test_num_threads()
+{
+    int caller_threads = omp_get_max_threads();
+    int worker_threads = 0;
+
+    slate::async::set_num_threads( 1 );
+    slate::async::enqueue( [&worker_threads] {
+        worker_threads = omp_get_max_threads();
+    } ).get();
+    test_assert( worker_threads == 1 );
+    test_assert( omp_get_max_threads() == caller_threads );
+
+    slate::async::set_num_threads( 0 );
+    slate::async::wait_all();
+}
+
+//------------------------------------------------------------------------------
+/// Runs all tests. Called by unit test main().
+void run_tests()
+{
+    run_test(test_order,        "async order",         mpi_comm);
+    run_test(test_exception,    "async exception",     mpi_comm);
+    run_test(test_shallow_copy, "async shallow copy",  mpi_comm);
+    run_test(test_wait_all,     "async wait_all",      mpi_comm);
+    run_test(test_num_threads,  "async num_threads",   mpi_comm);
+}
+
+}  // namespace test
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    using namespace test;  // for globals mpi_rank, etc.
+
+    // Routines make MPI calls on the worker thread.
+    int provided = 0;
+    MPI_Init_thread( &argc, &argv, MPI_THREAD_MULTIPLE, &provided );
+    if (provided != MPI_THREAD_MULTIPLE) {
+        printf( "skipping: requires MPI_THREAD_MULTIPLE\n" );
+        MPI_Finalize();
+        return 0;
+    }
+
+    mpi_comm = MPI_COMM_WORLD;
+    MPI_Comm_rank( mpi_comm, &mpi_rank );
+    MPI_Comm_size( mpi_comm, &mpi_size );
+
+    int err = unit_test_main( mpi_comm );  // which calls run_tests()
+
+    slate::async::wait_all();
+    MPI_Finalize();
+    return err;
+}
@@ -57,6 +57,20 @@ void test_enums()
     assert( slate_Option_MethodLU            == int( slate::Option::MethodLU            ) );
     assert( slate_Option_MethodTrsm          == int( slate::Option::MethodTrsm          ) );
 
+    assert( slate_Option_LowRankTolerance    == int( slate::Option::LowRankTolerance    ) );
+    assert( slate_Option_CondEstColumns      == int( slate::Option::CondEstColumns      ) );
+    assert( slate_Option_MethodBand          == int( slate::Option::MethodBand          ) );
+    assert( slate_Option_HostLayout          == int( slate::Option::HostLayout          ) );
+    assert( slate_Option_PivotTree           == int( slate::Option::PivotTree           ) );
+    assert( slate_Option_ReduceRadix         == int( slate::Option::ReduceRadix         ) );
+    assert( slate_Option_ReduceSegment       == int( slate::Option::ReduceSegment       ) );
+    assert( slate_Option_ReduceScatter       == int( slate::Option::ReduceScatter       ) );
+    assert( slate_Option_ReduceNodeAware     == int( slate::Option::ReduceNodeAware     ) );
+    assert( slate_Option_PackedGemm          == int( slate::Option::PackedGemm          ) );
+    assert( slate_Option_StrassenDepth       == int( slate::Option::StrassenDepth       ) );
+    assert( slate_Option_ComplexGemm         == int( slate::Option::ComplexGemm         ) );
+    assert( slate_Option_OzakiSlices         == int( slate::Option::OzakiSlices         ) );
+
     //----------
     assert( slate_Op_NoTrans   == int( slate::Op::NoTrans   ) );
     assert( slate_Op_Trans     == int( slate::Op::Trans     ) );